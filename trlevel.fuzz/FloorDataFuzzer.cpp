@@ -0,0 +1,59 @@
+#include "FloorDataFuzzer.h"
+
+#include <cstring>
+#include <trlevel/FloorData.h>
+
+namespace trlevel
+{
+    namespace fuzz
+    {
+        std::vector<uint8_t> create_input(const std::vector<uint16_t>& floor_data, bool trng)
+        {
+            // Decoding starts at 1 as the first floordata entry is always the dummy entry.
+            const uint16_t header[2] = { 1, static_cast<uint16_t>(trng ? Flag_TRNG : 0) };
+            const uint16_t dummy = 0;
+
+            std::vector<uint8_t> input(Header_Size + sizeof(uint16_t) * (floor_data.size() + 1));
+            memcpy(&input[0], header, Header_Size);
+            memcpy(&input[Header_Size], &dummy, sizeof(dummy));
+            if (!floor_data.empty())
+            {
+                memcpy(&input[Header_Size + sizeof(dummy)], &floor_data[0], sizeof(uint16_t) * floor_data.size());
+            }
+            return input;
+        }
+
+        void run_input(const uint8_t* data, std::size_t size)
+        {
+            if (size < Header_Size)
+            {
+                return;
+            }
+
+            uint16_t header[2];
+            memcpy(header, data, Header_Size);
+
+            // Copy into an exactly sized buffer so that sanitizers catch any overreads.
+            std::vector<uint16_t> floor_data((size - Header_Size) / sizeof(uint16_t));
+            if (!floor_data.empty())
+            {
+                memcpy(&floor_data[0], data + Header_Size, floor_data.size() * sizeof(uint16_t));
+            }
+
+            try
+            {
+                parse_floordata(floor_data, header[0], (header[1] & Flag_TRNG) != 0);
+            }
+            catch (const FloorDataException&)
+            {
+                // Malformed floordata is expected - anything else is a bug.
+            }
+        }
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size)
+{
+    trlevel::fuzz::run_input(data, size);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace trlevel
+{
+    namespace fuzz
+    {
+        // Fuzz inputs are laid out as:
+        //   uint16_t start index
+        //   uint16_t flags (bit 0 = TRNG)
+        //   uint16_t floordata[]
+        const std::size_t Header_Size = 4;
+        const uint16_t Flag_TRNG = 0x1;
+
+        /// Create a fuzz input for a single sector.
+        /// @param floor_data The floordata values for the sector, not including the dummy entry.
+        /// @param trng Whether the level is a TRNG level.
+        /// @returns The bytes for the input.
+        std::vector<uint8_t> create_input(const std::vector<uint16_t>& floor_data, bool trng);
+
+        /// Run the floordata decoder over the input.
+        /// @param data The fuzz input.
+        /// @param size The size of the input in bytes.
+        void run_input(const uint8_t* data, std::size_t size);
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size);
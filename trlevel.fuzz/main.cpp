@@ -0,0 +1,164 @@
+// Standalone driver for the floordata fuzzer. When building with libFuzzer define TRLEVEL_LIBFUZZER
+// so that libFuzzer provides main instead.
+//
+// Usage:
+//   trlevel.fuzz                              Run the input from stdin (for AFL).
+//   trlevel.fuzz <input>...                   Run each of the inputs (for reproducing crashes).
+//   trlevel.fuzz --extract <level> <folder>   Write a corpus input for each distinct sector in the level.
+//   trlevel.fuzz --benchmark <level>...       Measure how many sectors per second can be decoded.
+#ifndef TRLEVEL_LIBFUZZER
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <trlevel/trlevel.h>
+#include <trlevel/FloorData.h>
+#include <trlevel/LevelLoadException.h>
+#include "FloorDataFuzzer.h"
+
+namespace
+{
+    std::vector<uint8_t> read_file(std::istream& stream)
+    {
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    void run(const std::vector<uint8_t>& input)
+    {
+        LLVMFuzzerTestOneInput(input.empty() ? nullptr : &input[0], input.size());
+    }
+
+    /// Get the floordata index of every sector in the level that has floordata.
+    std::vector<uint32_t> sector_indices(const trlevel::ILevel& level)
+    {
+        std::vector<uint32_t> indices;
+        for (uint32_t i = 0; i < level.num_rooms(); ++i)
+        {
+            for (const auto& sector : level.get_room(i).sector_list)
+            {
+                if (sector.floordata_index)
+                {
+                    indices.push_back(sector.floordata_index);
+                }
+            }
+        }
+        return indices;
+    }
+
+    int extract(const std::string& level_filename, const std::string& folder)
+    {
+        auto level = trlevel::load_level(level_filename);
+        const auto floor_data = level->get_floor_data_all();
+
+        std::set<std::vector<uint16_t>> sectors;
+        for (auto index : sector_indices(*level))
+        {
+            try
+            {
+                const auto result = trlevel::parse_floordata(floor_data, index, level->is_trng());
+                sectors.emplace(floor_data.begin() + index, floor_data.begin() + result.end_index);
+            }
+            catch (const trlevel::FloorDataException&)
+            {
+                std::cout << "Skipping malformed sector at index " << index << '\n';
+            }
+        }
+
+        uint32_t number = 0;
+        for (const auto& sector : sectors)
+        {
+            const auto input = trlevel::fuzz::create_input(sector, level->is_trng());
+            std::ofstream file(folder + "\\sector_" + std::to_string(number++) + ".bin", std::ios::binary);
+            file.write(reinterpret_cast<const char*>(&input[0]), input.size());
+        }
+
+        std::cout << "Wrote " << sectors.size() << " inputs to " << folder << '\n';
+        return 0;
+    }
+
+    int benchmark(const std::vector<std::string>& level_filenames)
+    {
+        using namespace std::chrono;
+
+        for (const auto& filename : level_filenames)
+        {
+            auto level = trlevel::load_level(filename);
+            const auto floor_data = level->get_floor_data_all();
+            const auto indices = sector_indices(*level);
+            if (indices.empty())
+            {
+                continue;
+            }
+
+            uint64_t decoded = 0;
+            uint64_t commands = 0;
+            const auto start = high_resolution_clock::now();
+            auto elapsed = high_resolution_clock::duration::zero();
+            while (elapsed < seconds(1))
+            {
+                for (auto index : indices)
+                {
+                    try
+                    {
+                        commands += trlevel::parse_floordata(floor_data, index, level->is_trng()).trigger.commands.size();
+                    }
+                    catch (const trlevel::FloorDataException&)
+                    {
+                    }
+                }
+                decoded += indices.size();
+                elapsed = high_resolution_clock::now() - start;
+            }
+
+            const double seconds_taken = duration_cast<duration<double>>(elapsed).count();
+            std::cout << filename << ": " << indices.size() << " sectors, "
+                << static_cast<uint64_t>(decoded / seconds_taken) << " sectors/s ("
+                << commands << " commands)\n";
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const std::vector<std::string> args(argv + 1, argv + argc);
+
+    try
+    {
+        if (args.empty())
+        {
+            run(read_file(std::cin));
+            return 0;
+        }
+
+        if (args[0] == "--extract" && args.size() == 3)
+        {
+            return extract(args[1], args[2]);
+        }
+
+        if (args[0] == "--benchmark")
+        {
+            return benchmark({ args.begin() + 1, args.end() });
+        }
+
+        for (const auto& filename : args)
+        {
+            std::ifstream file(filename, std::ios::binary);
+            run(read_file(file));
+        }
+    }
+    catch (const trlevel::LevelLoadException&)
+    {
+        std::cout << "Failed to load level\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,176 @@
+#include "FloorData.h"
+
+namespace trlevel
+{
+    namespace
+    {
+        const uint16_t Command_Camera = 0x1;
+        const uint16_t Command_Flipeffect = 0x9;
+        const uint16_t Command_ClearBodies = 0xB;
+        const uint16_t Command_Flyby = 0xC;
+
+        const uint8_t Trigger_Switch = 0x2;
+        const uint8_t Trigger_Key = 0x3;
+
+        /// Bounds checked reader over the floordata values.
+        class FloorDataReader final
+        {
+        public:
+            FloorDataReader(const uint16_t* data, std::size_t size)
+                : _data(data), _size(size)
+            {
+            }
+
+            uint16_t read(uint32_t index) const
+            {
+                if (index >= _size)
+                {
+                    throw FloorDataException();
+                }
+                return _data[index];
+            }
+
+            bool in_range(uint32_t index) const
+            {
+                return index < _size;
+            }
+        private:
+            const uint16_t* _data;
+            std::size_t _size;
+        };
+
+        /// Read the trigger setup and actions.
+        /// @returns The index of the last value used by the trigger.
+        uint32_t parse_trigger(const FloorDataReader& reader, uint32_t index, uint16_t subfunction, bool trng, FloorDataTrigger& trigger)
+        {
+            const uint16_t setup = reader.read(++index);
+
+            // Basic trigger setup
+            trigger.timer = setup & 0xFF;
+            trigger.oneshot = (setup & 0x100) >> 8;
+            trigger.mask = (setup & 0x3E00) >> 9;
+            trigger.type = static_cast<uint8_t>(subfunction);
+
+            if (trigger.type == Trigger_Key || trigger.type == Trigger_Switch)
+            {
+                // The next element is the lock or switch - ignore.
+                ++index;
+            }
+
+            // Parse actions
+            uint16_t command = 0;
+            while (reader.in_range(index + 1) && !(command & 0x8000))
+            {
+                command = reader.read(++index);
+                const uint16_t action = (command & 0x7C00) >> 10;
+                trigger.commands.push_back({ action, static_cast<uint16_t>(command & 0x3FF) });
+
+                // Camera has another uint16_t - skip for now.
+                // Flyby has another uint16_t Except those in title.tr4 of TRLE???
+                // TRNG flipeffects and action triggers have an additional uint16_t.
+                if (action == Command_Camera ||
+                    action == Command_Flyby ||
+                    (trng && (action == Command_ClearBodies || action == Command_Flipeffect)))
+                {
+                    command = reader.read(++index);
+                }
+            }
+
+            return index;
+        }
+    }
+
+    const char* FloorDataException::what() const noexcept
+    {
+        return "floordata";
+    }
+
+    FloorData parse_floordata(const uint16_t* floor_data, std::size_t size, uint32_t index, bool trng)
+    {
+        FloorData result;
+        result.end_index = index;
+
+        // Index 0 is the dummy entry - sectors that point to it have no floordata.
+        if (index == 0)
+        {
+            return result;
+        }
+
+        const FloorDataReader reader(floor_data, size);
+
+        // Each pass reads at least one value, so running off the end of the floordata without an
+        // end bit stops the loop rather than reading garbage.
+        while (reader.in_range(index))
+        {
+            const uint16_t floor = reader.read(index);
+            const uint16_t subfunction = (floor & 0x7F00) >> 8;
+
+            switch (floor & 0x1f)
+            {
+            case 0x1:
+                result.portal = reader.read(++index) & 0xFF;
+                result.has_portal = true;
+                break;
+            case 0x2:
+                result.floor_slant = reader.read(++index);
+                result.has_floor_slant = true;
+                break;
+            case 0x3:
+                result.ceiling_slant = reader.read(++index);
+                result.has_ceiling_slant = true;
+                break;
+            case 0x4:
+                index = parse_trigger(reader, index, subfunction, trng, result.trigger);
+                result.has_trigger = true;
+                break;
+            case 0x5:
+                result.death = true;
+                break;
+            case 0x6:
+                result.climbable |= static_cast<uint8_t>(subfunction);
+                break;
+            case 0x7:
+            case 0x8:
+            case 0xB:
+            case 0xC:
+            case 0xD:
+            case 0xE:
+                result.floor_triangulation = floor & 0x1f;
+                result.floor_triangulation_corners = reader.read(++index);
+                break;
+            case 0x9:
+            case 0xA:
+            case 0xF:
+            case 0x10:
+            case 0x11:
+            case 0x12:
+                // Ceiling triangulation - not used yet.
+                reader.read(++index);
+                break;
+            case 0x13:
+                result.monkey_swing = true;
+                break;
+            case 0x14:
+                result.minecart_left = true;
+                break;
+            case 0x15:
+                result.minecart_right = true;
+                break;
+            }
+
+            ++index;
+            if (floor & 0x8000)
+            {
+                break;
+            }
+        }
+
+        result.end_index = index;
+        return result;
+    }
+
+    FloorData parse_floordata(const std::vector<uint16_t>& floor_data, uint32_t index, bool trng)
+    {
+        return parse_floordata(floor_data.data(), floor_data.size(), index, trng);
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+namespace trlevel
+{
+    /// Thrown when the floordata for a sector cannot be decoded, for example when a function
+    /// refers to values past the end of the floordata.
+    struct FloorDataException final : public std::exception
+    {
+        virtual const char* what() const noexcept override;
+    };
+
+    /// A single action from a floordata trigger.
+    struct FloorDataCommand
+    {
+        /// The type of the command - matches the values of trview::TriggerCommandType.
+        uint16_t type;
+        /// The parameter for the command, usually an item or camera index.
+        uint16_t index;
+    };
+
+    /// Trigger function decoded from floordata.
+    struct FloorDataTrigger
+    {
+        /// The type of the trigger - matches the values of trview::TriggerType.
+        uint8_t type{ 0 };
+        uint8_t timer{ 0 };
+        uint8_t oneshot{ 0 };
+        uint8_t mask{ 0 };
+        /// The commands of every trigger function in the sector, in order. The other values are from the last trigger function.
+        std::vector<FloorDataCommand> commands;
+    };
+
+    /// The decoded contents of the floordata for a single sector.
+    struct FloorData
+    {
+        bool     has_portal{ false };
+        uint8_t  portal{ 0 };
+        bool     has_floor_slant{ false };
+        uint16_t floor_slant{ 0 };
+        bool     has_ceiling_slant{ false };
+        uint16_t ceiling_slant{ 0 };
+        bool     has_trigger{ false };
+        FloorDataTrigger trigger;
+        bool     death{ false };
+        /// The climbable subfunction value (up/right/down/left edge bits).
+        uint8_t  climbable{ 0 };
+        bool     monkey_swing{ false };
+        bool     minecart_left{ false };
+        bool     minecart_right{ false };
+        /// The floor triangulation function (0x07, 0x08, 0x0B - 0x0E) or 0 if there is none.
+        uint8_t  floor_triangulation{ 0 };
+        /// The corner heights for the floor triangulation function.
+        uint16_t floor_triangulation_corners{ 0 };
+        /// One past the index of the last floordata value used by the sector.
+        uint32_t end_index{ 0 };
+    };
+
+    /// Decode the floordata entries for a sector. Every read is bounds checked so malformed
+    /// floordata will never read outside of the buffer and will always terminate.
+    /// @param floor_data The floordata values for the level.
+    /// @param size The number of floordata values.
+    /// @param index The floordata index of the sector. Index 0 means that the sector has no floordata.
+    /// @param trng Whether the level is a TRNG level - TRNG adds extra values to some trigger commands.
+    /// @returns The decoded floordata.
+    /// @throws FloorDataException if a function requires values past the end of the floordata.
+    FloorData parse_floordata(const uint16_t* floor_data, std::size_t size, uint32_t index, bool trng);
+
+    /// Decode the floordata entries for a sector.
+    /// @param floor_data The floordata values for the level.
+    /// @param index The floordata index of the sector. Index 0 means that the sector has no floordata.
+    /// @param trng Whether the level is a TRNG level.
+    /// @returns The decoded floordata.
+    /// @throws FloorDataException if a function requires values past the end of the floordata.
+    FloorData parse_floordata(const std::vector<uint16_t>& floor_data, uint32_t index, bool trng);
+}
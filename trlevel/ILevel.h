@@ -3,6 +3,7 @@
 #include <cstdint>
 #include "trtypes.h"
 #include "LevelVersion.h"
+#include "SoundSampleArchive.h"
 
 namespace trlevel
 {
@@ -79,6 +80,36 @@ namespace trlevel
         // Returns: The floor data.
         virtual std::vector<std::uint16_t> get_floor_data_all() const = 0;
 
+        /// Get the number of boxes in the level. Boxes are the areas of floor that the AI uses to find its way around.
+        /// @returns The number of boxes.
+        virtual uint32_t num_boxes() const = 0;
+
+        /// Get the box at the specified index. Tomb Raider I boxes are converted so that the horizontal
+        /// dimensions are in sectors, as they are in the later games.
+        /// @param index The index of the box to get.
+        /// @returns The box.
+        virtual tr2_box get_box(uint32_t index) const = 0;
+
+        /// Get the number of overlap values in the level.
+        /// @returns The number of overlap values.
+        virtual uint32_t num_overlaps() const = 0;
+
+        /// Get the overlap value at the specified index. The lower 15 bits are the index of a box
+        /// and the highest bit is set on the last entry in the list of a box.
+        /// @param index The index of the overlap value to get.
+        /// @returns The overlap value.
+        virtual uint16_t get_overlap(uint32_t index) const = 0;
+
+        /// Get the number of zone arrays in the level. There are 6 in Tomb Raider I and 10 in the later games.
+        /// @returns The number of zone arrays.
+        virtual uint32_t num_zones() const = 0;
+
+        /// Get the zone that a box is in.
+        /// @param zone The index of the zone array.
+        /// @param box The index of the box.
+        /// @returns The zone number.
+        virtual int16_t get_zone(uint32_t zone, uint32_t box) const = 0;
+
         // Get the number of entities in the level.
         // Returns: The number of entities.
         virtual uint32_t num_entities() const = 0;
@@ -126,6 +157,47 @@ namespace trlevel
         // Returns: The mesh tree node.
         virtual std::vector<tr_meshtree_node> get_meshtree(uint32_t starting_index, uint32_t node_count) const = 0;
 
+        /// Get the number of animations in the level.
+        /// @returns The number of animations.
+        virtual uint32_t num_animations() const = 0;
+
+        /// Get the animation at the specified index. Animations from games before Tomb Raider IV
+        /// are converted and have no lateral speed.
+        /// @param index The index of the animation to get.
+        /// @returns The animation.
+        virtual tr4_animation get_animation(uint32_t index) const = 0;
+
+        /// Get the number of state changes in the level.
+        /// @returns The number of state changes.
+        virtual uint32_t num_state_changes() const = 0;
+
+        /// Get the state change at the specified index.
+        /// @param index The index of the state change to get.
+        /// @returns The state change.
+        virtual tr_state_change get_state_change(uint32_t index) const = 0;
+
+        /// Get the number of animation dispatches in the level.
+        /// @returns The number of animation dispatches.
+        virtual uint32_t num_anim_dispatches() const = 0;
+
+        /// Get the animation dispatch at the specified index.
+        /// @param index The index of the animation dispatch to get.
+        /// @returns The animation dispatch.
+        virtual tr_anim_dispatch get_anim_dispatch(uint32_t index) const = 0;
+
+        /// Get the number of animation command values in the level.
+        /// @returns The number of animation command values.
+        virtual uint32_t num_anim_commands() const = 0;
+
+        /// Get the animation command value at the specified index.
+        /// @param index The index of the animation command value to get.
+        /// @returns The animation command value.
+        virtual tr_anim_command get_anim_command(uint32_t index) const = 0;
+
+        /// Get the number of frame values in the level.
+        /// @returns The number of frame values.
+        virtual uint32_t num_frames() const = 0;
+
         // Get the frame at the specified index. Read the specified number of meshes.
         // frame_offset: The frame offset.
         // mesh_count: The number of meshes to read.
@@ -160,5 +232,9 @@ namespace trlevel
         virtual int16_t get_mesh_from_type_id(int16_t type) const = 0;
 
 		virtual bool is_trng() const = 0;
+
+        /// Gets the sound samples in the level file. The samples are read when they are asked for.
+        /// @returns The sound samples.
+        virtual const SoundSampleArchive& sound_samples() const = 0;
     };
 }
\ No newline at end of file
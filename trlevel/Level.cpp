@@ -16,6 +16,7 @@ namespace trlevel
         const int16_t Lara = 0;
         const int16_t LaraSkinTR3 = 315;
         const int16_t LaraSkinPostTR3 = 8;
+        const uint32_t SectorSize = 1024;
     }
 
     namespace
@@ -263,6 +264,7 @@ namespace trlevel
     }
 
     Level::Level(const std::string& filename)
+        : _sound_samples(filename)
     {
         // Load the level from the file.
         try
@@ -498,6 +500,36 @@ namespace trlevel
         return _floor_data;
     }
 
+    uint32_t Level::num_boxes() const
+    {
+        return static_cast<uint32_t>(_boxes.size());
+    }
+
+    tr2_box Level::get_box(uint32_t index) const
+    {
+        return _boxes[index];
+    }
+
+    uint32_t Level::num_overlaps() const
+    {
+        return static_cast<uint32_t>(_overlaps.size());
+    }
+
+    uint16_t Level::get_overlap(uint32_t index) const
+    {
+        return _overlaps[index];
+    }
+
+    uint32_t Level::num_zones() const
+    {
+        return _num_zones;
+    }
+
+    int16_t Level::get_zone(uint32_t zone, uint32_t box) const
+    {
+        return _zones[zone * num_boxes() + box];
+    }
+
     uint32_t Level::num_entities() const
     {
         return static_cast<uint32_t>(_entities.size());
@@ -570,6 +602,51 @@ namespace trlevel
         return nodes;
     }
 
+    uint32_t Level::num_animations() const
+    {
+        return static_cast<uint32_t>(_animations.size());
+    }
+
+    tr4_animation Level::get_animation(uint32_t index) const
+    {
+        return _animations[index];
+    }
+
+    uint32_t Level::num_state_changes() const
+    {
+        return static_cast<uint32_t>(_state_changes.size());
+    }
+
+    tr_state_change Level::get_state_change(uint32_t index) const
+    {
+        return _state_changes[index];
+    }
+
+    uint32_t Level::num_anim_dispatches() const
+    {
+        return static_cast<uint32_t>(_anim_dispatches.size());
+    }
+
+    tr_anim_dispatch Level::get_anim_dispatch(uint32_t index) const
+    {
+        return _anim_dispatches[index];
+    }
+
+    uint32_t Level::num_anim_commands() const
+    {
+        return static_cast<uint32_t>(_anim_commands.size());
+    }
+
+    tr_anim_command Level::get_anim_command(uint32_t index) const
+    {
+        return _anim_commands[index];
+    }
+
+    uint32_t Level::num_frames() const
+    {
+        return static_cast<uint32_t>(_frames.size());
+    }
+
     tr2_frame Level::get_frame(uint32_t frame_offset, uint32_t mesh_count) const
     {
         uint32_t offset = frame_offset;
@@ -666,6 +743,11 @@ namespace trlevel
 		return _trng;
 	}
 
+    const SoundSampleArchive& Level::sound_samples() const
+    {
+        return _sound_samples;
+    }
+
     bool Level::get_sprite_sequence_by_id(int32_t sprite_sequence_id, tr_sprite_sequence& output) const
     {
         auto found_sequence = std::find_if(_sprite_sequences.begin(), _sprite_sequences.end(), [=](const auto& sequence)
@@ -725,11 +807,15 @@ namespace trlevel
             skip(file, 6);
         }
 
+        // Only record where each sample is, so that they can be read if they are needed. The second size
+        // is the size of the data in the file - the first is the size of the decoded audio.
         uint32_t num_sound_samples = read<uint32_t>(file);
-        std::vector<tr4_sample> sound_samples(num_sound_samples);
         for (uint32_t i = 0; i < num_sound_samples; ++i)
         {
-            sound_samples[i].sound_data = read_compressed(file);
+            skip(file, 4);
+            const auto size = read<uint32_t>(file);
+            _sound_samples.add({ static_cast<uint64_t>(file.tellg()), size });
+            skip(file, size);
         }
 
 		if (_version == LevelVersion::Tomb4)
@@ -780,15 +866,27 @@ namespace trlevel
         _mesh_pointers = read_vector<uint32_t, uint32_t>(file);
         if (_version >= LevelVersion::Tomb4)
         {
-            auto animations = read_vector<uint32_t, tr4_animation>(file);
+            _animations = read_vector<uint32_t, tr4_animation>(file);
         }
         else
         {
-            std::vector<tr_animation> animations = read_vector<uint32_t, tr_animation>(file);
+            // Convert to the Tomb Raider IV format so that there is only one type of animation.
+            const auto animations = read_vector<uint32_t, tr_animation>(file);
+            _animations.reserve(animations.size());
+            for (const auto& animation : animations)
+            {
+                _animations.push_back(
+                    {
+                        animation.FrameOffset, animation.FrameRate, animation.FrameSize, animation.State_ID,
+                        animation.Speed, animation.Accel, 0u, 0u,
+                        animation.FrameStart, animation.FrameEnd, animation.NextAnimation, animation.NextFrame,
+                        animation.NumStateChanges, animation.StateChangeOffset, animation.NumAnimCommands, animation.AnimCommand
+                    });
+            }
         }
-        std::vector<tr_state_change> state_changes = read_vector<uint32_t, tr_state_change>(file);
-        std::vector<tr_anim_dispatch> anim_dispatches = read_vector<uint32_t, tr_anim_dispatch>(file);
-        std::vector<tr_anim_command> anim_commands = read_vector<uint32_t, tr_anim_command>(file);
+        _state_changes = read_vector<uint32_t, tr_state_change>(file);
+        _anim_dispatches = read_vector<uint32_t, tr_anim_dispatch>(file);
+        _anim_commands = read_vector<uint32_t, tr_anim_command>(file);
         _meshtree = read_vector<uint32_t, uint32_t>(file);
         _frames = read_vector<uint32_t, uint16_t>(file);
 
@@ -837,27 +935,32 @@ namespace trlevel
 
         std::vector<tr_sound_source> sound_sources = read_vector<uint32_t, tr_sound_source>(file);
 
-        uint32_t num_boxes = 0;
-        if (_version == LevelVersion::Tomb1)
-        {
-            std::vector<tr_box> boxes = read_vector<uint32_t, tr_box>(file);
-            num_boxes = static_cast<uint32_t>(boxes.size());
-        }
-        else
-        {
-            std::vector<tr2_box> boxes = read_vector<uint32_t, tr2_box>(file);
-            num_boxes = static_cast<uint32_t>(boxes.size());
-        }
-        std::vector<uint16_t> overlaps = read_vector<uint32_t, uint16_t>(file);
-
         if (_version == LevelVersion::Tomb1)
         {
-            std::vector<int16_t> zones = read_vector<int16_t>(file, num_boxes * 6);
+            // Tomb Raider I boxes are in world units, so convert them to sectors to match the later games.
+            const auto boxes = read_vector<uint32_t, tr_box>(file);
+            _boxes.reserve(boxes.size());
+            for (const auto& box : boxes)
+            {
+                _boxes.push_back(
+                    {
+                        static_cast<uint8_t>(box.Zmin / SectorSize),
+                        static_cast<uint8_t>((box.Zmax + 1) / SectorSize),
+                        static_cast<uint8_t>(box.Xmin / SectorSize),
+                        static_cast<uint8_t>((box.Xmax + 1) / SectorSize),
+                        box.TrueFloor,
+                        static_cast<int16_t>(box.OverlapIndex)
+                    });
+            }
+            _num_zones = 6;
         }
         else
         {
-            std::vector<int16_t> zones = read_vector<int16_t>(file, num_boxes * 10);
+            _boxes = read_vector<uint32_t, tr2_box>(file);
+            _num_zones = 10;
         }
+        _overlaps = read_vector<uint32_t, uint16_t>(file);
+        _zones = read_vector<int16_t>(file, num_boxes() * _num_zones);
         std::vector<uint16_t> animated_textures = read_vector<uint32_t, uint16_t>(file);
 
         if (_version >= LevelVersion::Tomb4)
@@ -944,12 +1047,22 @@ namespace trlevel
 
         std::vector<tr3_sound_details> sound_details = read_vector<uint32_t, tr3_sound_details>(file);
 
+        uint64_t sound_data_offset = 0;
+        uint32_t sound_data_size = 0;
         if (_version == LevelVersion::Tomb1)
         {
-            std::vector<uint8_t> sound_data = read_vector<int32_t, uint8_t>(file);
+            sound_data_size = read<uint32_t>(file);
+            sound_data_offset = static_cast<uint64_t>(file.tellg());
+            skip(file, sound_data_size);
         }
 
-        std::vector<uint32_t> sample_indices = read_vector<uint32_t, uint32_t>(file);		
+        std::vector<uint32_t> sample_indices = read_vector<uint32_t, uint32_t>(file);
+
+        // Tomb Raider I samples are one after another in the sound data, which is read straight from the level file.
+        if (_version == LevelVersion::Tomb1)
+        {
+            _sound_samples.add_contiguous(sound_data_offset, sound_data_size, sample_indices);
+        }
     }
 
     bool Level::find_first_entity_by_type(int16_t type, tr2_entity& entity) const
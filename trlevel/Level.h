@@ -85,6 +85,34 @@ namespace trlevel
         // Returns: The floor data.
         virtual std::vector<std::uint16_t> get_floor_data_all() const override; 
 
+        /// Get the number of boxes in the level.
+        /// @returns The number of boxes.
+        virtual uint32_t num_boxes() const override;
+
+        /// Get the box at the specified index.
+        /// @param index The index of the box to get.
+        /// @returns The box.
+        virtual tr2_box get_box(uint32_t index) const override;
+
+        /// Get the number of overlap values in the level.
+        /// @returns The number of overlap values.
+        virtual uint32_t num_overlaps() const override;
+
+        /// Get the overlap value at the specified index.
+        /// @param index The index of the overlap value to get.
+        /// @returns The overlap value.
+        virtual uint16_t get_overlap(uint32_t index) const override;
+
+        /// Get the number of zone arrays in the level.
+        /// @returns The number of zone arrays.
+        virtual uint32_t num_zones() const override;
+
+        /// Get the zone that a box is in.
+        /// @param zone The index of the zone array.
+        /// @param box The index of the box.
+        /// @returns The zone number.
+        virtual int16_t get_zone(uint32_t zone, uint32_t box) const override;
+
         // Get the number of entities in the level.
         // Returns: The number of entities.
         virtual uint32_t num_entities() const override;
@@ -132,6 +160,46 @@ namespace trlevel
         // Returns: The mesh tree node.
         virtual std::vector<tr_meshtree_node> get_meshtree(uint32_t starting_index, uint32_t node_count) const override;
 
+        /// Get the number of animations in the level.
+        /// @returns The number of animations.
+        virtual uint32_t num_animations() const override;
+
+        /// Get the animation at the specified index.
+        /// @param index The index of the animation to get.
+        /// @returns The animation.
+        virtual tr4_animation get_animation(uint32_t index) const override;
+
+        /// Get the number of state changes in the level.
+        /// @returns The number of state changes.
+        virtual uint32_t num_state_changes() const override;
+
+        /// Get the state change at the specified index.
+        /// @param index The index of the state change to get.
+        /// @returns The state change.
+        virtual tr_state_change get_state_change(uint32_t index) const override;
+
+        /// Get the number of animation dispatches in the level.
+        /// @returns The number of animation dispatches.
+        virtual uint32_t num_anim_dispatches() const override;
+
+        /// Get the animation dispatch at the specified index.
+        /// @param index The index of the animation dispatch to get.
+        /// @returns The animation dispatch.
+        virtual tr_anim_dispatch get_anim_dispatch(uint32_t index) const override;
+
+        /// Get the number of animation command values in the level.
+        /// @returns The number of animation command values.
+        virtual uint32_t num_anim_commands() const override;
+
+        /// Get the animation command value at the specified index.
+        /// @param index The index of the animation command value to get.
+        /// @returns The animation command value.
+        virtual tr_anim_command get_anim_command(uint32_t index) const override;
+
+        /// Get the number of frame values in the level.
+        /// @returns The number of frame values.
+        virtual uint32_t num_frames() const override;
+
         // Get the frame at the specified index. Read the specified number of meshes.
         // frame_offset: The frame offset.
         // mesh_count: The number of meshes to read.
@@ -166,6 +234,9 @@ namespace trlevel
         virtual int16_t get_mesh_from_type_id(int16_t type) const override;
 
 		virtual bool is_trng() const override;
+
+        /// Gets the sound samples in the level file.
+        virtual const SoundSampleArchive& sound_samples() const override;
     private:
         void generate_meshes(const std::vector<uint16_t>& mesh_data);
 
@@ -191,7 +262,16 @@ namespace trlevel
         std::vector<uint16_t>          _floor_data;
         std::vector<tr_model>          _models;
         std::vector<tr2_entity>        _entities;
+        std::vector<tr4_animation>     _animations;
+        std::vector<tr_state_change>   _state_changes;
+        std::vector<tr_anim_dispatch>  _anim_dispatches;
+        std::vector<tr_anim_command>   _anim_commands;
+        std::vector<tr2_box>           _boxes;
+        std::vector<uint16_t>          _overlaps;
+        std::vector<int16_t>           _zones;
+        uint32_t                       _num_zones{ 0u };
         std::unordered_map<uint32_t, tr_staticmesh> _static_meshes;
+        SoundSampleArchive             _sound_samples;
 
         uint16_t _lara_type{ 0u };
         uint16_t _weather_type{ 0u };
@@ -0,0 +1,72 @@
+#include "LevelSummary.h"
+
+#include <algorithm>
+#include "FloorData.h"
+#include "ILevel.h"
+#include "trlevel.h"
+
+namespace trlevel
+{
+    namespace
+    {
+        template <typename T>
+        void sort_unique(std::vector<T>& values)
+        {
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+        }
+    }
+
+    LevelSummary summarise_level(const ILevel& level)
+    {
+        LevelSummary summary;
+        summary.version = level.get_version();
+        summary.rooms = level.num_rooms();
+        summary.entities = level.num_entities();
+
+        summary.entity_types.reserve(summary.entities);
+        for (uint32_t i = 0; i < summary.entities; ++i)
+        {
+            summary.entity_types.push_back(level.get_entity(i).TypeID);
+        }
+        sort_unique(summary.entity_types);
+
+        const auto floor_data = level.get_floor_data_all();
+        const bool trng = level.is_trng();
+        for (uint32_t i = 0; i < summary.rooms; ++i)
+        {
+            const auto room = level.get_room(i);
+            for (const auto& mesh : room.static_meshes)
+            {
+                summary.static_meshes.push_back(mesh.mesh_id);
+            }
+
+            for (const auto& sector : room.sector_list)
+            {
+                try
+                {
+                    const auto data = parse_floordata(floor_data, sector.floordata_index, trng);
+                    if (data.has_trigger)
+                    {
+                        ++summary.triggers;
+                        for (const auto& command : data.trigger.commands)
+                        {
+                            summary.trigger_commands.push_back(command.type);
+                        }
+                    }
+                }
+                catch (const FloorDataException&)
+                {
+                }
+            }
+        }
+        sort_unique(summary.trigger_commands);
+        sort_unique(summary.static_meshes);
+        return summary;
+    }
+
+    LevelSummary summarise_level(const std::string& filename)
+    {
+        return summarise_level(*load_level(filename));
+    }
+}
@@ -0,0 +1,43 @@
+/// @file LevelSummary.h
+/// @brief The facts about a level that are used to search for levels without loading them.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LevelVersion.h"
+
+namespace trlevel
+{
+    struct ILevel;
+
+    /// The facts about a level that are used to search for levels.
+    struct LevelSummary
+    {
+        LevelVersion          version{ LevelVersion::Unknown };
+        uint32_t              rooms{ 0u };
+        uint32_t              entities{ 0u };
+        /// The number of sectors that have a trigger.
+        uint32_t              triggers{ 0u };
+        /// The types of the entities in the level, in order with no repeats.
+        std::vector<int16_t>  entity_types;
+        /// The types of the commands used by triggers, in order with no repeats.
+        std::vector<uint16_t> trigger_commands;
+        /// The IDs of the static meshes placed in rooms, in order with no repeats.
+        std::vector<uint16_t> static_meshes;
+    };
+
+    /// Summarise a level that has been loaded. Sectors with floordata that can't be decoded are not
+    /// counted as triggers.
+    /// @param level The level to summarise.
+    /// @returns The summary of the level.
+    LevelSummary summarise_level(const ILevel& level);
+
+    /// Load a level and summarise it.
+    /// @param filename The level to summarise.
+    /// @returns The summary of the level.
+    /// @throws LevelLoadException if the level could not be loaded.
+    LevelSummary summarise_level(const std::string& filename);
+}
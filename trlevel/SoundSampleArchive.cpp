@@ -0,0 +1,89 @@
+#include "SoundSampleArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <trview.common/Strings.h>
+
+namespace trlevel
+{
+    namespace
+    {
+        /// The size of the start of a RIFF file that says what type of file it is.
+        const uint32_t Riff_Header_Size = 12;
+
+        bool is_wave(const std::vector<uint8_t>& data)
+        {
+            return data.size() >= Riff_Header_Size &&
+                std::memcmp(&data[0], "RIFF", 4) == 0 &&
+                std::memcmp(&data[8], "WAVE", 4) == 0;
+        }
+    }
+
+    SoundSampleArchive::SoundSampleArchive(const std::string& filename)
+        : _filename(filename)
+    {
+    }
+
+    void SoundSampleArchive::add(const Location& location)
+    {
+        _samples.push_back(location);
+    }
+
+    void SoundSampleArchive::add_contiguous(uint64_t data_offset, uint32_t data_size, const std::vector<uint32_t>& starts)
+    {
+        for (std::size_t i = 0; i < starts.size(); ++i)
+        {
+            const uint32_t start = starts[i];
+            const uint32_t end = i + 1 < starts.size() ? starts[i + 1] : data_size;
+            if (start <= end && end <= data_size)
+            {
+                add({ data_offset + start, end - start });
+            }
+            else
+            {
+                add({ data_offset + std::min(start, data_size), 0u });
+            }
+        }
+    }
+
+    uint32_t SoundSampleArchive::size() const
+    {
+        return static_cast<uint32_t>(_samples.size());
+    }
+
+    uint32_t SoundSampleArchive::sample_size(uint32_t index) const
+    {
+        return index < _samples.size() ? _samples[index].size : 0u;
+    }
+
+    bool SoundSampleArchive::read(uint32_t index, std::vector<uint8_t>& buffer) const
+    {
+        if (index >= _samples.size())
+        {
+            return false;
+        }
+
+        const auto& sample = _samples[index];
+        std::ifstream file(trview::to_utf16(_filename).c_str(), std::ios::binary);
+        if (!file.is_open() || !file.seekg(sample.offset, std::ios::beg))
+        {
+            return false;
+        }
+
+        buffer.resize(sample.size);
+        return sample.size == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(&buffer[0]), sample.size));
+    }
+
+    bool SoundSampleArchive::export_wav(uint32_t index, const std::string& filename) const
+    {
+        std::vector<uint8_t> data;
+        if (!read(index, data) || !is_wave(data))
+        {
+            return false;
+        }
+
+        std::ofstream file(trview::to_utf16(filename).c_str(), std::ios::binary);
+        return file.is_open() && static_cast<bool>(file.write(reinterpret_cast<const char*>(&data[0]), data.size()));
+    }
+}
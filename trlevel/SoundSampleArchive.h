@@ -0,0 +1,72 @@
+/// @file SoundSampleArchive.h
+/// @brief The sound samples in a level file, which are read from the file when they are asked for.
+///
+/// Levels can have tens of megabytes of sound samples and most of the time none of them are used, so
+/// instead of reading every sample when the level is loaded only where each sample is in the file is
+/// kept. The samples in Tomb Raider I, IV and V levels are stored as complete RIFF wave files, so a
+/// sample can be saved as a .wav file as it is. Tomb Raider II and III keep their samples in MAIN.SFX
+/// rather than in the level, so these levels have no samples.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace trlevel
+{
+    /// The sound samples in a level file.
+    class SoundSampleArchive final
+    {
+    public:
+        /// Where a sample is in the level file.
+        struct Location
+        {
+            uint64_t offset;
+            uint32_t size;
+        };
+
+        /// Create an archive with no samples.
+        SoundSampleArchive() = default;
+
+        /// Create an archive for a level file.
+        /// @param filename The level file that the samples are in.
+        explicit SoundSampleArchive(const std::string& filename);
+
+        /// Add a sample to the archive.
+        /// @param location Where the sample is in the file.
+        void add(const Location& location);
+
+        /// Add samples that are stored one after another in a block of sound data. Each sample runs up to
+        /// the start of the next one, or to the end of the data for the last sample. A sample with a start
+        /// that is out of order or past the end of the data is added as an empty sample so that the
+        /// samples after it keep their indices.
+        /// @param data_offset Where the sound data is in the file.
+        /// @param data_size The size of the sound data in bytes.
+        /// @param starts The start of each sample, relative to the start of the sound data.
+        void add_contiguous(uint64_t data_offset, uint32_t data_size, const std::vector<uint32_t>& starts);
+
+        /// Gets the number of samples.
+        uint32_t size() const;
+
+        /// Gets the size of a sample in bytes, or 0 if there is no sample with that index.
+        /// @param index The index of the sample.
+        uint32_t sample_size(uint32_t index) const;
+
+        /// Read a sample from the file.
+        /// @param index The index of the sample.
+        /// @param buffer Set to the data of the sample. The memory of the buffer is reused, so the same buffer
+        ///               can be passed in to read many samples without allocating each time.
+        /// @returns True if the sample was read.
+        bool read(uint32_t index, std::vector<uint8_t>& buffer) const;
+
+        /// Save a sample as a wave file.
+        /// @param index The index of the sample.
+        /// @param filename The file to save the sample to.
+        /// @returns True if the sample was saved. False if the sample could not be read or is not a wave file.
+        bool export_wav(uint32_t index, const std::string& filename) const;
+    private:
+        std::string           _filename;
+        std::vector<Location> _samples;
+    };
+}
@@ -0,0 +1,180 @@
+#include "gmock/gmock.h"
+#include "gmock/gmock-generated-nice-strict.h"
+#include <trview.app/Animation/PoseCache.h>
+#include <trlevel/ILevel.h>
+
+using namespace trview;
+using namespace trlevel;
+using namespace DirectX::SimpleMath;
+using testing::NiceMock;
+using testing::Return;
+using testing::_;
+
+namespace
+{
+    class MockLevel : public ILevel
+    {
+    public:
+        MOCK_CONST_METHOD1(get_palette_entry8, tr_colour(uint32_t));
+        MOCK_CONST_METHOD1(get_palette_entry_16, tr_colour4(uint32_t));
+        MOCK_CONST_METHOD1(get_palette_entry, tr_colour4(uint32_t));
+        MOCK_CONST_METHOD2(get_palette_entry, tr_colour4(uint32_t, uint32_t));
+        MOCK_CONST_METHOD0(num_textiles, uint32_t());
+        MOCK_CONST_METHOD1(get_textile8, tr_textile8(uint32_t));
+        MOCK_CONST_METHOD1(get_textile16, tr_textile16(uint32_t));
+        MOCK_CONST_METHOD1(get_textile, std::vector<uint32_t>(uint32_t));
+        MOCK_CONST_METHOD0(num_rooms, uint32_t());
+        MOCK_CONST_METHOD1(get_room, tr3_room(uint32_t));
+        MOCK_CONST_METHOD0(num_object_textures, uint32_t());
+        MOCK_CONST_METHOD1(get_object_texture, tr_object_texture(uint32_t));
+        MOCK_CONST_METHOD0(num_floor_data, uint32_t());
+        MOCK_CONST_METHOD1(get_floor_data, uint16_t(uint32_t));
+        MOCK_CONST_METHOD0(get_floor_data_all, std::vector<uint16_t>());
+        MOCK_CONST_METHOD0(num_boxes, uint32_t());
+        MOCK_CONST_METHOD1(get_box, tr2_box(uint32_t));
+        MOCK_CONST_METHOD0(num_overlaps, uint32_t());
+        MOCK_CONST_METHOD1(get_overlap, uint16_t(uint32_t));
+        MOCK_CONST_METHOD0(num_zones, uint32_t());
+        MOCK_CONST_METHOD2(get_zone, int16_t(uint32_t, uint32_t));
+        MOCK_CONST_METHOD0(num_entities, uint32_t());
+        MOCK_CONST_METHOD1(get_entity, tr2_entity(uint32_t));
+        MOCK_CONST_METHOD0(num_models, uint32_t());
+        MOCK_CONST_METHOD1(get_model, tr_model(uint32_t));
+        MOCK_CONST_METHOD2(get_model_by_id, bool(uint32_t, tr_model&));
+        MOCK_CONST_METHOD0(num_static_meshes, uint32_t());
+        MOCK_CONST_METHOD1(get_static_mesh, tr_staticmesh(uint32_t));
+        MOCK_CONST_METHOD0(num_mesh_pointers, uint32_t());
+        MOCK_CONST_METHOD1(get_mesh_by_pointer, tr_mesh(uint32_t));
+        MOCK_CONST_METHOD2(get_meshtree, std::vector<tr_meshtree_node>(uint32_t, uint32_t));
+        MOCK_CONST_METHOD0(num_animations, uint32_t());
+        MOCK_CONST_METHOD1(get_animation, tr4_animation(uint32_t));
+        MOCK_CONST_METHOD0(num_state_changes, uint32_t());
+        MOCK_CONST_METHOD1(get_state_change, tr_state_change(uint32_t));
+        MOCK_CONST_METHOD0(num_anim_dispatches, uint32_t());
+        MOCK_CONST_METHOD1(get_anim_dispatch, tr_anim_dispatch(uint32_t));
+        MOCK_CONST_METHOD0(num_anim_commands, uint32_t());
+        MOCK_CONST_METHOD1(get_anim_command, tr_anim_command(uint32_t));
+        MOCK_CONST_METHOD0(num_frames, uint32_t());
+        MOCK_CONST_METHOD2(get_frame, tr2_frame(uint32_t, uint32_t));
+        MOCK_CONST_METHOD0(get_version, LevelVersion());
+		MOCK_CONST_METHOD0(get_ver, uint32_t());
+        MOCK_CONST_METHOD2(get_sprite_sequence_by_id, bool(int32_t, tr_sprite_sequence&));
+        MOCK_CONST_METHOD1(get_sprite_texture, tr_sprite_texture(uint32_t));
+        MOCK_CONST_METHOD2(find_first_entity_by_type, bool(int16_t, tr2_entity&));
+        MOCK_CONST_METHOD1(get_mesh_from_type_id, int16_t(int16_t));
+		MOCK_CONST_METHOD0(is_trng, bool());
+        MOCK_CONST_METHOD0(sound_samples, const SoundSampleArchive&());
+    };
+
+    /// Two animations for a model with two meshes. The first has two keyframes and moves on to the
+    /// second, which has two keyframes and loops. The root of each keyframe is one unit further along
+    /// the x axis than the one before.
+    void set_up(MockLevel& level)
+    {
+        ON_CALL(level, get_version()).WillByDefault(Return(LevelVersion::Tomb2));
+        ON_CALL(level, num_frames()).WillByDefault(Return(100u));
+        ON_CALL(level, num_animations()).WillByDefault(Return(2u));
+
+        tr4_animation first{};
+        first.FrameRate = 2;
+        first.FrameSize = 12;
+        first.FrameEnd = 3;
+        first.NextAnimation = 1;
+        first.NextFrame = 10;
+
+        tr4_animation second{};
+        second.FrameOffset = 48;
+        second.FrameRate = 1;
+        second.FrameSize = 12;
+        second.FrameStart = 10;
+        second.FrameEnd = 11;
+        second.NextAnimation = 1;
+        second.NextFrame = 10;
+
+        ON_CALL(level, get_animation(0)).WillByDefault(Return(first));
+        ON_CALL(level, get_animation(1)).WillByDefault(Return(second));
+        ON_CALL(level, get_meshtree(_, _)).WillByDefault(Return(std::vector<tr_meshtree_node>{ { 0, 1024, 0, 0 } }));
+        ON_CALL(level, get_frame(_, _)).WillByDefault(testing::Invoke([](uint32_t offset, uint32_t)
+        {
+            tr2_frame frame{};
+            frame.offsetx = static_cast<int16_t>(offset / 12 * 1024);
+            frame.values.resize(2);
+            return frame;
+        }));
+    }
+
+    tr_model model()
+    {
+        tr_model model{};
+        model.ID = 1;
+        model.NumMeshes = 2;
+        return model;
+    }
+}
+
+/// Tests that the keyframes of the animations that a model can play are decoded.
+TEST(PoseCache, LoadsAnimationsOfModel)
+{
+    NiceMock<MockLevel> level;
+    set_up(level);
+
+    PoseCache cache;
+    PoseCache::Playback playback;
+    ASSERT_TRUE(cache.load(level, model(), playback));
+    ASSERT_EQ(2u, cache.num_clips());
+    ASSERT_EQ(4u, cache.num_keys());
+
+    // Loading the model again uses the animations that have already been decoded.
+    ASSERT_TRUE(cache.load(level, model(), playback));
+    ASSERT_EQ(2u, cache.num_clips());
+}
+
+/// Tests that a model without an animation can't be played.
+TEST(PoseCache, ModelWithoutAnimation)
+{
+    NiceMock<MockLevel> level;
+    set_up(level);
+
+    auto no_animation = model();
+    no_animation.Animation = 5;
+
+    PoseCache cache;
+    PoseCache::Playback playback;
+    ASSERT_FALSE(cache.load(level, no_animation, playback));
+}
+
+/// Tests that a pose between two keyframes is interpolated and that each mesh is placed relative to its parent.
+TEST(PoseCache, InterpolatesBetweenKeyframes)
+{
+    NiceMock<MockLevel> level;
+    set_up(level);
+
+    PoseCache cache;
+    PoseCache::Playback playback;
+    cache.load(level, model(), playback);
+    cache.advance(playback, 1.0f / 30.0f);
+
+    std::vector<Matrix> transforms;
+    cache.evaluate(playback, transforms);
+    ASSERT_EQ(2u, transforms.size());
+    ASSERT_NEAR(0.5f, transforms[0].Translation().x, 0.001f);
+    ASSERT_NEAR(1.5f, transforms[1].Translation().x, 0.001f);
+}
+
+/// Tests that the next animation is played when an animation ends.
+TEST(PoseCache, PlaysNextAnimation)
+{
+    NiceMock<MockLevel> level;
+    set_up(level);
+
+    PoseCache cache;
+    PoseCache::Playback playback;
+    cache.load(level, model(), playback);
+    cache.advance(playback, 5.0f / 30.0f);
+    ASSERT_EQ(1u, playback.clip);
+    ASSERT_NEAR(1.0f, playback.frame, 0.001f);
+
+    std::vector<Matrix> transforms;
+    cache.evaluate(playback, transforms);
+    ASSERT_NEAR(3.0f, transforms[0].Translation().x, 0.001f);
+}
@@ -5,6 +5,7 @@
 #include <trview.graphics/IShader.h>
 #include <trview.tests.common/Window.h>
 #include <trview.app/Elements/ITypeNameLookup.h>
+#include <trview.app/Graphics/CompressedTileCache.h>
 
 using namespace trview;
 using namespace trview::graphics;
@@ -39,6 +40,12 @@ namespace
         MOCK_CONST_METHOD0(num_floor_data, uint32_t());
         MOCK_CONST_METHOD1(get_floor_data, uint16_t(uint32_t));
         MOCK_CONST_METHOD0(get_floor_data_all, std::vector<uint16_t>());
+        MOCK_CONST_METHOD0(num_boxes, uint32_t());
+        MOCK_CONST_METHOD1(get_box, tr2_box(uint32_t));
+        MOCK_CONST_METHOD0(num_overlaps, uint32_t());
+        MOCK_CONST_METHOD1(get_overlap, uint16_t(uint32_t));
+        MOCK_CONST_METHOD0(num_zones, uint32_t());
+        MOCK_CONST_METHOD2(get_zone, int16_t(uint32_t, uint32_t));
         MOCK_CONST_METHOD0(num_entities, uint32_t());
         MOCK_CONST_METHOD1(get_entity, tr2_entity(uint32_t));
         MOCK_CONST_METHOD0(num_models, uint32_t());
@@ -49,6 +56,15 @@ namespace
         MOCK_CONST_METHOD0(num_mesh_pointers, uint32_t());
         MOCK_CONST_METHOD1(get_mesh_by_pointer, tr_mesh(uint32_t));
         MOCK_CONST_METHOD2(get_meshtree, std::vector<tr_meshtree_node>(uint32_t, uint32_t));
+        MOCK_CONST_METHOD0(num_animations, uint32_t());
+        MOCK_CONST_METHOD1(get_animation, tr4_animation(uint32_t));
+        MOCK_CONST_METHOD0(num_state_changes, uint32_t());
+        MOCK_CONST_METHOD1(get_state_change, tr_state_change(uint32_t));
+        MOCK_CONST_METHOD0(num_anim_dispatches, uint32_t());
+        MOCK_CONST_METHOD1(get_anim_dispatch, tr_anim_dispatch(uint32_t));
+        MOCK_CONST_METHOD0(num_anim_commands, uint32_t());
+        MOCK_CONST_METHOD1(get_anim_command, tr_anim_command(uint32_t));
+        MOCK_CONST_METHOD0(num_frames, uint32_t());
         MOCK_CONST_METHOD2(get_frame, tr2_frame(uint32_t, uint32_t));
         MOCK_CONST_METHOD0(get_version, LevelVersion());
 		MOCK_CONST_METHOD0(get_ver, uint32_t());
@@ -57,6 +73,7 @@ namespace
         MOCK_CONST_METHOD2(find_first_entity_by_type, bool(int16_t, tr2_entity&));
         MOCK_CONST_METHOD1(get_mesh_from_type_id, int16_t(int16_t));
 		MOCK_CONST_METHOD0(is_trng, bool());
+        MOCK_CONST_METHOD0(sound_samples, const SoundSampleArchive&());
     };
 
     class MockTypeNameLookup : public ITypeNameLookup
@@ -86,5 +103,5 @@ TEST(Level, LoadTypeNames)
     MockTypeNameLookup mock_type_name_lookup;
     EXPECT_CALL(mock_type_name_lookup, lookup_type_name(LevelVersion::Tomb2, 123));
 
-    Level level(graphics::Device(), NiceMock<MockShaderStorage>(), std::move(mock_level), mock_type_name_lookup);
+    Level level(graphics::Device(), NiceMock<MockShaderStorage>(), std::move(mock_level), mock_type_name_lookup, CompressedTileCache(std::wstring()));
 }
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+#include <trview.app/Elements/TriggerWalls.h>
+
+using namespace trview;
+
+namespace
+{
+    TriggerFloor trigger(float height)
+    {
+        return { true, true, { height, height, height, height } };
+    }
+
+    TriggerFloor portal_trigger(float height)
+    {
+        return { false, true, { height, height, height, height } };
+    }
+}
+
+/// Tests that the walls between triggers next to each other at the same height are removed.
+TEST(TriggerWalls, AdjacentTriggersAtSameHeight)
+{
+    // 2 x 2 sectors, with triggers in every sector.
+    const std::vector<TriggerFloor> floors{ trigger(1), trigger(1), trigger(1), trigger(1) };
+    const auto walls = trigger_walls(2, 2, floors);
+    ASSERT_EQ(4u, walls.size());
+    ASSERT_EQ(Trigger_Wall_Neg_X | Trigger_Wall_Neg_Z, walls[0]);
+    ASSERT_EQ(Trigger_Wall_Neg_X | Trigger_Wall_Pos_Z, walls[1]);
+    ASSERT_EQ(Trigger_Wall_Pos_X | Trigger_Wall_Neg_Z, walls[2]);
+    ASSERT_EQ(Trigger_Wall_Pos_X | Trigger_Wall_Pos_Z, walls[3]);
+}
+
+/// Tests that the walls between triggers at different heights, or next to sectors without triggers, are kept.
+TEST(TriggerWalls, WallsKeptAtStepsAndEdges)
+{
+    // 3 x 1 sectors: a trigger, a trigger one click higher, and no trigger.
+    const std::vector<TriggerFloor> floors{ trigger(1), trigger(0.75f), TriggerFloor() };
+    const auto walls = trigger_walls(3, 1, floors);
+    ASSERT_EQ(Trigger_Wall_All, walls[0]);
+    ASSERT_EQ(Trigger_Wall_All, walls[1]);
+}
+
+/// Tests that sloped floors are joined when the corners on the shared edge are at the same height.
+TEST(TriggerWalls, SlopedTriggersShareEdge)
+{
+    // 1 x 2 sectors, with the floor rising along z. Corners are -x-z, -x+z, +x-z, +x+z.
+    const std::vector<TriggerFloor> floors
+    {
+        { true, true, { 1.0f, 0.75f, 1.0f, 0.75f } },
+        { true, true, { 0.75f, 0.5f, 0.75f, 0.5f } }
+    };
+    auto walls = trigger_walls(1, 2, floors);
+    ASSERT_EQ(Trigger_Wall_All & ~Trigger_Wall_Pos_Z, walls[0]);
+    ASSERT_EQ(Trigger_Wall_All & ~Trigger_Wall_Neg_Z, walls[1]);
+
+    // Turned to slope along x instead, the edge between them no longer matches.
+    const std::vector<TriggerFloor> across
+    {
+        { true, true, { 1.0f, 1.0f, 0.75f, 0.75f } },
+        { true, true, { 0.75f, 0.75f, 0.5f, 0.5f } }
+    };
+    walls = trigger_walls(1, 2, across);
+    ASSERT_EQ(Trigger_Wall_All, walls[0]);
+    ASSERT_EQ(Trigger_Wall_All, walls[1]);
+}
+
+/// Tests that a trigger on the other side of a portal at the same height removes the wall, but only
+/// when there is a trigger there.
+TEST(TriggerWalls, TriggerAcrossPortal)
+{
+    // 2 x 1 sectors, where the second sector is a portal.
+    auto walls = trigger_walls(2, 1, { trigger(1), portal_trigger(1) });
+    ASSERT_EQ(Trigger_Wall_All & ~Trigger_Wall_Pos_X, walls[0]);
+
+    walls = trigger_walls(2, 1, { trigger(1), portal_trigger(0.5f) });
+    ASSERT_EQ(Trigger_Wall_All, walls[0]);
+
+    walls = trigger_walls(2, 1, { trigger(1), TriggerFloor() });
+    ASSERT_EQ(Trigger_Wall_All, walls[0]);
+
+    // Two portals next to each other are not part of this room's overlays.
+    walls = trigger_walls(2, 1, { portal_trigger(1), portal_trigger(1) });
+    ASSERT_EQ(Trigger_Wall_All, walls[0]);
+    ASSERT_EQ(Trigger_Wall_All, walls[1]);
+}
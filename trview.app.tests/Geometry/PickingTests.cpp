@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include <trview.app/Geometry/Picking.h>
+
+#include <future>
+#include <vector>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    PickInfo pick_info(float x)
+    {
+        PickInfo info{};
+        info.position = Vector3(x, 0, 0);
+        return info;
+    }
+}
+
+/// Tests that the result of a background pick is only raised when update is called.
+TEST(Picking, ResultRaisedOnUpdate)
+{
+    Picking picking;
+    auto source_token = picking.background_pick_sources += [](PickInfo info, PickResult& result)
+    {
+        result.hit = true;
+        result.position = info.position;
+    };
+
+    std::vector<PickResult> results;
+    auto pick_token = picking.on_pick += [&](PickInfo, PickResult result) { results.push_back(result); };
+
+    picking.pick(pick_info(1.0f));
+    picking.wait();
+    ASSERT_TRUE(results.empty());
+
+    picking.update();
+    ASSERT_EQ(1u, results.size());
+    ASSERT_TRUE(results[0].hit);
+    ASSERT_EQ(1.0f, results[0].position.x);
+
+    picking.update();
+    ASSERT_EQ(1u, results.size());
+}
+
+/// Tests that requests made while a pick is in progress are coalesced so that only the latest is performed.
+TEST(Picking, PendingRequestsCoalesced)
+{
+    Picking picking;
+    std::promise<void> started;
+    std::promise<void> release;
+    auto release_future = release.get_future();
+    bool first = true;
+    std::vector<float> picked;
+
+    auto source_token = picking.background_pick_sources += [&](PickInfo info, PickResult& result)
+    {
+        picked.push_back(info.position.x);
+        if (first)
+        {
+            first = false;
+            started.set_value();
+            release_future.wait();
+        }
+        result.hit = true;
+        result.position = info.position;
+    };
+
+    std::vector<PickResult> results;
+    auto pick_token = picking.on_pick += [&](PickInfo, PickResult result) { results.push_back(result); };
+
+    picking.pick(pick_info(1.0f));
+    started.get_future().wait();
+    picking.pick(pick_info(2.0f));
+    picking.pick(pick_info(3.0f));
+    release.set_value();
+    picking.wait();
+    picking.update();
+
+    ASSERT_EQ(2u, picked.size());
+    ASSERT_EQ(1.0f, picked[0]);
+    ASSERT_EQ(3.0f, picked[1]);
+    ASSERT_EQ(1u, results.size());
+    ASSERT_EQ(3.0f, results[0].position.x);
+}
+
+/// Tests that a result is not raised if the pick was cancelled.
+TEST(Picking, CancelledResultNotRaised)
+{
+    Picking picking;
+    auto source_token = picking.background_pick_sources += [](PickInfo, PickResult& result) { result.hit = true; };
+
+    bool raised = false;
+    auto pick_token = picking.on_pick += [&](PickInfo, PickResult) { raised = true; };
+
+    picking.pick(pick_info(1.0f));
+    picking.cancel();
+    picking.update();
+
+    ASSERT_FALSE(raised);
+}
+
+/// Tests that when a pick source stops the pick the result is raised immediately and the background
+/// sources are not called.
+TEST(Picking, StoppedPickRaisedImmediately)
+{
+    Picking picking;
+    auto stop_token = picking.pick_sources += [](PickInfo, PickResult& result) { result.stop = true; };
+
+    bool background_called = false;
+    auto source_token = picking.background_pick_sources += [&](PickInfo, PickResult&) { background_called = true; };
+
+    bool raised = false;
+    auto pick_token = picking.on_pick += [&](PickInfo, PickResult result) { raised = result.stop; };
+
+    picking.pick(pick_info(1.0f));
+    ASSERT_TRUE(raised);
+
+    picking.wait();
+    ASSERT_FALSE(background_called);
+}
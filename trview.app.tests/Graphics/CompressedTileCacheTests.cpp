@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+#include <trview.app/Graphics/CompressedTileCache.h>
+#include <windows.h>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+using namespace trview;
+
+namespace
+{
+    const std::wstring Folder = L"CompressedTileCacheTests";
+
+    std::vector<CompressedTexture> tiles()
+    {
+        return { compress_texture(std::vector<uint32_t>(16 * 16, 0xff102030), 16, 16, 1) };
+    }
+
+    uint64_t file_size(const std::vector<CompressedTexture>& tiles)
+    {
+        std::stringstream stream;
+        write_compressed_textures(stream, tiles);
+        return stream.str().size();
+    }
+
+    /// Wait long enough for the system time to change, so that each use of a file has a different time.
+    void wait_for_clock()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    void remove_folder()
+    {
+        for (const auto name : { L"0000000000000001", L"0000000000000002", L"0000000000000003" })
+        {
+            DeleteFile((Folder + L"\\" + name + L".bct").c_str());
+        }
+        RemoveDirectory(Folder.c_str());
+    }
+}
+
+/// Tests that a cache with no folder doesn't keep anything.
+TEST(CompressedTileCache, NoFolderKeepsNothing)
+{
+    CompressedTileCache cache{ std::wstring() };
+    ASSERT_FALSE(cache.enabled());
+
+    cache.store(1, tiles());
+    std::vector<CompressedTexture> loaded;
+    ASSERT_FALSE(cache.load(1, loaded));
+}
+
+/// Tests that tiles that are stored can be loaded again.
+TEST(CompressedTileCache, LoadsStoredTiles)
+{
+    CreateDirectory(Folder.c_str(), nullptr);
+
+    const auto stored = tiles();
+    CompressedTileCache cache(Folder);
+    cache.store(1, stored);
+
+    std::vector<CompressedTexture> loaded;
+    ASSERT_TRUE(cache.load(1, loaded));
+    ASSERT_EQ(1u, loaded.size());
+    ASSERT_EQ(stored[0].levels[0].blocks, loaded[0].levels[0].blocks);
+    ASSERT_FALSE(cache.load(2, loaded));
+
+    remove_folder();
+}
+
+/// Tests that when the cache is over budget the file that was used least recently is removed.
+TEST(CompressedTileCache, EvictsLeastRecentlyUsed)
+{
+    CreateDirectory(Folder.c_str(), nullptr);
+
+    const auto stored = tiles();
+    CompressedTileCache cache(Folder, file_size(stored) * 2);
+    cache.store(1, stored);
+    wait_for_clock();
+    cache.store(2, stored);
+    wait_for_clock();
+
+    std::vector<CompressedTexture> loaded;
+    ASSERT_TRUE(cache.load(1, loaded));
+    wait_for_clock();
+
+    cache.store(3, stored);
+    ASSERT_TRUE(cache.load(1, loaded));
+    ASSERT_FALSE(cache.load(2, loaded));
+    ASSERT_TRUE(cache.load(3, loaded));
+
+    remove_folder();
+}
@@ -29,6 +29,12 @@ namespace
         MOCK_CONST_METHOD0(num_floor_data, uint32_t());
         MOCK_CONST_METHOD1(get_floor_data, uint16_t(uint32_t));
         MOCK_CONST_METHOD0(get_floor_data_all, std::vector<uint16_t>());
+        MOCK_CONST_METHOD0(num_boxes, uint32_t());
+        MOCK_CONST_METHOD1(get_box, tr2_box(uint32_t));
+        MOCK_CONST_METHOD0(num_overlaps, uint32_t());
+        MOCK_CONST_METHOD1(get_overlap, uint16_t(uint32_t));
+        MOCK_CONST_METHOD0(num_zones, uint32_t());
+        MOCK_CONST_METHOD2(get_zone, int16_t(uint32_t, uint32_t));
         MOCK_CONST_METHOD0(num_entities, uint32_t());
         MOCK_CONST_METHOD1(get_entity, tr2_entity(uint32_t));
         MOCK_CONST_METHOD0(num_models, uint32_t());
@@ -39,6 +45,15 @@ namespace
         MOCK_CONST_METHOD0(num_mesh_pointers, uint32_t());
         MOCK_CONST_METHOD1(get_mesh_by_pointer, tr_mesh(uint32_t));
         MOCK_CONST_METHOD2(get_meshtree, std::vector<tr_meshtree_node>(uint32_t, uint32_t));
+        MOCK_CONST_METHOD0(num_animations, uint32_t());
+        MOCK_CONST_METHOD1(get_animation, tr4_animation(uint32_t));
+        MOCK_CONST_METHOD0(num_state_changes, uint32_t());
+        MOCK_CONST_METHOD1(get_state_change, tr_state_change(uint32_t));
+        MOCK_CONST_METHOD0(num_anim_dispatches, uint32_t());
+        MOCK_CONST_METHOD1(get_anim_dispatch, tr_anim_dispatch(uint32_t));
+        MOCK_CONST_METHOD0(num_anim_commands, uint32_t());
+        MOCK_CONST_METHOD1(get_anim_command, tr_anim_command(uint32_t));
+        MOCK_CONST_METHOD0(num_frames, uint32_t());
         MOCK_CONST_METHOD2(get_frame, tr2_frame(uint32_t, uint32_t));
         MOCK_CONST_METHOD0(get_version, LevelVersion());
 		MOCK_CONST_METHOD0(get_ver, uint32_t());
@@ -47,6 +62,7 @@ namespace
         MOCK_CONST_METHOD2(find_first_entity_by_type, bool(int16_t, tr2_entity&));
         MOCK_CONST_METHOD1(get_mesh_from_type_id, int16_t(int16_t));
 		MOCK_CONST_METHOD0(is_trng, bool());
+        MOCK_CONST_METHOD0(sound_samples, const SoundSampleArchive&());
     };
 }
 
@@ -55,7 +71,7 @@ TEST(LevelTextureStorage, PaletteLoadedTomb1)
     MockLevel level;
     EXPECT_CALL(level, get_version()).WillRepeatedly(Return(LevelVersion::Tomb1));
     EXPECT_CALL(level, get_palette_entry(_)).Times(AtLeast(1));
-    LevelTextureStorage subject(graphics::Device(), level);
+    LevelTextureStorage subject(graphics::Device(), level, CompressedTileCache(std::wstring()));
 }
 
 TEST(LevelTextureStorage, PaletteLoadedTomb2)
@@ -63,7 +79,7 @@ TEST(LevelTextureStorage, PaletteLoadedTomb2)
     MockLevel level;
     EXPECT_CALL(level, get_version()).WillRepeatedly(Return(LevelVersion::Tomb2));
     EXPECT_CALL(level, get_palette_entry(_)).Times(AtLeast(1));
-    LevelTextureStorage subject(graphics::Device(), level);
+    LevelTextureStorage subject(graphics::Device(), level, CompressedTileCache(std::wstring()));
 }
 
 TEST(LevelTextureStorage, PaletteLoadedTomb3)
@@ -71,7 +87,7 @@ TEST(LevelTextureStorage, PaletteLoadedTomb3)
     MockLevel level;
     EXPECT_CALL(level, get_version()).WillRepeatedly(Return(LevelVersion::Tomb3));
     EXPECT_CALL(level, get_palette_entry(_)).Times(AtLeast(1));
-    LevelTextureStorage subject(graphics::Device(), level);
+    LevelTextureStorage subject(graphics::Device(), level, CompressedTileCache(std::wstring()));
 }
 
 TEST(LevelTextureStorage, PaletteNotLoadedTomb4)
@@ -79,7 +95,7 @@ TEST(LevelTextureStorage, PaletteNotLoadedTomb4)
     MockLevel level;
     EXPECT_CALL(level, get_version()).WillRepeatedly(Return(LevelVersion::Tomb4));
     EXPECT_CALL(level, get_palette_entry(_)).Times(Exactly(0));
-    LevelTextureStorage subject(graphics::Device(), level);
+    LevelTextureStorage subject(graphics::Device(), level, CompressedTileCache(std::wstring()));
 }
 
 TEST(LevelTextureStorage, PaletteNotLoadedTomb5)
@@ -87,5 +103,5 @@ TEST(LevelTextureStorage, PaletteNotLoadedTomb5)
     MockLevel level;
     EXPECT_CALL(level, get_version()).WillRepeatedly(Return(LevelVersion::Tomb5));
     EXPECT_CALL(level, get_palette_entry(_)).Times(Exactly(0));
-    LevelTextureStorage subject(graphics::Device(), level);
+    LevelTextureStorage subject(graphics::Device(), level, CompressedTileCache(std::wstring()));
 }
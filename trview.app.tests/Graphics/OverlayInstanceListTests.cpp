@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+#include <trview.app/Graphics/OverlayInstanceList.h>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+/// Tests that cubes are added with their transform and colour, and are only lit when there is a light direction.
+TEST(OverlayInstanceList, AddCube)
+{
+    OverlayInstanceList list;
+    list.add_cube(Matrix::CreateTranslation(1, 2, 3), Color(1, 0, 0));
+    list.add_cube(Matrix::Identity, Color(0, 1, 0), Vector3(0, 0, 1));
+
+    const auto& cubes = list.instances(OverlayInstanceList::Primitive::Cube);
+    ASSERT_EQ(2u, cubes.size());
+    ASSERT_EQ(Matrix::CreateTranslation(1, 2, 3), cubes[0].world);
+    ASSERT_EQ(Color(1, 0, 0), cubes[0].colour);
+    ASSERT_EQ(0.0f, cubes[0].light_direction.w);
+    ASSERT_EQ(Vector4(0, 0, 1, 1), cubes[1].light_direction);
+    ASSERT_TRUE(list.instances(OverlayInstanceList::Primitive::Triangle).empty());
+    ASSERT_EQ(2u, list.size());
+}
+
+/// Tests that the corners of the unit triangle are moved on to the corners of the added triangle.
+TEST(OverlayInstanceList, AddTriangle)
+{
+    const Vector3 a(1, 2, 3);
+    const Vector3 b(4, 2, 3);
+    const Vector3 c(1, 5, 7);
+    const auto offset = Matrix::CreateTranslation(10, 0, 0);
+
+    OverlayInstanceList list;
+    list.add_triangle(a, b, c, offset, Color(1, 1, 0));
+
+    const auto& triangles = list.instances(OverlayInstanceList::Primitive::Triangle);
+    ASSERT_EQ(1u, triangles.size());
+    const auto& world = triangles[0].world;
+    ASSERT_EQ(Vector3::Transform(a, offset), Vector3::Transform(Vector3(0, 0, 0), world));
+    ASSERT_EQ(Vector3::Transform(b, offset), Vector3::Transform(Vector3(1, 0, 0), world));
+    ASSERT_EQ(Vector3::Transform(c, offset), Vector3::Transform(Vector3(0, 0, 1), world));
+}
+
+/// Tests that clearing the list removes every instance.
+TEST(OverlayInstanceList, Clear)
+{
+    OverlayInstanceList list;
+    list.add_cube(Matrix::Identity, Color(1, 1, 1));
+    list.add_triangle(Vector3::Zero, Vector3::UnitX, Vector3::UnitZ, Matrix::Identity, Color(1, 1, 1));
+    ASSERT_FALSE(list.empty());
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(0u, list.size());
+}
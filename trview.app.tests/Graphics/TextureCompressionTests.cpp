@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+#include <cstdlib>
+#include <sstream>
+#include <trview.app/Graphics/TextureCompression.h>
+
+using namespace trview;
+
+namespace
+{
+    uint32_t pixel(uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+    {
+        return r | (g << 8) | (b << 16) | (a << 24);
+    }
+
+    int channel_difference(uint32_t l, uint32_t r, uint32_t shift)
+    {
+        return std::abs(static_cast<int>((l >> shift) & 0xff) - static_cast<int>((r >> shift) & 0xff));
+    }
+
+    /// A 16 pixel gradient from red to blue. The colours are spread out along a line, so a block can get
+    /// within a third of the spacing of its four colours, plus the loss of precision in the endpoints.
+    std::vector<uint32_t> gradient(uint32_t a)
+    {
+        std::vector<uint32_t> pixels;
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            pixels.push_back(pixel(200 - i * 10, 50 + i * 5, 40 + i * 12, a));
+        }
+        return pixels;
+    }
+}
+
+/// Tests that a block with one colour is decoded as that colour, to the precision of the block format.
+TEST(TextureCompression, SolidBlockRoundTrips)
+{
+    const std::vector<uint32_t> pixels(16, pixel(255, 0, 0, 255));
+    uint8_t block[8];
+    encode_bc1_block(pixels.data(), block);
+
+    uint32_t decoded[16];
+    decode_bc1_block(block, decoded);
+    for (const auto value : decoded)
+    {
+        ASSERT_EQ(pixels[0], value);
+    }
+}
+
+/// Tests that the colours of a gradient are close to the original after being compressed.
+TEST(TextureCompression, GradientIsCloseToOriginal)
+{
+    const auto pixels = gradient(255);
+    uint8_t block[8];
+    encode_bc1_block(pixels.data(), block);
+
+    uint32_t decoded[16];
+    decode_bc1_block(block, decoded);
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        for (uint32_t shift = 0; shift < 24; shift += 8)
+        {
+            ASSERT_LE(channel_difference(pixels[i], decoded[i], shift), 32);
+        }
+        ASSERT_EQ(255u, decoded[i] >> 24);
+    }
+}
+
+/// Tests that alpha values of 0 and 255 are kept exactly in a BC3 block, and that the colour of
+/// the transparent pixels doesn't affect the colour of the others.
+TEST(TextureCompression, Bc3KeepsColourKeyExact)
+{
+    auto pixels = gradient(255);
+    for (uint32_t i = 0; i < 16; i += 3)
+    {
+        pixels[i] = pixel(255, 0, 255, 0);
+    }
+    pixels[1] = (pixels[1] & 0x00ffffff) | (128u << 24);
+
+    uint8_t block[16];
+    encode_bc3_block(pixels.data(), block);
+
+    uint32_t decoded[16];
+    decode_bc3_block(block, decoded);
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        const uint32_t expected_alpha = pixels[i] >> 24;
+        if (expected_alpha == 0 || expected_alpha == 255)
+        {
+            ASSERT_EQ(expected_alpha, decoded[i] >> 24);
+        }
+        if (expected_alpha != 0)
+        {
+            for (uint32_t shift = 0; shift < 24; shift += 8)
+            {
+                ASSERT_LE(channel_difference(pixels[i], decoded[i], shift), 32);
+            }
+        }
+    }
+    ASSERT_LE(channel_difference(pixels[1], decoded[1], 24), 20);
+}
+
+/// Tests that the colour of transparent pixels isn't mixed in when making mips.
+TEST(TextureCompression, MipsIgnoreTransparentColour)
+{
+    const std::vector<uint32_t> pixels{ pixel(200, 100, 50, 255), pixel(255, 0, 255, 0), pixel(255, 0, 255, 0), pixel(200, 100, 50, 255) };
+    const auto mips = generate_mips(pixels, 2, 2, 8);
+    ASSERT_EQ(2u, mips.size());
+    ASSERT_EQ(1u, mips[1].size());
+    ASSERT_EQ(pixel(200, 100, 50, 128), mips[1][0]);
+}
+
+/// Tests that opaque textures use BC1, textures with transparency use BC3, and that the levels stop at the size of a block.
+TEST(TextureCompression, CompressTexturePicksFormatAndLevels)
+{
+    std::vector<uint32_t> pixels(32 * 32, pixel(10, 20, 30, 255));
+    auto opaque = compress_texture(pixels, 32, 32, 16);
+    ASSERT_EQ(BlockFormat::BC1, opaque.format);
+    ASSERT_EQ(4u, opaque.levels.size());
+    ASSERT_EQ(4u, opaque.levels.back().width);
+    ASSERT_EQ(8u * 8u * 8u, opaque.levels[0].blocks.size());
+    ASSERT_EQ(64u, opaque.pitch(0));
+
+    pixels[5] = 0;
+    auto transparent = compress_texture(pixels, 32, 32, 2);
+    ASSERT_EQ(BlockFormat::BC3, transparent.format);
+    ASSERT_EQ(2u, transparent.levels.size());
+    ASSERT_EQ(4u * 4u * 16u, transparent.levels[1].blocks.size());
+}
+
+/// Tests that compressed textures can be saved and loaded, and that bad data is rejected.
+TEST(TextureCompression, ReadsWhatWasWritten)
+{
+    std::vector<CompressedTexture> textures
+    {
+        compress_texture(std::vector<uint32_t>(16 * 16, pixel(1, 2, 3, 255)), 16, 16, 3),
+        compress_texture(std::vector<uint32_t>(8 * 8, pixel(1, 2, 3, 4)), 8, 8, 1)
+    };
+
+    std::stringstream stream;
+    write_compressed_textures(stream, textures);
+
+    std::vector<CompressedTexture> loaded;
+    ASSERT_TRUE(read_compressed_textures(stream, loaded));
+    ASSERT_EQ(2u, loaded.size());
+    ASSERT_EQ(BlockFormat::BC1, loaded[0].format);
+    ASSERT_EQ(3u, loaded[0].levels.size());
+    ASSERT_EQ(textures[0].levels[2].blocks, loaded[0].levels[2].blocks);
+    ASSERT_EQ(BlockFormat::BC3, loaded[1].format);
+    ASSERT_EQ(textures[1].levels[0].blocks, loaded[1].levels[0].blocks);
+
+    std::stringstream truncated(stream.str().substr(0, 20));
+    ASSERT_FALSE(read_compressed_textures(truncated, loaded));
+}
+
+/// Tests that only textures with the expected size and mip chain match the dimensions.
+TEST(TextureCompression, MatchesDimensions)
+{
+    const auto texture = compress_texture(std::vector<uint32_t>(32 * 32, pixel(1, 2, 3, 255)), 32, 32, 3);
+    ASSERT_TRUE(matches_dimensions(texture, 32, 32, 3));
+    ASSERT_TRUE(matches_dimensions(texture, 32, 32, 4));
+    ASSERT_FALSE(matches_dimensions(texture, 32, 32, 2));
+    ASSERT_FALSE(matches_dimensions(texture, 64, 64, 4));
+    ASSERT_FALSE(matches_dimensions(CompressedTexture(), 32, 32, 4));
+
+    auto smaller = compress_texture(std::vector<uint32_t>(16 * 16, pixel(1, 2, 3, 255)), 16, 16, 1);
+    ASSERT_FALSE(matches_dimensions(smaller, 32, 32, 4));
+
+    auto not_halved = texture;
+    not_halved.levels[1] = not_halved.levels[0];
+    ASSERT_FALSE(matches_dimensions(not_halved, 32, 32, 3));
+
+    auto missing_blocks = texture;
+    missing_blocks.levels[2].blocks.pop_back();
+    ASSERT_FALSE(matches_dimensions(missing_blocks, 32, 32, 3));
+}
@@ -0,0 +1,170 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include <trview.app/Library/LevelIndex.h>
+
+using namespace trview;
+using namespace trlevel;
+
+namespace
+{
+    std::vector<std::string> paths(const std::vector<LevelIndexEntry>& entries)
+    {
+        std::vector<std::string> result;
+        for (const auto& entry : entries)
+        {
+            result.push_back(entry.file.path);
+        }
+        return result;
+    }
+
+    LevelSummary summary(LevelVersion version, std::vector<int16_t> entity_types)
+    {
+        LevelSummary result;
+        result.version = version;
+        result.entity_types = entity_types;
+        return result;
+    }
+}
+
+/// Tests that only levels that are new or have changed since the last scan need to be summarised.
+TEST(LevelIndex, MergeReturnsNewAndChangedLevels)
+{
+    LevelIndex index;
+    const LevelFile a{ "C:\\levels\\a.tr2", 100, 1 };
+    const LevelFile b{ "C:\\levels\\b.tr2", 200, 1 };
+    ASSERT_EQ(2u, index.merge("C:\\levels", { b, a }, false).size());
+    ASSERT_TRUE(index.set_summary(a, {}));
+    ASSERT_TRUE(index.set_failed(b));
+
+    const LevelFile changed{ "C:\\levels\\a.tr2", 100, 2 };
+    const LevelFile c{ "C:\\levels\\c.phd", 300, 1 };
+    const auto to_summarise = index.merge("C:\\levels", { changed, b, c }, false);
+    ASSERT_EQ(2u, to_summarise.size());
+    ASSERT_EQ(changed.path, to_summarise[0].path);
+    ASSERT_EQ(c.path, to_summarise[1].path);
+    ASSERT_EQ(3u, index.size());
+
+    // A summary of the old version of the file is out of date.
+    ASSERT_FALSE(index.set_summary(a, {}));
+}
+
+/// Tests that levels that weren't found are removed, but levels in folders that weren't scanned are kept.
+TEST(LevelIndex, MergeRemovesMissingLevels)
+{
+    LevelIndex index;
+    index.merge("C:\\levels", { { "C:\\levels\\a.tr2", 1, 1 }, { "C:\\levels\\b.tr2", 1, 1 }, { "C:\\levels\\sub\\c.tr2", 1, 1 } }, true);
+    index.merge("C:\\levels2", { { "C:\\levels2\\d.tr2", 1, 1 } }, false);
+
+    index.merge("C:\\levels", { { "C:\\levels\\b.tr2", 1, 1 } }, false);
+    ASSERT_EQ((std::vector<std::string>{ "C:\\levels\\b.tr2" }), paths(index.in_folder("C:\\levels")));
+    ASSERT_EQ((std::vector<std::string>{ "C:\\levels\\sub\\c.tr2" }), paths(index.in_folder("C:\\levels\\sub")));
+
+    index.merge("C:\\levels", {}, true);
+    ASSERT_TRUE(index.in_folder("C:\\levels").empty());
+    ASSERT_TRUE(index.in_folder("C:\\levels\\sub").empty());
+    ASSERT_EQ(1u, index.size());
+}
+
+/// Tests that folders given with '/' or a trailing separator find the same levels.
+TEST(LevelIndex, InFolderNormalisesSeparators)
+{
+    LevelIndex index;
+    index.merge("C:/levels/", { { "C:\\levels\\a.tr2", 1, 1 }, { "C:\\levels\\sub\\b.tr2", 1, 1 } }, true);
+
+    ASSERT_EQ("C:\\levels", normalise_folder("C:/levels/"));
+    ASSERT_EQ((std::vector<std::string>{ "C:\\levels\\a.tr2" }), paths(index.in_folder("C:/levels")));
+    ASSERT_EQ((std::vector<std::string>{ "C:\\levels\\a.tr2" }), paths(index.in_folder("C:\\levels\\")));
+    ASSERT_EQ((std::vector<std::string>{ "C:\\levels\\sub\\b.tr2" }), paths(index.in_folder("C:/levels/sub")));
+}
+
+/// Tests that levels can be found by name, version and the types of entities in them.
+TEST(LevelIndex, FindMatchesFilter)
+{
+    LevelIndex index;
+    const LevelFile wall{ "C:\\levels\\WALL.TR2", 1, 1 };
+    const LevelFile boat{ "C:\\levels\\BOAT.TR2", 1, 1 };
+    const LevelFile caves{ "C:\\levels\\LEVEL1.PHD", 1, 1 };
+    index.merge("C:\\levels", { wall, boat, caves }, false);
+    index.set_summary(wall, summary(LevelVersion::Tomb2, { 0, 15, 30 }));
+    index.set_summary(boat, summary(LevelVersion::Tomb2, { 0, 60 }));
+
+    ASSERT_EQ(2u, index.find({}).size());
+
+    LevelFilter filter;
+    filter.name = "wall";
+    ASSERT_EQ((std::vector<std::string>{ wall.path }), paths(index.find(filter)));
+
+    filter = {};
+    filter.entity_type = 60;
+    ASSERT_EQ((std::vector<std::string>{ boat.path }), paths(index.find(filter)));
+
+    filter = {};
+    filter.version = LevelVersion::Tomb1;
+    ASSERT_TRUE(index.find(filter).empty());
+}
+
+/// Tests that levels can be found by the trigger commands and static meshes in them, and that levels
+/// that have changed since they were summarised are not found.
+TEST(LevelIndex, FindUsesTriggersAndStaticMeshes)
+{
+    LevelIndex index;
+    const LevelFile a{ "C:\\levels\\A.TR4", 1, 1 };
+    const LevelFile b{ "C:\\levels\\B.TR4", 1, 1 };
+    index.merge("C:\\levels", { a, b }, false);
+
+    LevelSummary level = summary(LevelVersion::Tomb4, { 0 });
+    level.trigger_commands = { 0, 9 };
+    level.static_meshes = { 20 };
+    index.set_summary(a, level);
+    level.trigger_commands = { 0 };
+    index.set_summary(b, level);
+
+    LevelFilter filter;
+    filter.trigger_command = 9;
+    filter.static_mesh = 20;
+    ASSERT_EQ((std::vector<std::string>{ a.path }), paths(index.find(filter)));
+
+    index.merge("C:\\levels", { { a.path, 2, 2 }, b }, false);
+    ASSERT_TRUE(index.find(filter).empty());
+}
+
+/// Tests that an index that has been written can be read back.
+TEST(LevelIndex, ReadsWhatWasWritten)
+{
+    LevelIndex index;
+    const LevelFile file{ "C:\\levels\\WALL.TR2", 1234, 5678 };
+    index.merge("C:\\levels", { file, { "C:\\levels\\BOAT.TR2", 1, 1 } }, false);
+    LevelSummary level = summary(LevelVersion::Tomb2, { 0, 15 });
+    level.rooms = 10;
+    level.entities = 20;
+    level.triggers = 30;
+    level.trigger_commands = { 0, 3 };
+    level.static_meshes = { 40 };
+    index.set_summary(file, level);
+
+    std::stringstream stream;
+    index.write(stream);
+
+    LevelIndex loaded;
+    loaded.read(stream);
+    const auto entries = loaded.in_folder("C:\\levels");
+    ASSERT_EQ(2u, entries.size());
+    ASSERT_EQ(LevelIndexEntry::Status::Pending, entries[0].status);
+    ASSERT_EQ(LevelIndexEntry::Status::Indexed, entries[1].status);
+    ASSERT_EQ(1234u, entries[1].file.size);
+    ASSERT_EQ(5678u, entries[1].file.modified);
+    ASSERT_EQ(LevelVersion::Tomb2, entries[1].summary.version);
+    ASSERT_EQ(10u, entries[1].summary.rooms);
+    ASSERT_EQ(20u, entries[1].summary.entities);
+    ASSERT_EQ(30u, entries[1].summary.triggers);
+    ASSERT_EQ((std::vector<int16_t>{ 0, 15 }), entries[1].summary.entity_types);
+    ASSERT_EQ((std::vector<uint16_t>{ 0, 3 }), entries[1].summary.trigger_commands);
+    ASSERT_EQ((std::vector<uint16_t>{ 40 }), entries[1].summary.static_meshes);
+
+    LevelFilter filter;
+    filter.static_mesh = 40;
+    ASSERT_EQ(1u, loaded.find(filter).size());
+
+    // Nothing has changed, so only the level that was never summarised needs to be summarised.
+    ASSERT_EQ(1u, loaded.merge("C:\\levels", { file, { "C:\\levels\\BOAT.TR2", 1, 1 } }, false).size());
+}
@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+#include <trview.app/Library/LevelSearchIndex.h>
+
+using namespace trview;
+using namespace trlevel;
+
+namespace
+{
+    LevelSummary summary(LevelVersion version, std::vector<int16_t> entity_types, std::vector<uint16_t> trigger_commands, std::vector<uint16_t> static_meshes)
+    {
+        LevelSummary result;
+        result.version = version;
+        result.entity_types = entity_types;
+        result.trigger_commands = trigger_commands;
+        result.static_meshes = static_meshes;
+        return result;
+    }
+}
+
+/// Tests that the levels found are the ones that have every term.
+TEST(LevelSearchIndex, FindsLevelsWithAllTerms)
+{
+    LevelSearchIndex index;
+    index.add("b", summary(LevelVersion::Tomb2, { 0, 15 }, { 0, 4 }, { 10 }));
+    index.add("a", summary(LevelVersion::Tomb2, { 0, 30 }, { 0 }, { 10, 11 }));
+    index.add("c", summary(LevelVersion::Tomb3, { 0, 15 }, { 4 }, {}));
+
+    ASSERT_EQ((std::vector<std::string>{ "a", "b", "c" }), index.find({}));
+    ASSERT_EQ((std::vector<std::string>{ "b", "c" }), index.find({ { SearchTerm::Kind::EntityType, 15 } }));
+    ASSERT_EQ((std::vector<std::string>{ "b" }), index.find({ { SearchTerm::Kind::EntityType, 15 }, { SearchTerm::Kind::StaticMesh, 10 } }));
+    ASSERT_EQ((std::vector<std::string>{ "c" }), index.find({ { SearchTerm::Kind::Version, static_cast<uint16_t>(LevelVersion::Tomb3) }, { SearchTerm::Kind::TriggerCommand, 4 } }));
+    ASSERT_TRUE(index.find({ { SearchTerm::Kind::EntityType, 99 } }).empty());
+}
+
+/// Tests that a level that is added again replaces the one that was there, and a removed level isn't found.
+TEST(LevelSearchIndex, AddReplacesAndRemoveRemoves)
+{
+    LevelSearchIndex index;
+    index.add("a", summary(LevelVersion::Tomb2, { 15 }, {}, {}));
+    index.add("a", summary(LevelVersion::Tomb2, { 30 }, {}, {}));
+    ASSERT_EQ(1u, index.size());
+    ASSERT_TRUE(index.find({ { SearchTerm::Kind::EntityType, 15 } }).empty());
+    ASSERT_EQ((std::vector<std::string>{ "a" }), index.find({ { SearchTerm::Kind::EntityType, 30 } }));
+
+    index.remove("a");
+    ASSERT_EQ(0u, index.size());
+    ASSERT_EQ(0u, index.num_terms());
+    ASSERT_TRUE(index.find({}).empty());
+}
+
+/// Tests that levels are still found after enough have been removed for the levels to be numbered again.
+TEST(LevelSearchIndex, FindsLevelsAfterManyRemoved)
+{
+    LevelSearchIndex index;
+    for (int i = 0; i < 200; ++i)
+    {
+        index.add(std::to_string(1000 + i), summary(LevelVersion::Tomb1, { static_cast<int16_t>(i % 2) }, {}, {}));
+    }
+    for (int i = 0; i < 150; ++i)
+    {
+        index.remove(std::to_string(1000 + i));
+    }
+
+    ASSERT_EQ(50u, index.size());
+    const auto odd = index.find({ { SearchTerm::Kind::EntityType, 1 } });
+    ASSERT_EQ(25u, odd.size());
+    ASSERT_EQ("1151", odd.front());
+    ASSERT_EQ("1199", odd.back());
+
+    index.add("2000", summary(LevelVersion::Tomb1, { 1 }, {}, {}));
+    ASSERT_EQ(26u, index.find({ { SearchTerm::Kind::EntityType, 1 } }).size());
+}
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include <trview.app/Routing/Pathfinder.h>
+
+using namespace trview;
+using namespace trlevel;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    /// Three boxes in a row, where the third is a step of half a sector up from the second, and
+    /// a fourth box on its own.
+    std::vector<tr2_box> boxes()
+    {
+        return
+        {
+            { 0, 2, 0, 2, 0, 0 },
+            { 0, 2, 2, 4, 0, 1 },
+            { 0, 2, 4, 6, -512, 3 },
+            { 0, 2, 10, 12, 0, 4 }
+        };
+    }
+
+    std::vector<uint16_t> overlaps()
+    {
+        return { 0x8001, 0, 0x8002, 0x8001, 0x8003 };
+    }
+}
+
+/// Tests that a path between two boxes goes through the boxes that join them.
+TEST(Pathfinder, FindsPathBetweenBoxes)
+{
+    Pathfinder pathfinder(boxes(), overlaps());
+    ASSERT_EQ(4u, pathfinder.num_boxes());
+    ASSERT_EQ((std::vector<uint32_t>{ 0, 1 }), pathfinder.find_box_path(0, 1));
+    ASSERT_EQ((std::vector<uint32_t>{ 1, 0 }), pathfinder.find_box_path(1, 0));
+}
+
+/// Tests that boxes can only be moved between when the step is within the limits.
+TEST(Pathfinder, StepLimitsBlockConnections)
+{
+    Pathfinder pathfinder(boxes(), overlaps());
+    ASSERT_TRUE(pathfinder.find_box_path(0, 2).empty());
+
+    Pathfinder climber(boxes(), overlaps(), 0.5f, 0.5f);
+    ASSERT_EQ((std::vector<uint32_t>{ 0, 1, 2 }), climber.find_box_path(0, 2));
+}
+
+/// Tests that boxes with no connection between them are not connected.
+TEST(Pathfinder, SeparateBoxesAreNotConnected)
+{
+    Pathfinder pathfinder(boxes(), overlaps(), 0.5f, 0.5f);
+    ASSERT_TRUE(pathfinder.connected(0, 2));
+    ASSERT_FALSE(pathfinder.connected(0, 3));
+    ASSERT_TRUE(pathfinder.find_path(Vector3(0.5f, 0, 0.5f), Vector3(10.5f, 0, 0.5f)).empty());
+}
+
+/// Tests that a path between two positions crosses between boxes at a sector on the shared edge
+/// and steps up where the floors are at different heights.
+TEST(Pathfinder, PathCrossesSharedEdges)
+{
+    Pathfinder pathfinder(boxes(), overlaps(), 0.5f, 0.5f);
+
+    const Vector3 from(0.5f, 0, 0.5f);
+    const Vector3 to(5.5f, -0.5f, 1.5f);
+    const std::vector<Vector3> expected{ from, Vector3(2, 0, 1.5f), Vector3(4, 0, 1.5f), Vector3(4, -0.5f, 1.5f), to };
+    ASSERT_EQ(expected, pathfinder.find_path(from, to));
+}
@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+#include <trview.app/Routing/RouteFile.h>
+#include <sstream>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+/// Tests that files with the position written as a string can still be read.
+TEST(RouteFile, ReadsStringPositions)
+{
+    std::stringstream stream(
+        "{\"colour\":\"Red\",\"waypoints\":[{\"index\":4,\"notes\":\"Jump\",\"position\":\"1.5,-2,3.25\",\"room\":7,\"type\":\"Entity\"}]}");
+
+    RouteFile file;
+    ASSERT_TRUE(read_route_file(stream, file));
+    ASSERT_EQ(std::string("Red"), file.colour);
+    ASSERT_EQ(1u, file.waypoints.size());
+    ASSERT_EQ(Vector3(1.5f, -2.0f, 3.25f), file.waypoints.position(0));
+    ASSERT_EQ(7u, file.waypoints.room(0));
+    ASSERT_EQ(4u, file.waypoints.type_index(0));
+    ASSERT_EQ(Waypoint::Type::Entity, file.waypoints.type(0));
+    ASSERT_EQ(std::wstring(L"Jump"), file.waypoints.notes(0));
+}
+
+/// Tests that a written route is read back the same, and that fields the reader doesn't know are skipped.
+TEST(RouteFile, RoundTrip)
+{
+    WaypointStore waypoints;
+    waypoints.push_back(Vector3(0.1f, 0.2f, 0.3f), 1, Waypoint::Type::Position, 0);
+    waypoints.push_back(Vector3(-4, 5, 6), 2, Waypoint::Type::Trigger, 9);
+    waypoints.set_notes(1, L"Notes with \"quotes\"\nand lines");
+
+    std::stringstream stream;
+    write_route_file(stream, "Green", waypoints);
+
+    RouteFile file;
+    ASSERT_TRUE(read_route_file(stream, file));
+    ASSERT_EQ(std::string("Green"), file.colour);
+    ASSERT_EQ(2u, file.waypoints.size());
+    ASSERT_EQ(Vector3(0.1f, 0.2f, 0.3f), file.waypoints.position(0));
+    ASSERT_EQ(Vector3(-4, 5, 6), file.waypoints.position(1));
+    ASSERT_EQ(Waypoint::Type::Trigger, file.waypoints.type(1));
+    ASSERT_EQ(9u, file.waypoints.type_index(1));
+    ASSERT_EQ(std::wstring(), file.waypoints.notes(0));
+    ASSERT_EQ(std::wstring(L"Notes with \"quotes\"\nand lines"), file.waypoints.notes(1));
+
+    std::stringstream extra("{\"version\":{\"a\":[1,{\"b\":2}]},\"waypoints\":[{\"extra\":{\"room\":5},\"room\":3,\"position\":[1,2,3]}]}");
+    RouteFile extra_file;
+    ASSERT_TRUE(read_route_file(extra, extra_file));
+    ASSERT_EQ(1u, extra_file.waypoints.size());
+    ASSERT_EQ(3u, extra_file.waypoints.room(0));
+    ASSERT_EQ(Vector3(1, 2, 3), extra_file.waypoints.position(0));
+}
+
+/// Tests that a file that isn't valid JSON isn't read.
+TEST(RouteFile, InvalidFile)
+{
+    std::stringstream stream("{\"waypoints\":[{\"room\":");
+    RouteFile file;
+    ASSERT_FALSE(read_route_file(stream, file));
+}
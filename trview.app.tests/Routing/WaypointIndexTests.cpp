@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include <trview.app/Routing/WaypointIndex.h>
+
+using namespace trview;
+using namespace DirectX;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    std::vector<BoundingBox> line_of_boxes(uint32_t count)
+    {
+        std::vector<BoundingBox> boxes;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            boxes.push_back(BoundingBox(XMFLOAT3(static_cast<float>(i), 0, 0), XMFLOAT3(0.1f, 0.5f, 0.1f)));
+        }
+        return boxes;
+    }
+}
+
+/// Tests that boxes are grouped into cells of the grid.
+TEST(WaypointIndex, GroupsBoxesIntoCells)
+{
+    WaypointIndex index(4.0f);
+    index.build(line_of_boxes(16));
+    ASSERT_EQ(16u, index.size());
+    ASSERT_EQ(4u, index.cells());
+}
+
+/// Tests that a ray only finds the boxes that it hits.
+TEST(WaypointIndex, RayFindsHitBoxes)
+{
+    WaypointIndex index(4.0f);
+    index.build(line_of_boxes(16));
+
+    std::vector<uint32_t> results;
+    index.query(Vector3(9, 5, 0), Vector3(0, -1, 0), results);
+    ASSERT_EQ(std::vector<uint32_t>{ 9 }, results);
+
+    // A ray along the line hits every box in front of it.
+    index.query(Vector3(11.5f, 0, 0), Vector3(1, 0, 0), results);
+    ASSERT_EQ((std::vector<uint32_t>{ 12, 13, 14, 15 }), results);
+
+    index.query(Vector3(9, 5, 5), Vector3(0, -1, 0), results);
+    ASSERT_TRUE(results.empty());
+}
+
+/// Tests that a frustum only finds the boxes that are in it.
+TEST(WaypointIndex, FrustumFindsBoxesInView)
+{
+    WaypointIndex index(4.0f);
+    index.build(line_of_boxes(16));
+
+    // Looking down the x axis from just past the end of the line, with a far plane that stops part way along.
+    const auto projection = XMMatrixPerspectiveFovLH(XM_PIDIV4, 1.0f, 0.1f, 6.0f);
+    BoundingFrustum frustum(projection);
+    frustum.Origin = XMFLOAT3(16, 0, 0);
+    XMStoreFloat4(&frustum.Orientation, XMQuaternionRotationRollPitchYaw(0, -XM_PIDIV2, 0));
+
+    std::vector<uint32_t> results;
+    index.query(frustum, results);
+    ASSERT_EQ((std::vector<uint32_t>{ 10, 11, 12, 13, 14, 15 }), results);
+}
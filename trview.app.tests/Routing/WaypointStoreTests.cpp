@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+#include <trview.app/Routing/WaypointStore.h>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+/// Tests that inserting and removing waypoints keeps every field of each waypoint together.
+TEST(WaypointStore, InsertAndErase)
+{
+    WaypointStore store;
+    store.push_back(Vector3(1, 0, 0), 1, Waypoint::Type::Position, 0);
+    store.push_back(Vector3(3, 0, 0), 3, Waypoint::Type::Trigger, 30);
+    store.insert(1, Vector3(2, 0, 0), 2, Waypoint::Type::Entity, 20);
+    ASSERT_EQ(3u, store.size());
+    ASSERT_EQ(Vector3(2, 0, 0), store.position(1));
+    ASSERT_EQ(2u, store.room(1));
+    ASSERT_EQ(Waypoint::Type::Entity, store.type(1));
+    ASSERT_EQ(20u, store.type_index(1));
+
+    store.erase(0);
+    ASSERT_EQ(2u, store.size());
+    ASSERT_EQ(Vector3(2, 0, 0), store.position(0));
+    ASSERT_EQ(Waypoint::Type::Trigger, store.type(1));
+    ASSERT_EQ(30u, store.type_index(1));
+}
+
+/// Tests that notes move with their waypoint and that the slots of removed notes are used again.
+TEST(WaypointStore, NotesFollowWaypoints)
+{
+    WaypointStore store;
+    store.push_back(Vector3(1, 0, 0), 0, Waypoint::Type::Position, 0);
+    store.push_back(Vector3(2, 0, 0), 0, Waypoint::Type::Position, 0);
+    store.set_notes(0, L"first");
+    store.set_notes(1, L"second");
+
+    store.insert(0, Vector3(0, 0, 0), 0, Waypoint::Type::Position, 0);
+    ASSERT_EQ(std::wstring(), store.notes(0));
+    ASSERT_EQ(std::wstring(L"first"), store.notes(1));
+    ASSERT_EQ(std::wstring(L"second"), store.notes(2));
+
+    store.erase(1);
+    ASSERT_EQ(std::wstring(L"second"), store.notes(1));
+
+    store.set_notes(0, L"again");
+    ASSERT_EQ(std::wstring(L"again"), store.notes(0));
+    ASSERT_EQ(std::wstring(L"second"), store.notes(1));
+
+    store.set_notes(1, L"");
+    ASSERT_EQ(std::wstring(), store.notes(1));
+}
@@ -0,0 +1,38 @@
+#include "gtest/gtest.h"
+#include <trview.app/Tools/Measure.h>
+#include <trview.app/Camera/OrbitCamera.h>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+/// Tests that a measurement adds a blob every quarter of a unit and one at the end.
+TEST(Measure, AddsBlobInstances)
+{
+    OrbitCamera camera(Size(100, 100));
+    OverlayInstanceList overlays;
+
+    Measure measure;
+    measure.add(Vector3::Zero);
+    measure.add(Vector3(1, 0, 0));
+    measure.render(camera, overlays);
+
+    const auto& cubes = overlays.instances(OverlayInstanceList::Primitive::Cube);
+    ASSERT_EQ(6u, cubes.size());
+    ASSERT_EQ(Vector3(0.25f, 0, 0), cubes[1].world.Translation());
+    ASSERT_EQ(Vector3(1, 0, 0), cubes.back().world.Translation());
+}
+
+/// Tests that nothing is added when the measure tool is hidden.
+TEST(Measure, HiddenAddsNothing)
+{
+    OrbitCamera camera(Size(100, 100));
+    OverlayInstanceList overlays;
+
+    Measure measure;
+    measure.add(Vector3::Zero);
+    measure.add(Vector3(1, 0, 0));
+    measure.set_visible(false);
+    measure.render(camera, overlays);
+
+    ASSERT_TRUE(overlays.empty());
+}
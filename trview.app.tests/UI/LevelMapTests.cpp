@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include <trview.app/UI/LevelMap.h>
+
+using namespace trview;
+
+namespace
+{
+    std::vector<uint32_t> numbers(const std::vector<const LevelMap::RoomArea*>& rooms)
+    {
+        std::vector<uint32_t> result;
+        for (const auto& room : rooms)
+        {
+            result.push_back(room->number);
+        }
+        return result;
+    }
+}
+
+/// Tests that the map size covers all of the rooms.
+TEST(LevelMap, SizeCoversRooms)
+{
+    LevelMap map;
+    map.set_rooms({ { 0, 10, 20, 5, 5, 0 }, { 1, 30, 10, 10, 4, 0 } });
+
+    int32_t width = 0;
+    int32_t height = 0;
+    map.size(width, height);
+    ASSERT_EQ(30, width);
+    ASSERT_EQ(15, height);
+
+    // North is at the top of the map, so the room furthest north is at the top.
+    float map_x = 0;
+    float map_y = 0;
+    map.to_map(10, 25, map_x, map_y);
+    ASSERT_EQ(0.0f, map_x);
+    ASSERT_EQ(0.0f, map_y);
+}
+
+/// Tests that only tiles that have part of the map on them are returned.
+TEST(LevelMap, TilesInAreaClippedToMap)
+{
+    LevelMap map({ 16.0f });
+    map.set_rooms({ { 0, 0, 0, 20, 10, 0 } });
+
+    // The map is 320x160 pixels, so two tiles wide and one tile high.
+    const auto tiles = map.tiles_in_area(0, -100, -100, 1000, 1000);
+    ASSERT_EQ(2u, tiles.size());
+    ASSERT_EQ(0, tiles[0].x);
+    ASSERT_EQ(1, tiles[1].x);
+    ASSERT_EQ(0, tiles[1].y);
+}
+
+/// Tests that higher rooms are drawn last and are the ones found at a position.
+TEST(LevelMap, HigherRoomsOnTop)
+{
+    LevelMap map;
+    // Lower rooms have a larger y value.
+    map.set_rooms({ { 0, 0, 0, 10, 10, -1024 }, { 1, 0, 0, 10, 10, 1024 } });
+
+    ASSERT_EQ((std::vector<uint32_t>{ 1, 0 }), numbers(map.rooms_in_tile({ 0, 0, 0 })));
+    ASSERT_EQ(0u, map.room_at(5, 5).value());
+
+    map.set_room_visible(0, false);
+    ASSERT_EQ(1u, map.room_at(5, 5).value());
+    ASSERT_EQ((std::vector<uint32_t>{ 1 }), numbers(map.rooms_in_tile({ 0, 0, 0 })));
+}
+
+/// Tests that hiding a room only marks the tiles that it overlaps as dirty.
+TEST(LevelMap, HidingRoomInvalidatesOverlappingTiles)
+{
+    LevelMap map({ 16.0f });
+    map.set_rooms({ { 0, 0, 0, 10, 10, 0 }, { 1, 40, 0, 10, 10, 0 } });
+
+    const auto tiles = map.tiles_in_area(0, 0, 0, 1000, 1000);
+    ASSERT_EQ(4u, tiles.size());
+    for (const auto& tile : tiles)
+    {
+        ASSERT_TRUE(map.is_dirty(tile));
+        map.mark_clean(tile);
+    }
+
+    // Room 0 is in the first tile only.
+    map.set_room_visible(0, false);
+    ASSERT_TRUE(map.is_dirty({ 0, 0, 0 }));
+    ASSERT_FALSE(map.is_dirty({ 0, 1, 0 }));
+    ASSERT_FALSE(map.is_dirty({ 0, 2, 0 }));
+    ASSERT_FALSE(map.is_dirty({ 0, 3, 0 }));
+
+    // Setting the same value again doesn't change anything.
+    map.mark_clean({ 0, 0, 0 });
+    const auto version = map.version();
+    map.set_room_visible(0, false);
+    ASSERT_FALSE(map.is_dirty({ 0, 0, 0 }));
+    ASSERT_EQ(version, map.version());
+}
@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include <trlevel/SoundSampleArchive.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+using namespace trlevel;
+
+namespace
+{
+    const std::string Level_Filename = "SoundSampleArchiveTests.phd";
+    const std::string Wave_Filename = "SoundSampleArchiveTests.wav";
+
+    /// The size of the data in the test level before the sound data starts.
+    const uint64_t Data_Offset = 4;
+
+    std::vector<uint8_t> wave(uint8_t value)
+    {
+        std::vector<uint8_t> data{ 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E' };
+        data.push_back(value);
+        return data;
+    }
+
+    std::vector<uint8_t> not_wave()
+    {
+        return { 'N', 'O', 'P', 'E', 0, 0, 0, 0, 'W', 'A', 'V', 'E', 1 };
+    }
+
+    /// Write a file with some data that isn't sound, then each of the samples one after another.
+    /// @returns The starts of the samples, relative to the start of the sound data.
+    std::vector<uint32_t> write_level(const std::vector<std::vector<uint8_t>>& samples)
+    {
+        std::ofstream file(Level_Filename, std::ios::binary);
+        file.write("\x20\0\0\0", Data_Offset);
+
+        std::vector<uint32_t> starts;
+        uint32_t start = 0;
+        for (const auto& sample : samples)
+        {
+            starts.push_back(start);
+            file.write(reinterpret_cast<const char*>(&sample[0]), sample.size());
+            start += static_cast<uint32_t>(sample.size());
+        }
+        return starts;
+    }
+
+    uint32_t total_size(const std::vector<std::vector<uint8_t>>& samples)
+    {
+        uint32_t size = 0;
+        for (const auto& sample : samples)
+        {
+            size += static_cast<uint32_t>(sample.size());
+        }
+        return size;
+    }
+
+    std::vector<uint8_t> read_file(const std::string& filename)
+    {
+        std::ifstream file(filename, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
+
+/// Tests that samples stored one after another are split at the start of the next sample, and can be read back.
+TEST(SoundSampleArchive, SplitsContiguousSamples)
+{
+    const std::vector<std::vector<uint8_t>> samples{ wave(1), not_wave(), { 9, 8, 7 } };
+    const auto starts = write_level(samples);
+
+    SoundSampleArchive archive(Level_Filename);
+    archive.add_contiguous(Data_Offset, total_size(samples), starts);
+    ASSERT_EQ(3u, archive.size());
+
+    std::vector<uint8_t> buffer;
+    for (uint32_t i = 0; i < samples.size(); ++i)
+    {
+        ASSERT_EQ(samples[i].size(), archive.sample_size(i));
+        ASSERT_TRUE(archive.read(i, buffer));
+        ASSERT_EQ(samples[i], buffer);
+    }
+    ASSERT_EQ(0u, archive.sample_size(3));
+    ASSERT_FALSE(archive.read(3, buffer));
+
+    std::remove(Level_Filename.c_str());
+}
+
+/// Tests that a sample that starts after the next one or ends past the end of the data is kept as an
+/// empty sample, so that the samples after it still have the right indices.
+TEST(SoundSampleArchive, MalformedSamplesKeepIndices)
+{
+    const std::vector<std::vector<uint8_t>> samples{ wave(1), wave(2), wave(3) };
+    auto starts = write_level(samples);
+    const uint32_t size = total_size(samples);
+    starts.insert(starts.begin() + 1, size - 1);
+
+    SoundSampleArchive archive(Level_Filename);
+    archive.add_contiguous(Data_Offset, size, starts);
+    ASSERT_EQ(4u, archive.size());
+    ASSERT_EQ(0u, archive.sample_size(1));
+
+    std::vector<uint8_t> buffer;
+    ASSERT_TRUE(archive.read(2, buffer));
+    ASSERT_EQ(samples[1], buffer);
+    ASSERT_TRUE(archive.read(3, buffer));
+    ASSERT_EQ(samples[2], buffer);
+
+    SoundSampleArchive past_end(Level_Filename);
+    past_end.add_contiguous(Data_Offset, size, { 0, size + 100 });
+    ASSERT_EQ(2u, past_end.size());
+    ASSERT_EQ(0u, past_end.sample_size(0));
+    ASSERT_EQ(0u, past_end.sample_size(1));
+
+    std::remove(Level_Filename.c_str());
+}
+
+/// Tests that only samples that are wave files are exported, and that they are saved as they are.
+TEST(SoundSampleArchive, ExportWav)
+{
+    const std::vector<std::vector<uint8_t>> samples{ wave(5), not_wave() };
+    const auto starts = write_level(samples);
+
+    SoundSampleArchive archive(Level_Filename);
+    archive.add_contiguous(Data_Offset, total_size(samples), starts);
+
+    ASSERT_TRUE(archive.export_wav(0, Wave_Filename));
+    ASSERT_EQ(samples[0], read_file(Wave_Filename));
+    std::remove(Wave_Filename.c_str());
+
+    ASSERT_FALSE(archive.export_wav(1, Wave_Filename));
+    ASSERT_FALSE(archive.export_wav(2, Wave_Filename));
+
+    std::remove(Level_Filename.c_str());
+}
+
+/// Tests that an archive for a file that doesn't exist can't read its samples.
+TEST(SoundSampleArchive, MissingFile)
+{
+    SoundSampleArchive archive("SoundSampleArchiveTests.missing");
+    archive.add({ 0, 4 });
+
+    std::vector<uint8_t> buffer;
+    ASSERT_FALSE(archive.read(0, buffer));
+    ASSERT_FALSE(archive.export_wav(0, Wave_Filename));
+}
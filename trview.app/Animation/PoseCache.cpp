@@ -0,0 +1,230 @@
+#define NOMINMAX
+#include "PoseCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <trlevel/ILevel.h>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        /// The rate that the game plays animations at.
+        const float Frames_Per_Second = 30.0f;
+        /// The most animations that can be moved through in one call to advance.
+        const uint32_t Max_Transitions = 16;
+        /// The number of values at the start of each Tomb Raider I frame, before the rotations.
+        const uint32_t Tr1_Frame_Header = 10;
+        /// Used for a missing clip and for the parent of the root of a skeleton.
+        const uint32_t None = 0xffffffff;
+
+        Quaternion to_quaternion(const trlevel::tr2_frame_rotation& rotation)
+        {
+            // Rotations are performed in Y, X, Z order.
+            return Quaternion::CreateFromYawPitchRoll(rotation.y, rotation.x, rotation.z);
+        }
+    }
+
+    bool PoseCache::load(const trlevel::ILevel& level, const trlevel::tr_model& model, Playback& playback)
+    {
+        if (model.NumMeshes == 0)
+        {
+            return false;
+        }
+
+        const uint32_t clip = load_clips(level, model);
+        if (clip == None)
+        {
+            return false;
+        }
+
+        playback.skeleton = load_skeleton(level, model);
+        playback.clip = clip;
+        playback.frame = 0.0f;
+        return true;
+    }
+
+    void PoseCache::advance(Playback& playback, float elapsed) const
+    {
+        playback.frame += elapsed * Frames_Per_Second;
+        for (uint32_t i = 0; i < Max_Transitions; ++i)
+        {
+            const auto& clip = _clips[playback.clip];
+            if (playback.frame < clip.length)
+            {
+                return;
+            }
+            playback.frame = clip.next_frame + (playback.frame - clip.length);
+            playback.clip = clip.next_clip;
+        }
+
+        // A long pause can move through more short animations than it is worth playing through.
+        playback.frame = std::fmod(playback.frame, _clips[playback.clip].length);
+    }
+
+    void PoseCache::evaluate(const Playback& playback, std::vector<Matrix>& transforms) const
+    {
+        const auto& skeleton = _skeletons[playback.skeleton];
+        const auto& clip = _clips[playback.clip];
+        transforms.resize(skeleton.bones);
+
+        const float key = playback.frame / clip.rate;
+        const uint32_t key0 = std::min(static_cast<uint32_t>(key), clip.keys - 1);
+        const uint32_t key1 = std::min(key0 + 1, clip.keys - 1);
+        const float t = std::min(key - key0, 1.0f);
+
+        const Quaternion* rotations0 = &_key_rotations[clip.first_rotation + key0 * clip.meshes];
+        const Quaternion* rotations1 = &_key_rotations[clip.first_rotation + key1 * clip.meshes];
+        const Bone* bones = &_bones[skeleton.first_bone];
+
+        for (uint32_t i = 0; i < skeleton.bones; ++i)
+        {
+            const Matrix rotation = Matrix::CreateFromQuaternion(
+                i < clip.meshes ? Quaternion::Lerp(rotations0[i], rotations1[i], t) : Quaternion::Identity);
+            if (i == 0)
+            {
+                const auto offset = Vector3::Lerp(_key_offsets[clip.first_key + key0], _key_offsets[clip.first_key + key1], t);
+                transforms[0] = rotation * Matrix::CreateTranslation(offset);
+            }
+            else
+            {
+                transforms[i] = rotation * Matrix::CreateTranslation(bones[i].offset) * transforms[bones[i].parent];
+            }
+        }
+    }
+
+    uint32_t PoseCache::num_clips() const
+    {
+        return static_cast<uint32_t>(_clips.size());
+    }
+
+    uint32_t PoseCache::num_keys() const
+    {
+        return static_cast<uint32_t>(_key_offsets.size());
+    }
+
+    uint32_t PoseCache::load_skeleton(const trlevel::ILevel& level, const trlevel::tr_model& model)
+    {
+        const auto found = _skeleton_lookup.find(model.ID);
+        if (found != _skeleton_lookup.end())
+        {
+            return found->second;
+        }
+
+        // The mesh tree has a node for each mesh after the first, which is at the position of the model.
+        // Each mesh is attached to the one before it unless the node says to use one from the stack.
+        Skeleton skeleton{ static_cast<uint32_t>(_bones.size()), 1u };
+        _bones.push_back({ None, Vector3::Zero });
+
+        std::vector<uint32_t> stack;
+        for (const auto& node : level.get_meshtree(model.MeshTree, model.NumMeshes - 1))
+        {
+            uint32_t parent = skeleton.bones - 1;
+            if ((node.Flags & 0x1) && !stack.empty())
+            {
+                parent = stack.back();
+                stack.pop_back();
+            }
+            if (node.Flags & 0x2)
+            {
+                stack.push_back(parent);
+            }
+            _bones.push_back({ parent, node.position() });
+            ++skeleton.bones;
+        }
+
+        const auto index = static_cast<uint32_t>(_skeletons.size());
+        _skeletons.push_back(skeleton);
+        _skeleton_lookup.emplace(model.ID, index);
+        return index;
+    }
+
+    uint32_t PoseCache::load_clips(const trlevel::ILevel& level, const trlevel::tr_model& model)
+    {
+        _clip_lookup.resize(level.num_animations(), None);
+        if (model.Animation >= _clip_lookup.size())
+        {
+            return None;
+        }
+
+        // Decode the first animation and each animation that follows on from it, until one is found
+        // that has already been decoded. The next clip is the animation index until they are all decoded.
+        const auto first_new_clip = static_cast<uint32_t>(_clips.size());
+        uint32_t animation = model.Animation;
+        while (animation < _clip_lookup.size() && _clip_lookup[animation] == None)
+        {
+            Clip clip;
+            if (!decode_clip(level, animation, model.NumMeshes, clip))
+            {
+                break;
+            }
+            _clip_lookup[animation] = static_cast<uint32_t>(_clips.size());
+            _clips.push_back(clip);
+            animation = clip.next_clip;
+        }
+
+        for (uint32_t i = first_new_clip; i < _clips.size(); ++i)
+        {
+            auto& clip = _clips[i];
+            const uint32_t next = clip.next_clip < _clip_lookup.size() ? _clip_lookup[clip.next_clip] : None;
+            if (next == None)
+            {
+                // The next animation couldn't be decoded, so loop this one instead.
+                clip.next_clip = i;
+                clip.next_frame = 0.0f;
+            }
+            else
+            {
+                clip.next_clip = next;
+                clip.next_frame = std::min(clip.next_frame, _clips[next].length - 1);
+            }
+        }
+
+        return _clip_lookup[model.Animation];
+    }
+
+    bool PoseCache::decode_clip(const trlevel::ILevel& level, uint32_t index, uint32_t meshes, Clip& clip)
+    {
+        const auto animation = level.get_animation(index);
+        const uint32_t rate = std::max<uint32_t>(animation.FrameRate, 1u);
+        const uint32_t length = animation.FrameEnd >= animation.FrameStart ? animation.FrameEnd - animation.FrameStart + 1u : 1u;
+
+        // Tomb Raider I frames are always the same size. Later games have the size in the animation.
+        const uint32_t stride = level.get_version() == trlevel::LevelVersion::Tomb1 ? Tr1_Frame_Header + 2 * meshes : animation.FrameSize;
+        const uint32_t start = animation.FrameOffset / 2;
+        if (stride == 0 || start >= level.num_frames())
+        {
+            return false;
+        }
+
+        // Only use the keyframes that are in the frame data.
+        const uint32_t keys = std::min((length - 1) / rate + 1, (level.num_frames() - start) / stride);
+        if (keys == 0)
+        {
+            return false;
+        }
+
+        const auto next = animation.NextAnimation < level.num_animations() ? level.get_animation(animation.NextAnimation) : animation;
+        clip.first_key = static_cast<uint32_t>(_key_offsets.size());
+        clip.first_rotation = static_cast<uint32_t>(_key_rotations.size());
+        clip.keys = keys;
+        clip.meshes = meshes;
+        clip.rate = static_cast<float>(rate);
+        clip.length = static_cast<float>(length);
+        clip.next_clip = animation.NextAnimation;
+        clip.next_frame = static_cast<float>(std::max(animation.NextFrame - next.FrameStart, 0));
+
+        for (uint32_t key = 0; key < keys; ++key)
+        {
+            const auto frame = level.get_frame(start + key * stride, meshes);
+            _key_offsets.push_back(frame.position());
+            for (uint32_t mesh = 0; mesh < meshes; ++mesh)
+            {
+                _key_rotations.push_back(mesh < frame.values.size() ? to_quaternion(frame.values[mesh]) : Quaternion::Identity);
+            }
+        }
+        return true;
+    }
+}
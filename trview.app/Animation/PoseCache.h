@@ -0,0 +1,104 @@
+/// @file PoseCache.h
+/// @brief Decoded animations for the models in a level, ready to be played back.
+///
+/// The frames in a level are packed and have to be decoded before they can be used, so every
+/// keyframe of an animation is decoded once when the model is loaded. The position of the root
+/// and a rotation for each mesh are stored for each keyframe, all in flat arrays shared by every
+/// animation. The rotations are stored as quaternions rather than matrices, as these are a quarter
+/// of the size and can be interpolated. The mesh tree of each model is stored as a parent index and
+/// offset for each mesh, so evaluating a pose is a single pass over the meshes.
+///
+/// Only the animations that a model can reach from its first animation by following the next
+/// animation of each one are decoded, as these are the ones that can be played back.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <SimpleMath.h>
+
+namespace trlevel
+{
+    struct ILevel;
+    struct tr_model;
+}
+
+namespace trview
+{
+    /// Decoded animations for the models in a level.
+    class PoseCache final
+    {
+    public:
+        /// The point that an animated model has got to in its animations.
+        struct Playback
+        {
+            /// The index of the skeleton of the model.
+            uint32_t skeleton{ 0u };
+            /// The index of the animation that is playing.
+            uint32_t clip{ 0u };
+            /// The number of game frames into the animation.
+            float    frame{ 0.0f };
+        };
+
+        /// Decode the mesh tree and animations of a model, if this hasn't already been done, and
+        /// start playing the first animation of the model.
+        /// @param level The level that the model is in.
+        /// @param model The model to load.
+        /// @param playback Set to the start of the first animation of the model.
+        /// @returns True if the model has an animation that can be played.
+        bool load(const trlevel::ILevel& level, const trlevel::tr_model& model, Playback& playback);
+
+        /// Move an animation on. When the end of an animation is reached the next animation is played.
+        /// @param playback The animation to move on.
+        /// @param elapsed The time to move the animation on by, in seconds.
+        void advance(Playback& playback, float elapsed) const;
+
+        /// Work out the transform of each mesh of a model at the current point in its animation.
+        /// @param playback The animation.
+        /// @param transforms Set to the transform of each mesh, relative to the model.
+        void evaluate(const Playback& playback, std::vector<DirectX::SimpleMath::Matrix>& transforms) const;
+
+        /// Gets the number of animations that have been decoded.
+        uint32_t num_clips() const;
+
+        /// Gets the number of keyframes that have been decoded.
+        uint32_t num_keys() const;
+    private:
+        struct Bone
+        {
+            uint32_t                     parent;
+            DirectX::SimpleMath::Vector3 offset;
+        };
+
+        struct Skeleton
+        {
+            uint32_t first_bone;
+            uint32_t bones;
+        };
+
+        struct Clip
+        {
+            uint32_t first_key;
+            uint32_t first_rotation;
+            uint32_t keys;
+            uint32_t meshes;
+            float    rate;       // Game frames per keyframe.
+            float    length;     // Game frames in the animation.
+            uint32_t next_clip;
+            float    next_frame;
+        };
+
+        uint32_t load_skeleton(const trlevel::ILevel& level, const trlevel::tr_model& model);
+        uint32_t load_clips(const trlevel::ILevel& level, const trlevel::tr_model& model);
+        bool decode_clip(const trlevel::ILevel& level, uint32_t index, uint32_t meshes, Clip& clip);
+
+        std::vector<Bone>                            _bones;
+        std::vector<Skeleton>                        _skeletons;
+        std::unordered_map<uint32_t, uint32_t>       _skeleton_lookup; // Model ID to skeleton index.
+        std::vector<Clip>                            _clips;
+        std::vector<uint32_t>                        _clip_lookup;     // Animation index to clip index.
+        std::vector<DirectX::SimpleMath::Vector3>    _key_offsets;     // One for each keyframe.
+        std::vector<DirectX::SimpleMath::Quaternion> _key_rotations;   // One for each mesh of each keyframe.
+    };
+}
@@ -16,7 +16,7 @@ using namespace Microsoft::WRL;
 
 namespace trview
 {
-    Entity::Entity(const graphics::Device& device, const trlevel::ILevel& level, const trlevel::tr2_entity& entity, const ILevelTextureStorage& texture_storage, const IMeshStorage& mesh_storage, uint32_t index)
+    Entity::Entity(const graphics::Device& device, const trlevel::ILevel& level, const trlevel::tr2_entity& entity, const ILevelTextureStorage& texture_storage, const IMeshStorage& mesh_storage, PoseCache& pose_cache, uint32_t index)
         : _room(entity.Room), _index(index)
     {
         using namespace DirectX;
@@ -34,6 +34,12 @@ namespace trview
             _world = Matrix::CreateRotationY((entity.Angle / 16384.0f) * XM_PIDIV2) * 
                      Matrix::CreateTranslation(entity.position());
             load_model(model, level);
+
+            if (pose_cache.load(level, model, _playback))
+            {
+                _pose_cache = &pose_cache;
+                _bind_pose = _world_transforms;
+            }
         }
         else if (level.get_sprite_sequence_by_id(entity.TypeID, sprite))
         {
@@ -187,25 +193,37 @@ namespace trview
         return _index;
     }
 
+    bool Entity::faces_camera() const
+    {
+        return _sprite_mesh != nullptr;
+    }
+
     void Entity::get_transparent_triangles(TransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour)
+    {
+        std::vector<TransparentTriangle> triangles;
+        get_transparent_triangles(triangles, camera, colour);
+        transparency.add(triangles);
+    }
+
+    void Entity::get_transparent_triangles(std::vector<TransparentTriangle>& triangles, const ICamera& camera, const DirectX::SimpleMath::Color& colour) const
     {
         for (uint32_t i = 0; i < _meshes.size(); ++i)
         {
             for (const auto& triangle : _meshes[i]->transparent_triangles())
             {
-                transparency.add(triangle.transform(_world_transforms[i] * _world, colour));
+                triangles.push_back(triangle.transform(_world_transforms[i] * _world, colour));
             }
         }
 
         if (_sprite_mesh)
         {
+            using namespace DirectX::SimpleMath;
+            Vector3 forward = camera.forward();
+            auto billboard = Matrix::CreateBillboard(_position, camera.position(), camera.up(), &forward);
+            auto world = _scale * billboard * _offset;
             for (const auto& triangle : _sprite_mesh->transparent_triangles())
             {
-                using namespace DirectX::SimpleMath;
-                Vector3 forward = camera.forward();
-                auto billboard = Matrix::CreateBillboard(_position, camera.position(), camera.up(), &forward);
-                auto world = _scale * billboard * _offset;
-                transparency.add(triangle.transform(world, colour));
+                triangles.push_back(triangle.transform(world, colour));
             }
         }
     }
@@ -295,14 +313,8 @@ namespace trview
             return;
         }
 
-        using namespace DirectX::SimpleMath;
-
-        // Remove any stored boxes so they can be created.
-        _oriented_boxes.clear();
-
-        // The entity bounding box is based on the bounding boxes of the meshes it contains.
-        // Allocate space for all of the corners.
-        std::vector<Vector3> corners(_meshes.size() * 8);
+        // This is called for every frame of an animation, so the boxes are overwritten in place.
+        _oriented_boxes.resize(_meshes.size());
 
         for (uint32_t i = 0; i < _meshes.size(); ++i)
         {
@@ -310,19 +322,51 @@ namespace trview
             auto box = _meshes[i]->bounding_box();
 
             // Transform the box by the model transform. Store this box for later picking.
-            BoundingOrientedBox oriented_box;
+            auto& oriented_box = _oriented_boxes[i];
             BoundingOrientedBox::CreateFromBoundingBox(oriented_box, box);
             oriented_box.Transform(oriented_box, _world_transforms[i] * _world);
-            oriented_box.GetCorners(&corners[i * 8]);
-            _oriented_boxes.push_back(oriented_box);
-        }
 
-        // Create an axis-aligned BB from the points of the oriented ones.
-        BoundingBox::CreateFromPoints(_bounding_box, corners.size(), &corners[0], sizeof(Vector3));
+            // The entity bounding box is the box around the corners of all of the oriented boxes.
+            XMFLOAT3 corners[BoundingOrientedBox::CORNER_COUNT];
+            oriented_box.GetCorners(corners);
+            BoundingBox mesh_box;
+            BoundingBox::CreateFromPoints(mesh_box, BoundingOrientedBox::CORNER_COUNT, corners, sizeof(XMFLOAT3));
+            if (i == 0)
+            {
+                _bounding_box = mesh_box;
+            }
+            else
+            {
+                BoundingBox::CreateMerged(_bounding_box, _bounding_box, mesh_box);
+            }
+        }
     }
 
     DirectX::BoundingBox Entity::bounding_box() const
     {
         return _bounding_box;
     }
+
+    void Entity::update(float elapsed)
+    {
+        if (!_pose_cache)
+        {
+            return;
+        }
+
+        _pose_cache->advance(_playback, elapsed);
+        _pose_cache->evaluate(_playback, _world_transforms);
+        generate_bounding_box();
+    }
+
+    void Entity::reset_pose()
+    {
+        if (!_pose_cache)
+        {
+            return;
+        }
+
+        _world_transforms = _bind_pose;
+        generate_bounding_box();
+    }
 }
@@ -8,6 +8,8 @@
 
 #include <trview.app/Geometry/PickResult.h>
 #include <trview.app/Geometry/IRenderable.h>
+#include <trview.app/Geometry/TransparentTriangle.h>
+#include <trview.app/Animation/PoseCache.h>
 
 namespace trlevel
 {
@@ -28,7 +30,7 @@ namespace trview
     class Entity : public IRenderable
     {
     public:
-        explicit Entity(const graphics::Device& device, const trlevel::ILevel& level, const trlevel::tr2_entity& room, const ILevelTextureStorage& texture_storage, const IMeshStorage& mesh_storage, uint32_t index);
+        explicit Entity(const graphics::Device& device, const trlevel::ILevel& level, const trlevel::tr2_entity& room, const ILevelTextureStorage& texture_storage, const IMeshStorage& mesh_storage, PoseCache& pose_cache, uint32_t index);
         virtual ~Entity() = default;
         virtual void render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, const DirectX::SimpleMath::Color& colour) override;
         uint16_t room() const;
@@ -36,8 +38,24 @@ namespace trview
 
         virtual void get_transparent_triangles(TransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
 
+        /// Add the transparent triangles of the entity, in world space, to the end of a list.
+        /// @param triangles The list to add the triangles to.
+        /// @param camera The current viewpoint, which sprites are turned to face.
+        /// @param colour The colour to give the triangles.
+        void get_transparent_triangles(std::vector<TransparentTriangle>& triangles, const ICamera& camera, const DirectX::SimpleMath::Color& colour) const;
+
         PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const;
         DirectX::BoundingBox bounding_box() const;
+
+        /// Move the animation of the entity on, if it has one.
+        /// @param elapsed The time since the last update, in seconds.
+        void update(float elapsed);
+
+        /// Put the entity back in the pose that it has when the level is loaded.
+        void reset_pose();
+
+        /// Gets whether the entity is a sprite that turns to face the camera, so its triangles change when the camera moves.
+        bool faces_camera() const;
     private:
         void load_meshes(const trlevel::ILevel& level, int16_t type_id, const IMeshStorage& mesh_storage);
         void load_model(const trlevel::tr_model& model, const trlevel::ILevel& level);
@@ -58,5 +76,10 @@ namespace trview
 
         DirectX::BoundingBox                      _bounding_box;
         std::vector<DirectX::BoundingOrientedBox> _oriented_boxes;
+
+        // Animation. Only set if the model has an animation that can be played.
+        const PoseCache*                          _pose_cache{ nullptr };
+        PoseCache::Playback                       _playback;
+        std::vector<DirectX::SimpleMath::Matrix>  _bind_pose;
     };
 }
@@ -10,13 +10,20 @@
 #include <trview.app/Graphics/SelectionRenderer.h>
 #include <trview.app/Graphics/MeshStorage.h>
 #include <trview.app/Elements/ITypeNameLookup.h>
+#include <trview.app/Routing/Pathfinder.h>
+#include <trview.app/Animation/PoseCache.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
 
 using namespace Microsoft::WRL;
 using namespace DirectX::SimpleMath;
 
 namespace trview
 {
-    Level::Level(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, std::unique_ptr<trlevel::ILevel>&& level, const ITypeNameLookup& type_names)
+    Level::Level(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, std::unique_ptr<trlevel::ILevel>&& level, const ITypeNameLookup& type_names, const CompressedTileCache& tile_cache)
         : _version(level->get_version())
     {
         _vertex_shader = shader_storage.get("level_vertex_shader");
@@ -36,11 +43,13 @@ namespace trview
         // Create the texture sampler state.
         device.device()->CreateSamplerState(&sampler_desc, &_sampler_state);
 
-        _texture_storage = std::make_unique<LevelTextureStorage>(device, *level);
+        _texture_storage = std::make_unique<LevelTextureStorage>(device, *level, tile_cache);
         _mesh_storage = std::make_unique<MeshStorage>(device, *level, *_texture_storage.get());
         generate_rooms(device, *level);
         generate_triggers();
+        _pose_cache = std::make_unique<PoseCache>();
         generate_entities(device, *level, type_names);
+        _pathfinder = std::make_unique<Pathfinder>(*level);
 
         for (auto& room : _rooms)
         {
@@ -106,16 +115,19 @@ namespace trview
 
     void Level::set_highlight_mode(RoomHighlightMode mode, bool enabled)
     {
-        if (enabled)
-        {
-            _room_highlight_modes.insert(mode);
-        }
-        else
         {
-            _room_highlight_modes.erase(mode);
-        }
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            if (enabled)
+            {
+                _room_highlight_modes.insert(mode);
+            }
+            else
+            {
+                _room_highlight_modes.erase(mode);
+            }
 
-        regenerate_neighbours();
+            regenerate_neighbours();
+        }
         _regenerate_transparency = true;
         on_level_changed();
     }
@@ -127,8 +139,11 @@ namespace trview
 
     void Level::set_selected_room(uint16_t index)
     { 
-        _selected_room = index;
-        regenerate_neighbours();
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            _selected_room = index;
+            regenerate_neighbours();
+        }
 
         // If the user has selected a room that is or has an alternate mode, raise the event that the
         // alternate mode needs to change so that the correct rooms can be rendered.
@@ -156,8 +171,11 @@ namespace trview
 
     void Level::set_neighbour_depth(uint32_t depth)
     {
-        _neighbour_depth = depth;
-        regenerate_neighbours();
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            _neighbour_depth = depth;
+            regenerate_neighbours();
+        }
         on_level_changed();
     }
 
@@ -193,7 +211,8 @@ namespace trview
         }
 
         // Render the opaque portions of the rooms and also collect the transparent triangles
-        // that need to be rendered in the second pass.
+        // that need to be rendered in the second pass. Each room keeps its transparent triangles
+        // between calls, so changing a view option only gathers them again and redoes the sort.
         for (const auto& room : rooms)
         {
             room.room.render(device, camera, *_texture_storage.get(), room.selection_mode, _show_hidden_geometry, _show_water);
@@ -249,13 +268,16 @@ namespace trview
     // Returns: The rooms to render and their selection mode.
     std::vector<Level::RoomToRender> Level::get_rooms_to_render(const ICamera& camera) const
     {
-        std::vector<RoomToRender> rooms;
+        return get_rooms_to_render(camera.frustum(), camera.projection_mode());
+    }
 
-        DirectX::BoundingFrustum frustum = camera.frustum();
+    std::vector<Level::RoomToRender> Level::get_rooms_to_render(const DirectX::BoundingFrustum& frustum, ProjectionMode projection_mode) const
+    {
+        std::vector<RoomToRender> rooms;
 
         auto in_view = [&](const Room& room)
         {
-            return camera.projection_mode() == ProjectionMode::Orthographic || frustum.Contains(room.bounding_box()) != DirectX::DISJOINT;
+            return projection_mode == ProjectionMode::Orthographic || frustum.Contains(room.bounding_box()) != DirectX::DISJOINT;
         };
     
         bool highlight = highlight_mode_enabled(RoomHighlightMode::Highlight);
@@ -290,10 +312,40 @@ namespace trview
     void Level::generate_rooms(const graphics::Device& device, const trlevel::ILevel& level)
     {
         const auto num_rooms = level.num_rooms();
-        for (uint32_t i = 0u; i < num_rooms; ++i)
+        const auto floor_data = level.get_floor_data_all();
+
+        // Generating the sectors and geometry for a room only reads from the level and the texture and mesh
+        // storage, so the rooms can be built in parallel. Each worker takes the next unclaimed room so that
+        // large rooms don't hold up the rest of the level.
+        std::vector<std::unique_ptr<Room>> rooms(num_rooms);
+        std::atomic<uint32_t> next_room{ 0u };
+        const auto build_rooms = [&]()
+        {
+            for (uint32_t i = next_room++; i < num_rooms; i = next_room++)
+            {
+                rooms[i] = std::make_unique<Room>(level, level.get_room(i), floor_data, *_texture_storage.get(), *_mesh_storage.get(), i, *this);
+            }
+        };
+
+        const uint32_t num_workers = std::max(1u, std::min(std::thread::hardware_concurrency(), num_rooms));
+        std::vector<std::future<void>> workers;
+        for (uint32_t i = 1u; i < num_workers; ++i)
+        {
+            workers.push_back(std::async(std::launch::async, build_rooms));
+        }
+        build_rooms();
+
+        // Rethrow any errors from the workers, such as bad floordata.
+        for (auto& worker : workers)
         {
-            auto room = level.get_room(i);
-            _rooms.push_back(std::make_unique<Room>(device, level, room, *_texture_storage.get(), *_mesh_storage.get(), i, *this));
+            worker.get();
+        }
+
+        // D3D resources are created on this thread once all of the rooms have been built.
+        for (auto& room : rooms)
+        {
+            room->generate_meshes(device);
+            _rooms.push_back(std::move(room));
         }
 
         std::set<uint32_t> alternate_groups;
@@ -344,7 +396,7 @@ namespace trview
         {
             // Entity for rendering.
             auto level_entity = level.get_entity(i);
-            auto entity = std::make_unique<Entity>(device, level, level_entity, *_texture_storage.get(), *_mesh_storage.get(), i);
+            auto entity = std::make_unique<Entity>(device, level, level_entity, *_texture_storage.get(), *_mesh_storage.get(), *_pose_cache, i);
             _rooms[entity->room()]->add_entity(entity.get());
             _entities.push_back(std::move(entity));
 
@@ -417,6 +469,12 @@ namespace trview
     // is also specified.
     PickResult Level::pick(const ICamera& camera, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
+        return pick(camera.frustum(), camera.projection_mode(), position, direction);
+    }
+
+    PickResult Level::pick(const DirectX::BoundingFrustum& frustum, ProjectionMode projection_mode, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
+    {
+        std::lock_guard<std::mutex> lock(_pick_mutex);
         PickResult final_result;
         
         auto choose = [&](PickResult result)
@@ -432,7 +490,7 @@ namespace trview
             }
         };
 
-        auto rooms = get_rooms_to_render(camera);
+        auto rooms = get_rooms_to_render(frustum, projection_mode);
         for (auto& room : rooms)
         {
             choose(room.room.pick(position, direction, true, _show_triggers, _show_hidden_geometry));
@@ -459,14 +517,27 @@ namespace trview
 
     void Level::on_camera_moved()
     {
+        // Room geometry doesn't depend on the camera, so only sprites have to be made again before the sort.
+        invalidate_contained_transparency(true);
         _regenerate_transparency = true;
     }
 
+    void Level::invalidate_contained_transparency(bool camera_moved)
+    {
+        for (auto& room : _rooms)
+        {
+            room->invalidate_contained_transparency(camera_moved);
+        }
+    }
+
     // Set whether to render the alternate mode (the flipmap) or the regular room.
     // enabled: Whether to render the flipmap.
     void Level::set_alternate_mode(bool enabled)
     {
-        _alternate_mode = enabled;
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            _alternate_mode = enabled;
+        }
         _regenerate_transparency = true;
 
         // If the currently selected room is a room involved in flipmaps, select the alternate
@@ -483,13 +554,16 @@ namespace trview
     void Level::set_alternate_group(uint32_t group, bool enabled)
     {
         _regenerate_transparency = true;
-        if (enabled)
         {
-            _alternate_groups.insert(group);
-        }
-        else
-        {
-            _alternate_groups.erase(group);
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            if (enabled)
+            {
+                _alternate_groups.insert(group);
+            }
+            else
+            {
+                _alternate_groups.erase(group);
+            }
         }
 
         // If the currently selected room is a room involved in flipmaps, select the alternate
@@ -538,14 +612,20 @@ namespace trview
 
     void Level::set_show_triggers(bool show)
     {
-        _show_triggers = show;
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            _show_triggers = show;
+        }
         _regenerate_transparency = true;
         on_level_changed();
     }
 
     void Level::set_show_hidden_geometry(bool show)
     {
-        _show_hidden_geometry = show;
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            _show_hidden_geometry = show;
+        }
         on_level_changed();
     }
 
@@ -601,6 +681,60 @@ namespace trview
         return _version;
     }
 
+    const Pathfinder& Level::pathfinder() const
+    {
+        return *_pathfinder;
+    }
+
+    void Level::set_animate(bool animate)
+    {
+        if (_animate == animate)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            _animate = animate;
+            if (!animate)
+            {
+                for (auto& entity : _entities)
+                {
+                    entity->reset_pose();
+                }
+            }
+        }
+        invalidate_contained_transparency(false);
+        _selection_renderer->invalidate();
+        _regenerate_transparency = true;
+        on_level_changed();
+    }
+
+    bool Level::animate() const
+    {
+        return _animate;
+    }
+
+    void Level::update(float elapsed)
+    {
+        if (!_animate)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_pick_mutex);
+            for (auto& entity : _entities)
+            {
+                entity->update(elapsed);
+            }
+        }
+        invalidate_contained_transparency(false);
+        _selection_renderer->invalidate();
+        _regenerate_transparency = true;
+        on_level_changed();
+    }
+
     bool find_item_by_type_id(const Level& level, uint32_t type_id, Item& output_item)
     {
         const auto& items = level.items();
@@ -6,6 +6,7 @@
 #include <vector>
 #include <SimpleMath.h>
 #include <set>
+#include <mutex>
 
 #include <trview.graphics/Texture.h>
 #include <trview.common/Event.h>
@@ -19,6 +20,7 @@
 #include <trview.app/Elements/Trigger.h>
 
 #include <trview.app/Graphics/IMeshStorage.h>
+#include <trview.app/Camera/ProjectionMode.h>
 
 #include <trview.graphics/RenderTarget.h>
 
@@ -28,6 +30,9 @@ namespace trview
     struct ICamera;
     class SelectionRenderer;
     struct ITypeNameLookup;
+    class Pathfinder;
+    class PoseCache;
+    class CompressedTileCache;
 
     namespace graphics
     {
@@ -38,7 +43,7 @@ namespace trview
     class Level
     {
     public:
-        Level(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, std::unique_ptr<trlevel::ILevel>&& level, const ITypeNameLookup& type_names);
+        Level(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, std::unique_ptr<trlevel::ILevel>&& level, const ITypeNameLookup& type_names, const CompressedTileCache& tile_cache);
         ~Level();
 
         enum class RoomHighlightMode
@@ -74,6 +79,15 @@ namespace trview
         // is also specified.
         PickResult pick(const ICamera& camera, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const;
 
+        /// Determine whether the specified ray hits anything in the rooms that are visible in the frustum. This can
+        /// be called from a thread other than the one that changes the level view settings.
+        /// @param frustum The frustum of the camera that the ray was cast from.
+        /// @param projection_mode The projection mode of the camera that the ray was cast from.
+        /// @param position The world space position of the source of the ray.
+        /// @param direction The direction of the ray.
+        /// @returns The result of the operation.
+        PickResult pick(const DirectX::BoundingFrustum& frustum, ProjectionMode projection_mode, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const;
+
         /// Render the current scene.
         /// @param device The graphics device to use to render the scene.
         /// @param camera The current camera.
@@ -121,6 +135,10 @@ namespace trview
         // Get the current state of the alternate mode (flipmap).
         bool alternate_mode() const;
 
+        // Determines whether the alternate mode specified is a mismatch with the current setting of 
+        // the alternate mode flag.
+        bool is_alternate_mismatch(const Room& room) const;
+
         /// Determines if there are any flipmaps in the level.
         /// @returns True if there are flipmaps.
         bool any_alternates() const;
@@ -148,11 +166,29 @@ namespace trview
         Event<> on_level_changed;
 
         trlevel::LevelVersion version() const;
+
+        /// Gets the pathfinder for the boxes in the level.
+        const Pathfinder& pathfinder() const;
+
+        /// Set whether entities play their animations.
+        /// @param animate Whether to animate. When this is turned off entities go back to their original pose.
+        void set_animate(bool animate);
+
+        /// Gets whether entities play their animations.
+        bool animate() const;
+
+        /// Move the animations of the entities on, if animation is enabled.
+        /// @param elapsed The time since the last update, in seconds.
+        void update(float elapsed);
     private:
         void generate_rooms(const graphics::Device& device, const trlevel::ILevel& level);
         void generate_triggers();
         void generate_entities(const graphics::Device& device, const trlevel::ILevel& level, const ITypeNameLookup& type_names);
         void regenerate_neighbours();
+
+        /// Mark the cached transparent triangles of the entities in every room as out of date.
+        /// @param camera_moved True if only the camera has moved, so only sprites have changed.
+        void invalidate_contained_transparency(bool camera_moved);
         void generate_neighbours(std::set<uint16_t>& results, uint16_t selected_room, int32_t max_depth);
 
         // Render the rooms in the level.
@@ -177,15 +213,13 @@ namespace trview
         // Get the collection of rooms that need to be renderered depending on the current view mode.
         // Returns: The rooms to render and their selection mode.
         std::vector<RoomToRender> get_rooms_to_render(const ICamera& camera) const;
+        std::vector<RoomToRender> get_rooms_to_render(const DirectX::BoundingFrustum& frustum, ProjectionMode projection_mode) const;
 
         // Determines whether the room is currently being rendered.
         // room: The room index.
         // Returns: True if the room is visible.
         bool room_visible(uint32_t room) const;
 
-        // Determines whether the alternate mode specified is a mismatch with the current setting of 
-        // the alternate mode flag.
-        bool is_alternate_mismatch(const Room& room) const;
 
         bool is_alternate_group_set(uint16_t group) const;
 
@@ -209,16 +243,23 @@ namespace trview
         std::unique_ptr<ILevelTextureStorage> _texture_storage;
         std::unique_ptr<IMeshStorage> _mesh_storage;
         std::unique_ptr<TransparencyBuffer> _transparency;
+        std::unique_ptr<Pathfinder> _pathfinder;
+        std::unique_ptr<PoseCache> _pose_cache;
 
         bool _regenerate_transparency{ true };
         bool _alternate_mode{ false };
         bool _show_triggers{ true };
         bool _show_hidden_geometry{ false };
         bool _show_water{ true };
+        bool _animate{ false };
 
         std::unique_ptr<SelectionRenderer> _selection_renderer;
         std::set<uint32_t> _alternate_groups;
         trlevel::LevelVersion _version;
+
+        /// Held while picking and while changing the settings that picking depends on, as picking can
+        /// happen on another thread.
+        mutable std::mutex _pick_mutex;
     };
 
     /// Find the first item with the type id specified.
@@ -1,6 +1,7 @@
 #include "Room.h"
 #include <trview.app/Geometry/MeshVertex.h>
 #include "Entity.h"
+#include "TriggerWalls.h"
 #include <trview.app/Elements/Level.h>
 
 #include <trview.app/Graphics/ILevelTextureStorage.h>
@@ -23,6 +24,7 @@ namespace trview
     namespace
     {
         const Color Trigger_Colour{ 1, 0, 1, 0.5f };
+
         const Color Unmatched_Colour{ 0, 0.75f, 0.75f };
 
         const Color Selected_Colour{ 1, 1, 1 };
@@ -45,9 +47,9 @@ namespace trview
         }
     }
 
-    Room::Room(const graphics::Device& device, 
-        const trlevel::ILevel& level, 
+    Room::Room(const trlevel::ILevel& level, 
         const trlevel::tr3_room& room,
+        const std::vector<uint16_t>& floor_data,
         const ILevelTextureStorage& texture_storage,
         const IMeshStorage& mesh_storage,
         uint32_t index,
@@ -67,12 +69,25 @@ namespace trview
         _alternate_mode = room.alternate_room != -1 ? AlternateMode::HasAlternate : AlternateMode::None;
 
         _room_offset = Matrix::CreateTranslation(room.info.x / trlevel::Scale_X, 0, room.info.z / trlevel::Scale_Z);
-        generate_sectors(level, room);
-        generate_geometry(level.get_version(), device, room, texture_storage);
+        generate_sectors(level, room, floor_data);
+        generate_geometry(level.get_version(), room, texture_storage);
         generate_adjacency();
         generate_static_meshes(level, room, mesh_storage);
     }
 
+    void Room::generate_meshes(const graphics::Device& device)
+    {
+        if (!_geometry_data)
+        {
+            return;
+        }
+
+        const auto& data = *_geometry_data;
+        _mesh = std::make_unique<Mesh>(device, data.vertices, data.indices, std::vector<uint32_t>{}, data.transparent_triangles, data.collision_triangles);
+        _unmatched_mesh = std::make_unique<Mesh>(device, data.unmatched_vertices, std::vector<std::vector<uint32_t>>{}, data.unmatched_indices, std::vector<TransparentTriangle>{}, data.unmatched_collision_triangles);
+        _geometry_data.reset();
+    }
+
     RoomInfo Room::info() const
     {
         return _info;
@@ -237,32 +252,24 @@ namespace trview
         }
     }
 
-    void Room::generate_geometry(trlevel::LevelVersion level_version, const graphics::Device& device, const trlevel::tr3_room& room, const ILevelTextureStorage& texture_storage)
+    void Room::generate_geometry(trlevel::LevelVersion level_version, const trlevel::tr3_room& room, const ILevelTextureStorage& texture_storage)
     {
         std::vector<trlevel::tr_vertex> room_vertices;
         std::transform(room.data.vertices.begin(), room.data.vertices.end(), std::back_inserter(room_vertices),
             [](const auto& v) { return v.vertex; });
 
-        std::vector<MeshVertex> vertices;
-        std::vector<TransparentTriangle> transparent_triangles;
+        _geometry_data = std::make_unique<GeometryData>();
+        auto& data = *_geometry_data;
 
         // The indices are grouped by the number of textiles so that it can be drawn as the selected texture.
-        std::vector<std::vector<uint32_t>> indices(texture_storage.num_tiles());
-        
-        std::vector<Triangle> collision_triangles;
+        data.indices.resize(texture_storage.num_tiles());
 
-        process_textured_rectangles(level_version, room.data.rectangles, room_vertices, texture_storage, vertices, indices, transparent_triangles, collision_triangles, false);
-        process_textured_triangles(level_version, room.data.triangles, room_vertices, texture_storage, vertices, indices, transparent_triangles, collision_triangles, false);
-        process_collision_transparency(transparent_triangles, collision_triangles);
+        process_textured_rectangles(level_version, room.data.rectangles, room_vertices, texture_storage, data.vertices, data.indices, data.transparent_triangles, data.collision_triangles, false);
+        process_textured_triangles(level_version, room.data.triangles, room_vertices, texture_storage, data.vertices, data.indices, data.transparent_triangles, data.collision_triangles, false);
+        process_collision_transparency(data.transparent_triangles, data.collision_triangles);
 
-        _mesh = std::make_unique<Mesh>(device, vertices, indices, std::vector<uint32_t>{}, transparent_triangles, collision_triangles);
-
-        // Make the unmatched mesh.
-        collision_triangles.clear();
-        vertices.clear();
-        std::vector<uint32_t> untextured_indices;
-        process_unmatched_geometry(room.data, room_vertices, transparent_triangles, vertices, untextured_indices, collision_triangles);
-        _unmatched_mesh = std::make_unique<Mesh>(device, vertices, std::vector<std::vector<uint32_t>>{}, untextured_indices, std::vector<TransparentTriangle>{}, collision_triangles);
+        // Generate the unmatched geometry.
+        process_unmatched_geometry(room.data, room_vertices, data.transparent_triangles, data.unmatched_vertices, data.unmatched_indices, data.unmatched_collision_triangles);
 
         // Generate the bounding box based on the room dimensions.
         update_bounding_box();
@@ -283,6 +290,7 @@ namespace trview
     void Room::add_entity(Entity* entity)
     {
         _entities.push_back(entity);
+        _transparent_contained.valid = false;
     }
 
     void Room::add_trigger(Trigger* trigger)
@@ -291,12 +299,12 @@ namespace trview
     }
 
     void 
-    Room::generate_sectors(const trlevel::ILevel& level, const trlevel::tr3_room& room)
+    Room::generate_sectors(const trlevel::ILevel& level, const trlevel::tr3_room& room, const std::vector<uint16_t>& floor_data)
     {
         for (auto i = 0u; i < room.sector_list.size(); ++i)
         {
             const trlevel::tr_room_sector &sector = room.sector_list[i];
-            _sectors.push_back(std::make_shared<Sector>(level, room, sector, i, _index));
+            _sectors.push_back(std::make_shared<Sector>(level, room, sector, floor_data, i, _index));
         }
     }
 
@@ -304,25 +312,28 @@ namespace trview
     {
         Color colour = room_colour(_water && show_water, selected);
 
-        for (const auto& triangle : _mesh->transparent_triangles())
+        if (!_transparent_geometry.valid)
         {
-            transparency.add(triangle.transform(_room_offset, colour));
-        }
+            auto& triangles = _transparent_geometry.triangles;
+            for (const auto& triangle : _mesh->transparent_triangles())
+            {
+                triangles.push_back(triangle.transform(_room_offset, colour));
+            }
 
-        for (const auto& static_mesh : _static_meshes)
-        {
-            static_mesh->get_transparent_triangles(transparency, colour);
+            for (const auto& static_mesh : _static_meshes)
+            {
+                static_mesh->get_transparent_triangles(triangles, colour);
+            }
+
+            _transparent_geometry.colour = colour;
+            _transparent_geometry.valid = true;
         }
+        add_transparent_geometry(transparency, _transparent_geometry, colour);
 
         if (include_triggers)
         {
-            for (const auto& trigger : _triggers)
-            {
-                for (const auto& triangle : trigger.second->triangles())
-                {
-                    transparency.add(triangle);
-                }
-            }
+            // Triggers keep their own colour whatever the room is highlighted as.
+            transparency.add(_trigger_geometry.triangles);
         }
 
         get_contained_transparent_triangles(transparency, camera, colour);
@@ -336,10 +347,41 @@ namespace trview
 
     void Room::get_contained_transparent_triangles(TransparencyBuffer& transparency, const ICamera& camera, const Color& colour)
     {
-        for (const auto& entity : _entities)
+        if (!_transparent_contained.valid)
+        {
+            _transparent_contained.triangles.clear();
+            _contained_faces_camera = false;
+            for (const auto& entity : _entities)
+            {
+                entity->get_transparent_triangles(_transparent_contained.triangles, camera, colour);
+                _contained_faces_camera |= entity->faces_camera();
+            }
+
+            _transparent_contained.colour = colour;
+            _transparent_contained.valid = true;
+        }
+        add_transparent_geometry(transparency, _transparent_contained, colour);
+    }
+
+    void Room::invalidate_contained_transparency(bool camera_moved)
+    {
+        if (!camera_moved || _contained_faces_camera)
         {
-            entity->get_transparent_triangles(transparency, camera, colour);
+            _transparent_contained.valid = false;
+        }
+    }
+
+    void Room::add_transparent_geometry(TransparencyBuffer& transparency, TransparentGeometry& geometry, const Color& colour)
+    {
+        if (geometry.colour != colour)
+        {
+            for (auto& triangle : geometry.triangles)
+            {
+                triangle.colour = colour;
+            }
+            geometry.colour = colour;
         }
+        transparency.add(geometry.triangles);
     }
 
     // Determines the alternate state of the room.
@@ -384,51 +426,58 @@ namespace trview
 
     void Room::generate_trigger_geometry()
     {
-        for (auto& trigger_iter : _triggers)
+        // The trigger in each sector of the room, if it has one.
+        std::vector<Trigger*> grid(_sectors.size(), nullptr);
+        for (const auto& trigger : _triggers)
         {
-            // Information about sector height.
-            auto trigger = trigger_iter.second;
-            auto sector = _sectors[trigger->sector_id()];
-            auto y_bottom = sector->corners();
-
-            // Figure out if we should make the walls based on adjacent triggers.
-            bool pos_x = true, neg_x = true, pos_z = true, neg_z = true;
-
-            if (auto other = get_trigger_sector(trigger->x() + 1, trigger->z()))
+            if (trigger.first < grid.size())
             {
-                auto corners = other->corners();
-                if (y_bottom[3] == corners[1] && y_bottom[2] == corners[0])
-                {
-                    pos_x = false;
-                }
+                grid[trigger.first] = trigger.second;
             }
+        }
 
-            if (auto other = get_trigger_sector(static_cast<int32_t>(trigger->x()) - 1, trigger->z()))
+        // Work out which walls each trigger needs. A sector that is a portal stands in for the sector on the
+        // other side of it.
+        std::vector<TriggerFloor> floors(_sectors.size());
+        if (!_triggers.empty())
+        {
+            for (uint32_t id = 0; id < floors.size(); ++id)
             {
-                auto corners = other->corners();
-                if (y_bottom[1] == corners[3] && y_bottom[0] == corners[2])
+                const Sector* sector = grid[id] ? _sectors[id].get() : portal_trigger_sector(id);
+                if (sector)
                 {
-                    neg_x = false;
+                    floors[id] = { grid[id] != nullptr, true, sector->corners() };
                 }
             }
+        }
+        const auto walls = trigger_walls(_num_x_sectors, _num_z_sectors, floors);
 
-            if (auto other = get_trigger_sector(trigger->x(), static_cast<int32_t>(trigger->z()) - 1))
+        // Build the overlays of every trigger into one list, remembering the range that each trigger has.
+        _trigger_geometry = TriggerGeometry();
+        auto& triangles = _trigger_geometry.triangles;
+        triangles.reserve(_triggers.size() * 10);
+
+        struct Range
+        {
+            Trigger* trigger;
+            uint32_t first;
+            uint32_t count;
+        };
+        std::vector<Range> ranges;
+        ranges.reserve(_triggers.size());
+
+        for (uint32_t id = 0; id < grid.size(); ++id)
+        {
+            auto trigger = grid[id];
+            if (!trigger)
             {
-                auto corners = other->corners();
-                if (y_bottom[2] == corners[3] && y_bottom[0] == corners[1])
-                {
-                    neg_z = false;
-                }
+                continue;
             }
 
-           if (auto other = get_trigger_sector(trigger->x(), trigger->z() + 1))
-           {
-                auto corners = other->corners();
-                if (y_bottom[3] == corners[2] && y_bottom[1] == corners[0])
-                {
-                    pos_z = false;
-                }
-            }
+            // Information about sector height.
+            const auto y_bottom = _sectors[id]->corners();
+            const uint8_t sector_walls = walls[id];
+            const uint32_t first = static_cast<uint32_t>(triangles.size());
 
             // Calculate the X/Z position.
             const float x = _info.x / trlevel::Scale_X + trigger->x() + 0.5f;
@@ -441,46 +490,60 @@ namespace trview
                 y_top[i] = y_bottom[i] - height;
             }
 
-            std::vector<TransparentTriangle> triangles;
-
             // + Y
             triangles.push_back(TransparentTriangle(Vector3(x + 0.5f, y_top[3], z + 0.5f), Vector3(x + 0.5f, y_top[2], z - 0.5f), Vector3(x - 0.5f, y_top[0], z - 0.5f), Trigger_Colour));
             triangles.push_back(TransparentTriangle(Vector3(x - 0.5f, y_top[0], z - 0.5f), Vector3(x - 0.5f, y_top[1], z + 0.5f), Vector3(x + 0.5f, y_top[3], z + 0.5f), Trigger_Colour));
 
-            if (pos_x)
+            if (sector_walls & Trigger_Wall_Pos_X)
             {
                 // + X
                 triangles.push_back(TransparentTriangle(Vector3(x + 0.5f, y_top[2], z - 0.5f), Vector3(x + 0.5f, y_top[3], z + 0.5f), Vector3(x + 0.5f, y_bottom[3], z + 0.5f), Trigger_Colour));
                 triangles.push_back(TransparentTriangle(Vector3(x + 0.5f, y_top[2], z - 0.5f), Vector3(x + 0.5f, y_bottom[3], z + 0.5f), Vector3(x + 0.5f, y_bottom[2], z - 0.5f), Trigger_Colour));
             }
 
-            if (neg_x)
+            if (sector_walls & Trigger_Wall_Neg_X)
             {
                 // - X
                 triangles.push_back(TransparentTriangle(Vector3(x - 0.5f, y_top[1], z + 0.5f), Vector3(x - 0.5f, y_top[0], z - 0.5f), Vector3(x - 0.5f, y_bottom[0], z - 0.5f), Trigger_Colour));
                 triangles.push_back(TransparentTriangle(Vector3(x - 0.5f, y_top[1], z + 0.5f), Vector3(x - 0.5f, y_bottom[0], z - 0.5f), Vector3(x - 0.5f, y_bottom[1], z + 0.5f), Trigger_Colour));
             }
 
-            if (pos_z)
+            if (sector_walls & Trigger_Wall_Pos_Z)
             {
                 // + Z
                 triangles.push_back(TransparentTriangle(Vector3(x + 0.5f, y_top[3], z + 0.5f), Vector3(x - 0.5f, y_top[1], z + 0.5f), Vector3(x - 0.5f, y_bottom[1], z + 0.5f), Trigger_Colour));
                 triangles.push_back(TransparentTriangle(Vector3(x + 0.5f, y_top[3], z + 0.5f), Vector3(x - 0.5f, y_bottom[1], z + 0.5f), Vector3(x + 0.5f, y_bottom[3], z + 0.5f), Trigger_Colour));
             }
 
-            if (neg_z)
+            if (sector_walls & Trigger_Wall_Neg_Z)
             {
                 // - Z
                 triangles.push_back(TransparentTriangle(Vector3(x - 0.5f, y_top[0], z - 0.5f), Vector3(x + 0.5f, y_top[2], z - 0.5f), Vector3(x + 0.5f, y_bottom[2], z - 0.5f), Trigger_Colour));
                 triangles.push_back(TransparentTriangle(Vector3(x - 0.5f, y_top[0], z - 0.5f), Vector3(x + 0.5f, y_bottom[2], z - 0.5f), Vector3(x - 0.5f, y_bottom[0], z - 0.5f), Trigger_Colour));
             }
 
-            trigger->set_triangles(triangles);
+            ranges.push_back({ trigger, first, static_cast<uint32_t>(triangles.size()) - first });
 
             float centre_y = std::accumulate(y_top.begin(), y_top.end(), std::accumulate(y_bottom.begin(), y_bottom.end(), 0.0f)) / 8.0f;
-
             trigger->set_position(Vector3(x, centre_y, z));
         }
+
+        auto& collision = _trigger_geometry.collision;
+        collision.reserve(triangles.size());
+        std::transform(triangles.begin(), triangles.end(), std::back_inserter(collision),
+            [](const auto& tri) { return Triangle(tri.vertices[0], tri.vertices[1], tri.vertices[2]); });
+
+        // The lists are complete, so the triggers can now refer to them. Every trigger is cleared first so
+        // that one that is no longer in the grid doesn't keep a range of the old lists.
+        for (const auto& trigger : _triggers)
+        {
+            trigger.second->set_geometry(_trigger_geometry, 0, 0);
+        }
+
+        for (const auto& range : ranges)
+        {
+            range.trigger->set_geometry(_trigger_geometry, range.first, range.count);
+        }
     }
 
     uint32_t Room::get_sector_id(int32_t x, int32_t z) const
@@ -488,41 +551,32 @@ namespace trview
         return x * _num_z_sectors + z;
     }
 
-    Sector* Room::get_trigger_sector(int32_t x, int32_t z)
+    const Sector* Room::portal_trigger_sector(uint32_t sector_id) const
     {
-        auto sector_id = get_sector_id(x, z);
-        auto trigger = _triggers.find(sector_id);
-        if (trigger != _triggers.end())
-        {
-            return _sectors[sector_id].get();
-        }
-
-        // Check if this sector is a portal.
-        auto sector = _sectors[sector_id];
+        const auto& sector = _sectors[sector_id];
         if (!(sector->flags & SectorFlag::Portal))
         {
             return nullptr;
         }
 
-        auto room_number = sector->portal();
-        auto room = _level.room(room_number);
-
-        // Get the world position of the target sector.
-        auto world_x = (_info.x / trlevel::Scale_X) + x;
-        auto world_z = (_info.z / trlevel::Scale_Z) + z;
-
-        // Convert the world position into the space of the other room.
-        auto other_x = static_cast<int32_t>(world_x - (room->_info.x / trlevel::Scale_X));
-        auto other_z = static_cast<int32_t>(world_z - (room->_info.z / trlevel::Scale_Z));
+        const auto room = _level.room(sector->portal());
 
-        auto other_sector_id = room->get_sector_id(other_x, other_z);
-        auto other_trigger = room->_triggers.find(other_sector_id);
-        if (other_trigger != room->_triggers.end())
+        // Get the world position of the sector and convert it into the space of the other room.
+        const int32_t x = static_cast<int32_t>(sector_id / _num_z_sectors);
+        const int32_t z = static_cast<int32_t>(sector_id % _num_z_sectors);
+        const auto other_x = static_cast<int32_t>((_info.x / trlevel::Scale_X) + x - (room->_info.x / trlevel::Scale_X));
+        const auto other_z = static_cast<int32_t>((_info.z / trlevel::Scale_Z) + z - (room->_info.z / trlevel::Scale_Z));
+        if (other_x < 0 || other_x >= room->_num_x_sectors || other_z < 0 || other_z >= room->_num_z_sectors)
         {
-            return room->_sectors[other_sector_id].get();
+            return nullptr;
         }
 
-        return nullptr;
+        const auto other_sector_id = room->get_sector_id(other_x, other_z);
+        if (room->_triggers.find(other_sector_id) == room->_triggers.end())
+        {
+            return nullptr;
+        }
+        return room->_sectors[other_sector_id].get();
     }
 
     namespace
@@ -19,6 +19,7 @@
 #include <trview.app/Geometry/TransparencyBuffer.h>
 #include <trview.app/Geometry/Mesh.h>
 #include <trview.app/Elements/Sector.h>
+#include <trview.app/Elements/Trigger.h>
 #include <trview.app/Geometry/PickResult.h>
 
 namespace trview
@@ -50,9 +51,12 @@ namespace trview
             IsAlternate
         };
 
-        explicit Room(const graphics::Device& device, 
-            const trlevel::ILevel& level, 
+        /// Create a new room. This generates the sectors and the geometry for the room but does not
+        /// create any D3D resources, so rooms can be created on worker threads. generate_meshes must
+        /// be called before the room is rendered or picked.
+        explicit Room(const trlevel::ILevel& level, 
             const trlevel::tr3_room& room,
+            const std::vector<uint16_t>& floor_data,
             const ILevelTextureStorage& texture_storage,
             const IMeshStorage& mesh_storage,
             uint32_t index,
@@ -61,6 +65,10 @@ namespace trview
         Room(const Room&) = delete;
         Room& operator=(const Room&) = delete;
 
+        /// Create the meshes for the geometry generated when the room was created.
+        /// @param device The device to use to create the meshes.
+        void generate_meshes(const graphics::Device& device);
+
         RoomInfo           info() const;
         std::set<uint16_t> neighbours() const;
 
@@ -105,6 +113,12 @@ namespace trview
         // selected: The current selection mode.
         void get_contained_transparent_triangles(TransparencyBuffer& transparency, const ICamera& camera, SelectionMode selected, bool show_water, bool force_water = false);
 
+        /// Mark the transparent triangles of the entities in the room as out of date, so that they are made again
+        /// the next time they are added to a transparency buffer. The room geometry and triggers don't change, so
+        /// their triangles are only made once.
+        /// @param camera_moved True if only the camera has moved, so only sprites that face the camera have changed.
+        void invalidate_contained_transparency(bool camera_moved);
+
         // Determines the alternate state of the room.
         AlternateMode alternate_mode() const;
 
@@ -136,6 +150,8 @@ namespace trview
         /// @returns The bounding box for the room.
         const DirectX::BoundingBox& bounding_box() const;
 
+        /// Make the overlays for the triggers in the room. The overlays of all triggers are kept in one list and
+        /// each trigger is given its range of the list. The triggers of the rooms next to this one must have been added.
         void generate_trigger_geometry();
 
         uint32_t number() const;
@@ -144,13 +160,31 @@ namespace trview
         /// Gets whether this room is a water room.
         bool water() const;
     private:
-        void generate_geometry(trlevel::LevelVersion level_version, const graphics::Device& device, const trlevel::tr3_room& room, const ILevelTextureStorage& texture_storage);
+        void generate_geometry(trlevel::LevelVersion level_version, const trlevel::tr3_room& room, const ILevelTextureStorage& texture_storage);
         void generate_adjacency();
         void generate_static_meshes(const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage);
         void render_contained(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, const DirectX::SimpleMath::Color& colour);
         void get_contained_transparent_triangles(TransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour);
-        void generate_sectors(const trlevel::ILevel& level, const trlevel::tr3_room& room);
-        Sector*  get_trigger_sector(int32_t x, int32_t z);
+
+        /// Transparent triangles for one part of the room, in world space, kept between fills of the transparency
+        /// buffer so that changing a view option only has to change their colour.
+        struct TransparentGeometry
+        {
+            std::vector<TransparentTriangle> triangles;
+            DirectX::SimpleMath::Color       colour;
+            bool                             valid{ false };
+        };
+
+        /// Add cached transparent triangles to a transparency buffer, changing their colour first if it has changed.
+        /// @param transparency The buffer to add triangles to.
+        /// @param geometry The cached triangles.
+        /// @param colour The colour that the triangles should be.
+        static void add_transparent_geometry(TransparencyBuffer& transparency, TransparentGeometry& geometry, const DirectX::SimpleMath::Color& colour);
+        void generate_sectors(const trlevel::ILevel& level, const trlevel::tr3_room& room, const std::vector<uint16_t>& floor_data);
+        /// Find the sector on the other side of a portal sector, if it has a trigger.
+        /// @param sector_id The portal sector in this room.
+        /// @returns The sector in the other room, or nullptr if the sector is not a portal or there is no trigger.
+        const Sector* portal_trigger_sector(uint32_t sector_id) const;
         uint32_t get_sector_id(int32_t x, int32_t z) const;
 
         /// Find any transparent triangles that match floor data geometry.
@@ -177,6 +211,19 @@ namespace trview
 
         std::vector<std::unique_ptr<StaticMesh>> _static_meshes;
 
+        /// Geometry generated by the constructor that is waiting for generate_meshes.
+        struct GeometryData
+        {
+            std::vector<MeshVertex>            vertices;
+            std::vector<std::vector<uint32_t>> indices;
+            std::vector<TransparentTriangle>   transparent_triangles;
+            std::vector<Triangle>              collision_triangles;
+            std::vector<MeshVertex>            unmatched_vertices;
+            std::vector<uint32_t>              unmatched_indices;
+            std::vector<Triangle>              unmatched_collision_triangles;
+        };
+
+        std::unique_ptr<GeometryData> _geometry_data;
         std::unique_ptr<Mesh>       _mesh;
         std::unique_ptr<Mesh>       _unmatched_mesh;
         DirectX::SimpleMath::Matrix _room_offset;
@@ -196,6 +243,11 @@ namespace trview
         AlternateMode        _alternate_mode;
 
         std::unordered_map<uint32_t, Trigger*> _triggers;
+        TriggerGeometry                        _trigger_geometry;
+
+        TransparentGeometry _transparent_geometry;          // Room geometry and static meshes.
+        TransparentGeometry _transparent_contained;         // Entities in the room.
+        bool                _contained_faces_camera{ false };
         bool _water{ false };
         Level& _level;
     };
@@ -1,23 +1,16 @@
 #define NOMINMAX
 #include "Sector.h"
+#include <trlevel/FloorData.h>
 
 namespace trview
 {
-    Sector::Sector(const trlevel::ILevel &level, const trlevel::tr3_room& room, const trlevel::tr_room_sector &sector, int sector_id, uint32_t room_number)
+    Sector::Sector(const trlevel::ILevel &level, const trlevel::tr3_room& room, const trlevel::tr_room_sector &sector, const std::vector<uint16_t>& floor_data, int sector_id, uint32_t room_number)
         : _sector(sector), _sector_id(static_cast<uint16_t>(sector_id)), _room_above(sector.room_above), _room_below(sector.room_below), _room(room_number)
     {
         _x = static_cast<uint16_t>(sector_id / room.num_z_sectors);
         _z = static_cast<uint16_t>(sector_id % room.num_z_sectors);
-		try
-		{
-			parse(level);
-			calculate_neighbours(level);
-		}
-		catch (...)
-		{
-			throw "floordata";
-		}
-        /*calculate_neighbours(level);*/
+        parse(level, floor_data);
+        calculate_neighbours(level);
     }
 
     std::uint16_t
@@ -35,8 +28,7 @@ namespace trview
         return _neighbours;
     }
 
-    bool
-    Sector::parse(const trlevel::ILevel& level)
+    void Sector::parse(const trlevel::ILevel& level, const std::vector<uint16_t>& floor_data)
     {
         // Basic sector items 
         if (_sector.floor == -127 && _sector.ceiling == -127)
@@ -52,166 +44,94 @@ namespace trview
             level.get_room(_room).info.yBottom / trlevel::Scale_Y :
             _sector.floor * 0.25f);
 
-        std::uint16_t cur_index = _sector.floordata_index;
-        if (cur_index == 0x0)
-            return true; 
+        const auto data = trlevel::parse_floordata(floor_data, _sector.floordata_index, level.is_trng());
 
-        const auto max_floordata = level.num_floor_data();
+        if (data.has_portal)
+        {
+            _portal = data.portal;
+            flags |= SectorFlag::Portal;
+        }
 
-        for (;;)
+        if (data.has_floor_slant)
         {
-            std::uint16_t floor = level.get_floor_data(cur_index);
-            std::uint16_t subfunction = (floor & 0x7F00) >> 8; 
+            _floor_slant = data.floor_slant;
+            flags |= SectorFlag::FloorSlant;
+            parse_slope();
+        }
 
-            switch (floor & 0x1f)
-            {
-            case 0x1:
-                _portal = level.get_floor_data(++cur_index) & 0xFF;
-                flags |= SectorFlag::Portal;
-                break; 
+        if (data.has_ceiling_slant)
+        {
+            _ceiling_slant = data.ceiling_slant;
+            flags |= SectorFlag::CeilingSlant;
+        }
 
-            case 0x2: 
+        if (data.has_trigger)
+        {
+            _trigger.timer = data.trigger.timer;
+            _trigger.oneshot = data.trigger.oneshot;
+            _trigger.mask = data.trigger.mask;
+            _trigger.sector_id = _sector_id;
+
+            // Type of the trigger, e.g. Pad, Switch, etc.
+            _trigger.type = static_cast<TriggerType>(data.trigger.type);
+            for (const auto& command : data.trigger.commands)
             {
-                _floor_slant = level.get_floor_data(++cur_index);
-                flags |= SectorFlag::FloorSlant;
-                parse_slope();
-                break;
+                _trigger.commands.emplace_back(static_cast<TriggerCommandType>(command.type), command.index);
             }
-            case 0x3:
-                _ceiling_slant = level.get_floor_data(++cur_index);
-                flags |= SectorFlag::CeilingSlant;
-                break;
+            flags |= SectorFlag::Trigger;
+        }
 
-            case 0x4:
-            {
-                std::uint16_t command = 0; 
-                std::uint16_t setup = level.get_floor_data(++cur_index);
-
-                // Basic trigger setup 
-                _trigger.timer = setup & 0xFF;
-                _trigger.oneshot = (setup & 0x100) >> 8; 
-                _trigger.mask = (setup & 0x3E00) >> 9; 
-                _trigger.sector_id = _sector_id;
-
-                // Type of the trigger, e.g. Pad, Switch, etc.
-                _trigger.type = (TriggerType) subfunction;
-
-                if (_trigger.type == TriggerType::Key || _trigger.type == TriggerType::Switch)
-                {
-                    // The next element is the lock or switch - ignore.
-                    ++cur_index;
-                }
-
-                // Parse actions 
-                do
-                {
-                    if (++cur_index < max_floordata)
-                    {
-                        command = level.get_floor_data(cur_index);
-                        auto action = static_cast<TriggerCommandType>((command & 0x7C00) >> 10);
-                        _trigger.commands.emplace_back(action, static_cast<uint16_t>(command & 0x3FF));
-                        if (action == TriggerCommandType::Camera)
-                        {
-                            // Camera has another uint16_t - skip for now.
-                            command = level.get_floor_data(++cur_index);
-                        }
-						if (action == TriggerCommandType::Flyby)
-						{
-							// Flyby has another uint16_t Except those in title.tr4 of TRLE???
-							command = level.get_floor_data(++cur_index);
-						}
-						if (level.is_trng())
-						{
-							if (action == TriggerCommandType::ClearBodies)//trng action trigger has additional uint16_t
-							{
-								command = level.get_floor_data(++cur_index);
-							}
-							if (action == TriggerCommandType::Flipeffect)//trng flipeffects have additional uint16_t
-							{
-								command = level.get_floor_data(++cur_index);
-							}
-						}
-                    }
-
-                } while (cur_index < max_floordata && !(command & 0x8000));
-
-                flags |= SectorFlag::Trigger; 
-                break; 
-            }
-            case 0x5: 
-                flags |= SectorFlag::Death; 
-                break; 
-
-            case 0x6: // climbable walls 
-                flags |= (subfunction << 6); 
-                break; 
-
-            case 0x7:
-            case 0xB:
-            case 0xC:
-            case 0x8:
-            case 0xD:
-            case 0xE:
-            {
-                // Not sure what to do with h1 and h2 values yet.
-                const int16_t h2 = (floor & 0x7C00) >> 10;
-                const int16_t h1 = (floor & 0x03E0) >> 5;
-                const int16_t function = (floor & 0x001F);
-
-                switch (function)
-                {
-                case 0x07:
-                case 0x0B:
-                case 0x0C:
-                    _triangulation_function = TriangulationDirection::NwSe;
-                    break;
-                case 0x08:
-                case 0x0D:
-                case 0x0E:
-                    _triangulation_function = TriangulationDirection::NeSw;
-                    break;
-                }
-
-                const uint16_t corner_values = level.get_floor_data(++cur_index);
-                const uint16_t c00 = (corner_values & 0x00F0) >> 4;
-                const uint16_t c01 = (corner_values & 0x0F00) >> 8;
-                const uint16_t c10 = (corner_values & 0x000F);
-                const uint16_t c11 = (corner_values & 0xF000) >> 12;
-                const auto max_corner = std::max({ c00, c01, c10, c11 });
-
-                _corners[0] += (max_corner - c00) * 0.25f;
-                _corners[1] += (max_corner - c01) * 0.25f;
-                _corners[2] += (max_corner - c10) * 0.25f;
-                _corners[3] += (max_corner - c11) * 0.25f;
+        if (data.death)
+        {
+            flags |= SectorFlag::Death;
+        }
+
+        // Climbable walls 
+        flags |= (data.climbable << 6);
+
+        if (data.monkey_swing)
+        {
+            flags |= SectorFlag::MonkeySwing;
+        }
+
+        if (data.minecart_left)
+        {
+            flags |= SectorFlag::MinecartLeft;
+        }
+
+        if (data.minecart_right)
+        {
+            flags |= SectorFlag::MinecartRight;
+        }
+
+        switch (data.floor_triangulation)
+        {
+            case 0x07:
+            case 0x0B:
+            case 0x0C:
+                _triangulation_function = TriangulationDirection::NwSe;
                 break;
-            }
-            case 0x9:
-            case 0xA:
-            case 0xF:
-            case 0x10:
-            case 0x11:
-            case 0x12:
-            {
-                // Ceiling triangulation.
-                level.get_floor_data(++cur_index);
+            case 0x08:
+            case 0x0D:
+            case 0x0E:
+                _triangulation_function = TriangulationDirection::NeSw;
                 break;
-            }
-            case 0x13: 
-                flags |= SectorFlag::MonkeySwing;
-                break; 
-            case 0x14:
-                flags |= SectorFlag::MinecartLeft;
-                break; 
-            case 0x15:
-                flags |= SectorFlag::MinecartRight; 
-                break; 
-            }
-
-            if ((floor >> 15) || cur_index == 0x0) break; 
-            else cur_index++; 
         }
 
-        return true; 
+        if (data.floor_triangulation)
+        {
+            const uint16_t corner_values = data.floor_triangulation_corners;
+            const uint16_t c00 = (corner_values & 0x00F0) >> 4;
+            const uint16_t c01 = (corner_values & 0x0F00) >> 8;
+            const uint16_t c10 = (corner_values & 0x000F);
+            const uint16_t c11 = (corner_values & 0xF000) >> 12;
+            const auto max_corner = std::max({ c00, c01, c10, c11 });
+
+            _corners[0] += (max_corner - c00) * 0.25f;
+            _corners[1] += (max_corner - c01) * 0.25f;
+            _corners[2] += (max_corner - c10) * 0.25f;
+            _corners[3] += (max_corner - c11) * 0.25f;
+        }
     }
 
     const TriggerInfo& Sector::trigger() const
@@ -303,6 +223,11 @@ namespace trview
     {
         const auto add_neighbour = [&](std::uint16_t room)
         {
+            if (room >= level.num_rooms())
+            {
+                throw trlevel::FloorDataException();
+            }
+
             const auto &r = level.get_room(room);
             if (r.alternate_room != -1)
             {
@@ -23,8 +23,15 @@ namespace trview
     class Sector
     {
     public:
-        // Constructs sector object and parses floor data automatically 
-        Sector(const trlevel::ILevel &level, const trlevel::tr3_room& room, const trlevel::tr_room_sector &sector, int sector_id, uint32_t room_number);
+        /// Constructs sector object and parses floor data automatically.
+        /// @param level The level that contains the sector.
+        /// @param room The room that contains the sector.
+        /// @param sector The sector data.
+        /// @param floor_data The floordata for the level.
+        /// @param sector_id The index of the sector in the room.
+        /// @param room_number The room number.
+        /// @throws trlevel::FloorDataException if the floordata for the sector is malformed.
+        Sector(const trlevel::ILevel &level, const trlevel::tr3_room& room, const trlevel::tr_room_sector &sector, const std::vector<uint16_t>& floor_data, int sector_id, uint32_t room_number);
 
         // Returns the id of the room that this floor data points to 
         std::uint16_t portal() const; 
@@ -62,7 +69,7 @@ namespace trview
         /// Determines whether this is a walkable floor.
         bool is_floor() const;
     private:
-        bool parse(const trlevel::ILevel& level);
+        void parse(const trlevel::ILevel& level, const std::vector<uint16_t>& floor_data);
         void parse_slope();
         void calculate_neighbours(const trlevel::ILevel& level);
 
@@ -1,6 +1,5 @@
 #include "StaticMesh.h"
 #include <trview.app/Geometry/Mesh.h>
-#include <trview.app/Geometry/TransparencyBuffer.h>
 
 namespace trview
 {
@@ -22,11 +21,11 @@ namespace trview
         _mesh->render(context, _world * view_projection, texture_storage, colour);
     }
 
-    void StaticMesh::get_transparent_triangles(TransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour)
+    void StaticMesh::get_transparent_triangles(std::vector<TransparentTriangle>& triangles, const DirectX::SimpleMath::Color& colour) const
     {
         for (const auto& triangle : _mesh->transparent_triangles())
         {
-            transparency.add(triangle.transform(_world, colour));
+            triangles.push_back(triangle.transform(_world, colour));
         }
     }
 }
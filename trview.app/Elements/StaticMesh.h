@@ -5,13 +5,14 @@
 #include <d3d11.h>
 #include <wrl/client.h>
 #include <cstdint>
+#include <vector>
 #include <SimpleMath.h>
+#include <trview.app/Geometry/TransparentTriangle.h>
 
 namespace trview
 {
     struct ILevelTextureStorage;
     class Mesh;
-    class TransparencyBuffer;
 
     class StaticMesh
     {
@@ -20,7 +21,10 @@ namespace trview
 
         void render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const DirectX::SimpleMath::Matrix& view_projection, const ILevelTextureStorage& texture_storage, const DirectX::SimpleMath::Color& colour);
 
-        void get_transparent_triangles(TransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour);
+        /// Add the transparent triangles of the mesh, in world space, to the end of a list.
+        /// @param triangles The list to add the triangles to.
+        /// @param colour The colour to give the triangles.
+        void get_transparent_triangles(std::vector<TransparentTriangle>& triangles, const DirectX::SimpleMath::Color& colour) const;
     private:
         float                        _rotation;
         DirectX::SimpleMath::Vector3 _position;
@@ -2,6 +2,7 @@
 #include <trview.app/Elements/Types.h>
 #include <unordered_map>
 #include <algorithm>
+#include <cfloat>
 #include <trview.app/Geometry/TransparencyBuffer.h>
 
 using namespace Microsoft::WRL;
@@ -158,33 +159,63 @@ namespace trview
         return _sector_id;
     }
 
-    const std::vector<TransparentTriangle>& Trigger::triangles() const
+    void Trigger::set_geometry(const TriggerGeometry& geometry, uint32_t first, uint32_t count)
     {
-        return _mesh->transparent_triangles();
-    }
+        using namespace DirectX::SimpleMath;
 
-    void Trigger::set_triangles(const std::vector<TransparentTriangle>& transparent_triangles)
-    {
-        std::vector<Triangle> collision;
-        std::transform(transparent_triangles.begin(), transparent_triangles.end(), std::back_inserter(collision),
-            [](const auto& tri) { return Triangle(tri.vertices[0], tri.vertices[1], tri.vertices[2]); });
-        _mesh = std::make_unique<Mesh>(transparent_triangles, collision);
+        _geometry = &geometry;
+        _first_triangle = first;
+        _num_triangles = count;
+
+        if (!count)
+        {
+            _bounding_box = DirectX::BoundingBox();
+            return;
+        }
+
+        Vector3 minimum(FLT_MAX, FLT_MAX, FLT_MAX);
+        Vector3 maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (uint32_t i = first; i < first + count; ++i)
+        {
+            for (const auto& vertex : geometry.triangles[i].vertices)
+            {
+                minimum = Vector3::Min(minimum, vertex);
+                maximum = Vector3::Max(maximum, vertex);
+            }
+        }
+        DirectX::BoundingBox::CreateFromPoints(_bounding_box, minimum, maximum);
     }
 
     PickResult Trigger::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
-        if (_mesh)
+        using namespace DirectX::TriangleTests;
+
+        float box_distance = 0;
+        if (!_num_triangles || !_bounding_box.Intersects(position, direction, box_distance))
         {
-            auto result = _mesh->pick(position, direction);
-            if (result.hit)
+            return PickResult();
+        }
+
+        PickResult result;
+        for (uint32_t i = _first_triangle; i < _first_triangle + _num_triangles; ++i)
+        {
+            const auto& tri = _geometry->collision[i];
+            float distance = 0;
+            if (direction.Dot(tri.normal) < 0 &&
+                Intersects(position, direction, tri.v0, tri.v1, tri.v2, distance))
             {
-                result.type = PickResult::Type::Trigger;
-                result.index = _number;
-                return result;
+                result.hit = true;
+                result.distance = std::min(distance, result.distance);
             }
         }
 
-        return PickResult();
+        if (result.hit)
+        {
+            result.type = PickResult::Type::Trigger;
+            result.index = _number;
+            result.position = position + direction * result.distance;
+        }
+        return result;
     }
 
     bool Trigger::has_command(TriggerCommandType type) const
@@ -198,10 +229,11 @@ namespace trview
 
     void Trigger::get_transparent_triangles(TransparencyBuffer& transparency, const ICamera&, const DirectX::SimpleMath::Color& colour)
     {
-        using namespace DirectX::SimpleMath;
-        for (auto& triangle : _mesh->transparent_triangles())
+        for (uint32_t i = _first_triangle; i < _first_triangle + _num_triangles; ++i)
         {
-            transparency.add(triangle.transform(Matrix::Identity, colour));
+            auto triangle = _geometry->triangles[i];
+            triangle.colour = colour;
+            transparency.add(triangle);
         }
     }
 
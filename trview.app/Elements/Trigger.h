@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
+#include <DirectXCollision.h>
 #include <trview.app/Geometry/TransparentTriangle.h>
+#include <trview.app/Geometry/Triangle.h>
 #include <trview.app/Geometry/PickResult.h>
-#include <trview.app/Geometry/Mesh.h>
 #include <trview.app/Geometry/IRenderable.h>
 
 namespace trview
@@ -39,6 +41,15 @@ namespace trview
     class TransparencyBuffer;
     struct ICamera;
 
+    /// The overlays of every trigger in a room, kept in one list so that they can be added to a transparency
+    /// buffer at once. Each trigger has a range of the list.
+    struct TriggerGeometry
+    {
+        std::vector<TransparentTriangle> triangles;
+        /// One for each of the triangles, for picking.
+        std::vector<Triangle>            collision;
+    };
+
     class Trigger final : public IRenderable
     {
     public:
@@ -56,8 +67,11 @@ namespace trview
         uint8_t     timer() const;
         uint16_t    sector_id() const;
         const std::vector<Command>& commands() const;
-        const std::vector<TransparentTriangle>& triangles() const;
-        void set_triangles(const std::vector<TransparentTriangle>& transparent_triangles);
+        /// Set the part of the geometry of the room that is the overlay for this trigger.
+        /// @param geometry The trigger geometry of the room. This must not change while the trigger uses it.
+        /// @param first The index of the first triangle of this trigger.
+        /// @param count The number of triangles for this trigger.
+        void set_geometry(const TriggerGeometry& geometry, uint32_t first, uint32_t count);
         PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const;
         bool has_command(TriggerCommandType type) const;
         void set_position(const DirectX::SimpleMath::Vector3& position);
@@ -68,7 +82,10 @@ namespace trview
     private:
         std::vector<uint16_t> _objects;
         std::vector<Command> _commands;
-        std::unique_ptr<Mesh> _mesh;
+        const TriggerGeometry* _geometry{ nullptr };
+        uint32_t _first_triangle{ 0u };
+        uint32_t _num_triangles{ 0u };
+        DirectX::BoundingBox _bounding_box;
         DirectX::SimpleMath::Vector3 _position;
         TriggerType _type;
         uint32_t _number;
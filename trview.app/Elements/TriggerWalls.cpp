@@ -0,0 +1,52 @@
+#include "TriggerWalls.h"
+
+namespace trview
+{
+    std::vector<uint8_t> trigger_walls(uint32_t num_x_sectors, uint32_t num_z_sectors, const std::vector<TriggerFloor>& floors)
+    {
+        // Each edge between two sectors is visited once, and the walls on both sides are removed if both
+        // sides are triggers at the same height.
+        std::vector<uint8_t> walls(floors.size(), Trigger_Wall_All);
+        auto join = [&](uint32_t near_id, uint32_t far_id, uint8_t near_wall, uint8_t far_wall, auto shares_edge)
+        {
+            const auto& near_floor = floors[near_id];
+            const auto& far_floor = floors[far_id];
+            if ((!near_floor.in_room && !far_floor.in_room) ||
+                !near_floor.triggered || !far_floor.triggered ||
+                !shares_edge(near_floor.corners, far_floor.corners))
+            {
+                return;
+            }
+
+            walls[near_id] &= static_cast<uint8_t>(~near_wall);
+            walls[far_id] &= static_cast<uint8_t>(~far_wall);
+        };
+
+        for (uint32_t x = 0; x < num_x_sectors; ++x)
+        {
+            for (uint32_t z = 0; z < num_z_sectors; ++z)
+            {
+                const uint32_t id = x * num_z_sectors + z;
+                if (id >= floors.size())
+                {
+                    continue;
+                }
+
+                const uint32_t next_x = id + num_z_sectors;
+                if (x + 1u < num_x_sectors && next_x < floors.size())
+                {
+                    join(id, next_x, Trigger_Wall_Pos_X, Trigger_Wall_Neg_X,
+                        [](const auto& l, const auto& r) { return l[3] == r[1] && l[2] == r[0]; });
+                }
+
+                const uint32_t next_z = id + 1;
+                if (z + 1u < num_z_sectors && next_z < floors.size())
+                {
+                    join(id, next_z, Trigger_Wall_Pos_Z, Trigger_Wall_Neg_Z,
+                        [](const auto& l, const auto& r) { return l[3] == r[2] && l[1] == r[0]; });
+                }
+            }
+        }
+        return walls;
+    }
+}
@@ -0,0 +1,42 @@
+/// @file TriggerWalls.h
+/// @brief Works out which walls of the trigger overlays in a room need to be made.
+///
+/// The overlay of a trigger is a box that sits on the floor of its sector. When two triggers are next to
+/// each other and their floors meet at the same height along the edge between them, the walls on that
+/// edge would only be seen through the tops of the boxes, so they are left out. A trigger in the room
+/// next door counts as a neighbour when it is on the other side of a portal sector.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace trview
+{
+    /// The walls of a trigger overlay, as bits in the values returned by trigger_walls.
+    const uint8_t Trigger_Wall_Pos_X = 0x1;
+    const uint8_t Trigger_Wall_Neg_X = 0x2;
+    const uint8_t Trigger_Wall_Pos_Z = 0x4;
+    const uint8_t Trigger_Wall_Neg_Z = 0x8;
+    const uint8_t Trigger_Wall_All = Trigger_Wall_Pos_X | Trigger_Wall_Neg_X | Trigger_Wall_Pos_Z | Trigger_Wall_Neg_Z;
+
+    /// The trigger that covers a sector of a room, if there is one.
+    struct TriggerFloor
+    {
+        /// Whether the sector has a trigger in the room itself.
+        bool in_room{ false };
+        /// Whether the sector has a trigger, either in the room or on the other side of a portal.
+        bool triggered{ false };
+        /// The heights of the corners of the floor of the trigger, in the same order as Sector::corners.
+        std::array<float, 4> corners{ 0, 0, 0, 0 };
+    };
+
+    /// Work out which walls each trigger in a room needs.
+    /// @param num_x_sectors The number of sectors along the x axis of the room.
+    /// @param num_z_sectors The number of sectors along the z axis of the room.
+    /// @param floors The trigger floor of each sector, indexed by sector id (x * num_z_sectors + z).
+    /// @returns The walls needed for each sector, indexed by sector id. Only the values for sectors with a
+    ///          trigger in the room are meaningful.
+    std::vector<uint8_t> trigger_walls(uint32_t num_x_sectors, uint32_t num_z_sectors, const std::vector<TriggerFloor>& floors);
+}
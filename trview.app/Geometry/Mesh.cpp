@@ -6,6 +6,7 @@
 #include <DirectXCollision.h>
 
 #include <trview.app/Graphics/ILevelTextureStorage.h>
+#include <trview.common/Profiler.h>
 
 using namespace Microsoft::WRL;
 using namespace DirectX::SimpleMath;
@@ -156,7 +157,8 @@ namespace trview
         memset(&mapped_resource, 0, sizeof(mapped_resource));
 
         MeshData data{ world_view_projection, colour, Vector4(light_direction.x, light_direction.y, light_direction.z, 1), light_direction != Vector3::Zero };
-        context->Map(_matrix_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource); 
+        context->Map(_matrix_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+        profile_count(ProfileCounter::BufferMaps);
         memcpy(mapped_resource.pData, &data, sizeof(data));
         context->Unmap(_matrix_buffer.Get(), 0);
 
@@ -174,6 +176,7 @@ namespace trview
                 context->PSSetShaderResources(0, 1, texture.view().GetAddressOf());
                 context->IASetIndexBuffer(index_buffer.Get(), DXGI_FORMAT_R32_UINT, 0);
                 context->DrawIndexed(_index_counts[i], 0, 0);
+                profile_count(ProfileCounter::DrawCalls);
             }
         }
 
@@ -183,6 +186,7 @@ namespace trview
             context->PSSetShaderResources(0, 1, texture.view().GetAddressOf());
             context->IASetIndexBuffer(_untextured_index_buffer.Get(), DXGI_FORMAT_R32_UINT, 0);
             context->DrawIndexed(_untextured_index_count, 0, 0);
+            profile_count(ProfileCounter::DrawCalls);
         }
     }
 
@@ -238,9 +242,9 @@ namespace trview
         return std::make_unique<Mesh>(device, vertices, indices, untextured_indices, transparent_triangles, collision_triangles);
     }
 
-    std::unique_ptr<Mesh> create_cube_mesh(const graphics::Device& device)
+    void create_cube_geometry(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices)
     {
-        const std::vector<MeshVertex> vertices
+        vertices =
         {
             // + y
             { { -0.5, 0.5f, -0.5 }, Vector3::Down, { 0, 0 }, { 1.0f, 1.0f, 1.0f } },       // 2
@@ -279,7 +283,7 @@ namespace trview
             { { -0.5, -0.5f, 0.5 }, Vector3::Up, { 0, 0 }, { 1.0f, 1.0f, 1.0f } }        // 7
         };
 
-        const std::vector<uint32_t> indices
+        indices =
         {
             0,  1,  2,  2,  3,  0,  // +y
             4,  5,  6,  6,  7,  4,  // +x
@@ -288,7 +292,13 @@ namespace trview
             16, 17, 18, 18, 19, 16, // -z
             20, 21, 22, 22, 23, 20  // -y
         };
+    }
 
+    std::unique_ptr<Mesh> create_cube_mesh(const graphics::Device& device)
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+        create_cube_geometry(vertices, indices);
         return std::make_unique<Mesh>(device, vertices, std::vector<std::vector<uint32_t>>(), indices, std::vector<TransparentTriangle>(), std::vector<Triangle>());
     }
 
@@ -76,6 +76,11 @@ namespace trview
     /// Create a new cube mesh.
     std::unique_ptr<Mesh> create_cube_mesh(const graphics::Device& device);
 
+    /// Get the vertices and indices of a white unit cube centred on the origin.
+    /// @param vertices Set to the vertices of the cube.
+    /// @param indices Set to the indices of the triangles of the cube.
+    void create_cube_geometry(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices);
+
     /// Convert the textured rectangles into collections required to create a mesh.
     /// @param level_version The level version - affects texture index.
     /// @param rectangles The rectangles from the mesh or room geometry.
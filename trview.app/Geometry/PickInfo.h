@@ -3,6 +3,8 @@
 #include <trview.common/Size.h>
 #include <trview.common/Point.h>
 #include <SimpleMath.h>
+#include <DirectXCollision.h>
+#include <trview.app/Camera/ProjectionMode.h>
 
 namespace trview
 {
@@ -12,5 +14,9 @@ namespace trview
         Point screen_position;
         DirectX::SimpleMath::Vector3 position;
         DirectX::SimpleMath::Vector3 direction;
+        /// The frustum of the camera when the pick was requested.
+        DirectX::BoundingFrustum frustum;
+        /// The projection mode of the camera when the pick was requested.
+        ProjectionMode projection_mode{ ProjectionMode::Perspective };
     };
 }
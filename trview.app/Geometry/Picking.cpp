@@ -10,6 +10,22 @@ using namespace DirectX::SimpleMath;
 
 namespace trview
 {
+    Picking::Picking(std::function<void()> on_completed)
+        : _on_completed(on_completed), _thread(&Picking::run, this)
+    {
+    }
+
+    Picking::~Picking()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+            _pending.reset();
+        }
+        _condition.notify_all();
+        _thread.join();
+    }
+
     void Picking::pick(const Window& window, const ICamera& camera)
     {
         Vector3 position = camera.position();
@@ -26,11 +42,120 @@ namespace trview
         position += XMVector3Unproject(Vector3(mouse_pos.x, mouse_pos.y, 0.1f), 0, 0,
             window_size.width, window_size.height, 0.1f, 10000.0f, projection, view, world);
 
-        // Call the registered pickers.
-        PickInfo info{ camera.view_size(), mouse_pos, position, direction };
+        pick(PickInfo{ camera.view_size(), mouse_pos, position, direction, camera.frustum(), camera.projection_mode() });
+    }
+
+    void Picking::pick(const PickInfo& info)
+    {
+        // Call the registered pickers that have to run on this thread.
         PickResult result{};
         pick_sources(info, result);
 
-        on_pick(info, result);
+        uint64_t sequence = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            sequence = _next_sequence++;
+            if (!result.stop)
+            {
+                // Replace any request that hasn't been started yet - only the latest position matters.
+                _pending = Request{ info, result, sequence };
+            }
+            else
+            {
+                _pending.reset();
+                _completed.reset();
+                _delivered_sequence = sequence;
+            }
+        }
+
+        if (result.stop)
+        {
+            on_pick(info, result);
+        }
+        else
+        {
+            _condition.notify_all();
+        }
+    }
+
+    void Picking::update()
+    {
+        std::optional<Request> completed;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_completed)
+            {
+                return;
+            }
+            completed.swap(_completed);
+
+            // A result older than one that has already been raised (or that was cancelled) is out of date.
+            if (completed->sequence <= _delivered_sequence)
+            {
+                return;
+            }
+            _delivered_sequence = completed->sequence;
+        }
+
+        on_pick(completed->info, completed->result);
+    }
+
+    void Picking::cancel()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _pending.reset();
+        _condition.wait(lock, [&] { return !_busy; });
+        _completed.reset();
+        _delivered_sequence = _next_sequence - 1;
+    }
+
+    void Picking::wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [&] { return !_busy && !_pending; });
+    }
+
+    bool Picking::busy() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _busy || _pending || _completed;
+    }
+
+    bool Picking::ready() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _completed.has_value();
+    }
+
+    void Picking::run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            _condition.wait(lock, [&] { return _stop || _pending; });
+            if (_stop)
+            {
+                return;
+            }
+
+            Request request = std::move(_pending.value());
+            _pending.reset();
+            _busy = true;
+            lock.unlock();
+
+            background_pick_sources(request.info, request.result);
+
+            lock.lock();
+            _busy = false;
+            if (request.sequence > _delivered_sequence)
+            {
+                _completed = std::move(request);
+                if (_on_completed)
+                {
+                    _on_completed();
+                }
+            }
+            _condition.notify_all();
+        }
     }
 }
@@ -1,5 +1,12 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
 #include <trview.common/Event.h>
 #include "PickInfo.h"
 #include "PickResult.h"
@@ -9,18 +16,76 @@ namespace trview
     class Window;
     struct ICamera;
 
+    /// Performs picking against the scene. Expensive pick sources are run on a background thread so that the
+    /// cost of picking does not hold up rendering. Only the most recent request is kept - if a new request is made
+    /// before the previous one has started, the previous one is discarded.
     class Picking final
     {
     public:
-        /// Perform a pick operation.
+        /// Create a new picking instance and start the background thread.
+        /// @param on_completed Called on the background thread when a pick has finished, so that the thread that
+        ///                     calls update can be woken up to raise the result.
+        explicit Picking(std::function<void()> on_completed = {});
+
+        /// Stops the background thread, waiting for any pick in progress to finish.
+        ~Picking();
+
+        /// Request a pick operation. The result is raised through on_pick, either immediately if one of the
+        /// pick_sources stopped the pick or when update is called after the background pick has finished.
         /// @param window The window that the scene is being rendered in.
         /// @param camera The current scene camera.
         void pick(const Window& window, const ICamera& camera);
 
-        /// The sources of pick information.
+        /// Request a pick operation with pick information that has already been calculated.
+        /// @param info The pick information.
+        void pick(const PickInfo& info);
+
+        /// Raise on_pick for the latest finished background pick, if there is one. This should be called regularly
+        /// on the thread that on_pick should be raised on.
+        void update();
+
+        /// Discard any pending request and wait for any pick in progress to finish. The result of the pick in progress
+        /// will not be raised. This must be called before changing anything that the background pick sources use.
+        void cancel();
+
+        /// Wait until there is no pick pending or in progress.
+        void wait();
+
+        /// Gets whether there is a pick pending or in progress, or a result that update hasn't raised yet.
+        bool busy() const;
+
+        /// Gets whether there is a finished pick that update hasn't raised yet.
+        bool ready() const;
+
+        /// The sources of pick information. These are called on the thread that requested the pick, before the
+        /// background sources. If a source sets stop on the result the background sources are not called.
         Event<PickInfo, PickResult&> pick_sources;
 
+        /// The sources of pick information that are called on the background thread. These must not use anything
+        /// that can change while a pick is in progress unless it is protected, or cancel is called before changing it.
+        Event<PickInfo, PickResult&> background_pick_sources;
+
         /// Raise when something has been picked.
         Event<PickInfo, PickResult> on_pick;
+    private:
+        struct Request
+        {
+            PickInfo   info;
+            PickResult result;
+            uint64_t   sequence;
+        };
+
+        void run();
+
+        std::function<void()> _on_completed;
+        mutable std::mutex _mutex;
+        std::condition_variable _condition;
+        std::optional<Request> _pending;
+        std::optional<Request> _completed;
+        bool _busy{ false };
+        bool _stop{ false };
+        uint64_t _next_sequence{ 1u };
+        uint64_t _delivered_sequence{ 0u };
+        std::thread _thread;
     };
 }
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <trview.app/Geometry/Mesh.h>
+#include <trview.common/Profiler.h>
 
 using namespace Microsoft::WRL;
 using namespace DirectX::SimpleMath;
@@ -66,6 +67,11 @@ namespace trview
         _triangles.push_back(triangle);
     }
 
+    void TransparencyBuffer::add(const std::vector<TransparentTriangle>& triangles)
+    {
+        _triangles.insert(_triangles.end(), triangles.begin(), triangles.end());
+    }
+
     void TransparencyBuffer::sort(const Vector3& eye_position)
     {
         std::sort(_triangles.begin(), _triangles.end(),
@@ -96,6 +102,7 @@ namespace trview
         MeshData data{ camera.view_projection(), Color(1,1,1,1), Vector4::Zero };
          
         context->Map(_matrix_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+        profile_count(ProfileCounter::BufferMaps);
         memcpy(mapped_resource.pData, &data, sizeof(data));
         context->Unmap(_matrix_buffer.Get(), 0);
 
@@ -120,6 +127,8 @@ namespace trview
             auto texture = run.texture == TransparentTriangle::Untextured ? _untextured : texture_storage.texture(run.texture);
             context->PSSetShaderResources(0, 1, texture.view().GetAddressOf());
             context->Draw(run.count * 3, sum);
+            profile_count(ProfileCounter::DrawCalls);
+            profile_count(ProfileCounter::TransparentTriangles, run.count);
             sum += run.count * 3;
         }
 
@@ -134,25 +143,30 @@ namespace trview
 
     void TransparencyBuffer::create_buffer()
     {
-        _vertex_buffer = nullptr;
-
         if (_vertices.empty())
         {
             return;
         }
 
-        // Generate the buffers.
-        D3D11_BUFFER_DESC vertex_desc;
-        memset(&vertex_desc, 0, sizeof(vertex_desc));
-        vertex_desc.Usage = D3D11_USAGE_DEFAULT;
-        vertex_desc.ByteWidth = sizeof(MeshVertex) * static_cast<uint32_t>(_vertices.size());
-        vertex_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        // Only make a new buffer if the existing one isn't big enough. Leave some room so that a few more
+        // triangles don't need another new buffer.
+        const uint32_t count = static_cast<uint32_t>(_vertices.size());
+        if (!_vertex_buffer || count > _vertex_capacity)
+        {
+            _vertex_capacity = count + count / 2;
+
+            D3D11_BUFFER_DESC vertex_desc;
+            memset(&vertex_desc, 0, sizeof(vertex_desc));
+            vertex_desc.Usage = D3D11_USAGE_DEFAULT;
+            vertex_desc.ByteWidth = sizeof(MeshVertex) * _vertex_capacity;
+            vertex_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 
-        D3D11_SUBRESOURCE_DATA vertex_data;
-        memset(&vertex_data, 0, sizeof(vertex_data));
-        vertex_data.pSysMem = &_vertices[0];
+            _vertex_buffer = nullptr;
+            _device.device()->CreateBuffer(&vertex_desc, nullptr, &_vertex_buffer);
+        }
 
-        _device.device()->CreateBuffer(&vertex_desc, &vertex_data, &_vertex_buffer);
+        D3D11_BOX box{ 0, 0, 0, sizeof(MeshVertex) * count, 1, 1 };
+        _device.context()->UpdateSubresource(_vertex_buffer.Get(), 0, &box, &_vertices[0], 0, 0);
     }
 
     void TransparencyBuffer::create_matrix_buffer()
@@ -28,12 +28,20 @@ namespace trview
         // triangle: The triangle to add.
         void add(const TransparentTriangle& triangle);
 
+        /// Add triangles to the end of the transparency buffer.
+        /// @param triangles The triangles to add.
+        void add(const std::vector<TransparentTriangle>& triangles);
+
         // Sort the accumulated transparent triangles in order of farthest to
         // nearest, based on the position of the camera.
         // eye_position: The position of the camera.
         void sort(const DirectX::SimpleMath::Vector3& eye_position);
 
-        /// Render the accumulated transparent triangles. Sort should be called before this function is called.
+        // Prepare the accumulated transparent triangles for rendering in the order that they
+        // were added. Use this instead of sort when the order doesn't change the result.
+        void complete();
+
+        /// Render the accumulated transparent triangles. Sort or complete should be called before this function is called.
         /// @param context Current device context.
         /// @param camera The current camera.
         /// @param texture_storage Texture storage for the level.
@@ -45,11 +53,11 @@ namespace trview
     private:
         void create_buffer();
         void create_matrix_buffer();
-        void complete();
         void set_blend_mode(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, TransparentTriangle::Mode mode) const;
 
         const graphics::Device& _device;
         Microsoft::WRL::ComPtr<ID3D11Buffer> _vertex_buffer;
+        uint32_t _vertex_capacity{ 0u };
         Microsoft::WRL::ComPtr<ID3D11Buffer> _matrix_buffer;
         Microsoft::WRL::ComPtr<ID3D11BlendState> _alpha_blend;
         Microsoft::WRL::ComPtr<ID3D11BlendState> _additive_blend;
@@ -0,0 +1,174 @@
+#define NOMINMAX
+#include "CompressedTileCache.h"
+
+#include <windows.h>
+#include <ShlObj.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace trview
+{
+    namespace
+    {
+        struct SafePath
+        {
+            wchar_t* path;
+            ~SafePath()
+            {
+                if (path)
+                {
+                    CoTaskMemFree(path);
+                }
+            }
+        };
+
+        uint64_t combine(DWORD high, DWORD low)
+        {
+            return (static_cast<uint64_t>(high) << 32) | low;
+        }
+
+        /// Set the last access time of a file to now. This is set here rather than left to the file system,
+        /// which may not update it when the file is read.
+        void touch(const std::wstring& path)
+        {
+            HANDLE file = CreateFile(path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, 0, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                return;
+            }
+
+            FILETIME now;
+            GetSystemTimeAsFileTime(&now);
+            SetFileTime(file, nullptr, &now, nullptr);
+            CloseHandle(file);
+        }
+    }
+
+    CompressedTileCache::CompressedTileCache(const std::wstring& folder, uint64_t max_size)
+        : _folder(folder), _max_size(max_size)
+    {
+    }
+
+    std::wstring CompressedTileCache::default_folder()
+    {
+        SafePath path;
+        if (S_OK != SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &path.path))
+        {
+            return std::wstring();
+        }
+
+        std::wstring folder(path.path);
+        for (const auto name : { L"\\trview", L"\\textures" })
+        {
+            folder += name;
+            if (!CreateDirectory(folder.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
+            {
+                return std::wstring();
+            }
+        }
+        return folder;
+    }
+
+    bool CompressedTileCache::enabled() const
+    {
+        return !_folder.empty();
+    }
+
+    bool CompressedTileCache::load(uint64_t key, std::vector<CompressedTexture>& tiles) const
+    {
+        if (!enabled())
+        {
+            return false;
+        }
+
+        const auto file_path = path(key);
+        {
+            std::ifstream file(file_path, std::ios::binary);
+            if (!file.is_open() || !read_compressed_textures(file, tiles))
+            {
+                return false;
+            }
+        }
+        touch(file_path);
+        return true;
+    }
+
+    void CompressedTileCache::store(uint64_t key, const std::vector<CompressedTexture>& tiles) const
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        const auto file_path = path(key);
+        {
+            std::ofstream file(file_path, std::ios::binary);
+            if (!file.is_open())
+            {
+                return;
+            }
+            write_compressed_textures(file, tiles);
+        }
+        touch(file_path);
+        evict(file_path);
+    }
+
+    std::wstring CompressedTileCache::path(uint64_t key) const
+    {
+        std::wstringstream name;
+        name << std::hex << std::setw(16) << std::setfill(L'0') << key;
+        return _folder + L"\\" + name.str() + L".bct";
+    }
+
+    void CompressedTileCache::evict(const std::wstring& keep) const
+    {
+        struct CachedFile
+        {
+            std::wstring path;
+            uint64_t     size;
+            uint64_t     last_access;
+        };
+
+        std::vector<CachedFile> files;
+        uint64_t total = 0;
+
+        WIN32_FIND_DATA data;
+        HANDLE find = FindFirstFile((_folder + L"\\*.bct").c_str(), &data);
+        if (find == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        do
+        {
+            if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+            {
+                const uint64_t size = combine(data.nFileSizeHigh, data.nFileSizeLow);
+                files.push_back({ _folder + L"\\" + data.cFileName, size, combine(data.ftLastAccessTime.dwHighDateTime, data.ftLastAccessTime.dwLowDateTime) });
+                total += size;
+            }
+        } while (FindNextFile(find, &data) != 0);
+        FindClose(find);
+
+        if (total <= _max_size)
+        {
+            return;
+        }
+
+        std::sort(files.begin(), files.end(), [](const auto& l, const auto& r) { return l.last_access < r.last_access; });
+        for (const auto& file : files)
+        {
+            if (total <= _max_size)
+            {
+                break;
+            }
+
+            if (file.path != keep && DeleteFile(file.path.c_str()))
+            {
+                total -= file.size;
+            }
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/// @file CompressedTileCache.h
+/// @brief Keeps the compressed tiles of levels on disk so that they don't have to be compressed again.
+///
+/// The tiles of each level are kept in their own file, named after a key made from the pixels of the
+/// tiles. Each file is a few megabytes, so the cache has a size budget: when a file is added, the files
+/// that were used least recently are removed until the total size is within the budget. Loading a file
+/// sets its last access time, which is what the files are ordered by. A cache with no folder keeps
+/// nothing, so that tests and tools don't write to the user's files.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "TextureCompression.h"
+
+namespace trview
+{
+    /// Keeps the compressed tiles of levels in a folder.
+    class CompressedTileCache final
+    {
+    public:
+        /// The most space that the cached files use by default, in bytes.
+        static constexpr uint64_t Default_Max_Size = 512ull * 1024 * 1024;
+
+        /// Create a cache that keeps files in a folder.
+        /// @param folder The folder to keep the files in, which must exist. If this is empty nothing is cached.
+        /// @param max_size The most space that the files can use, in bytes.
+        explicit CompressedTileCache(const std::wstring& folder, uint64_t max_size = Default_Max_Size);
+
+        /// Gets the folder in the user's local app data that the viewer keeps compressed tiles in, creating
+        /// it if it doesn't exist.
+        /// @returns The folder, or an empty string if there is nowhere to keep the files.
+        static std::wstring default_folder();
+
+        /// Gets whether anything is cached.
+        bool enabled() const;
+
+        /// Load the tiles with a key, marking the file as just used.
+        /// @param key The key of the tiles.
+        /// @param tiles Set to the tiles that were loaded.
+        /// @returns True if the tiles were loaded.
+        bool load(uint64_t key, std::vector<CompressedTexture>& tiles) const;
+
+        /// Save tiles with a key, then remove the least recently used files if the cache is over budget.
+        /// @param key The key of the tiles.
+        /// @param tiles The tiles to save.
+        void store(uint64_t key, const std::vector<CompressedTexture>& tiles) const;
+    private:
+        std::wstring path(uint64_t key) const;
+
+        /// Remove the least recently used files until the total size is within the budget.
+        /// @param keep The file that has just been added, which is never removed.
+        void evict(const std::wstring& keep) const;
+
+        std::wstring _folder;
+        uint64_t     _max_size;
+    };
+}
@@ -1,15 +1,148 @@
+#define NOMINMAX
 #include "LevelTextureStorage.h"
 #include "TextureStorage.h"
+#include "TextureCompression.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace trview
 {
-    LevelTextureStorage::LevelTextureStorage(const graphics::Device& device, const trlevel::ILevel& level)
+    namespace
+    {
+        /// The width and height of a tile.
+        const uint32_t Tile_Size = 256;
+        /// The most levels in the mip chain of a tile, including the tile itself. Each tile has many textures
+        /// packed in to it, so the smaller levels would blend the edges of neighbouring textures together.
+        const uint32_t Max_Mip_Levels = 4;
+
+        /// Make a key for the compressed tiles of a level from the pixels of the tiles.
+        uint64_t cache_key(const std::vector<std::vector<uint32_t>>& tiles)
+        {
+            // FNV-1a.
+            uint64_t hash = 14695981039346656037ull;
+            auto add = [&](uint32_t value)
+            {
+                for (uint32_t i = 0; i < 4; ++i)
+                {
+                    hash = (hash ^ ((value >> (8 * i)) & 0xff)) * 1099511628211ull;
+                }
+            };
+
+            add(Max_Mip_Levels);
+            for (const auto& tile : tiles)
+            {
+                for (const auto pixel : tile)
+                {
+                    add(pixel);
+                }
+            }
+            return hash;
+        }
+
+        bool supports_block_compression(const graphics::Device& device)
+        {
+            for (const auto format : { DXGI_FORMAT_BC1_UNORM, DXGI_FORMAT_BC3_UNORM })
+            {
+                UINT support = 0;
+                if (FAILED(device.device()->CheckFormatSupport(format, &support)) ||
+                    !(support & D3D11_FORMAT_SUPPORT_TEXTURE2D) || !(support & D3D11_FORMAT_SUPPORT_MIP))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Compress each tile, sharing the tiles between a thread for each core.
+        std::vector<CompressedTexture> compress_tiles(const std::vector<std::vector<uint32_t>>& tiles)
+        {
+            std::vector<CompressedTexture> compressed(tiles.size());
+            std::atomic<std::size_t> next{ 0u };
+            auto compress = [&]()
+            {
+                for (std::size_t i = next++; i < tiles.size(); i = next++)
+                {
+                    compressed[i] = compress_texture(tiles[i], Tile_Size, Tile_Size, Max_Mip_Levels);
+                }
+            };
+
+            std::vector<std::thread> threads;
+            const std::size_t count = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), tiles.size());
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                threads.emplace_back(compress);
+            }
+            compress();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            return compressed;
+        }
+
+        /// Load the compressed tiles of a level from the cache, or compress them and add them to the cache.
+        std::vector<CompressedTexture> load_compressed_tiles(const std::vector<std::vector<uint32_t>>& tiles, const CompressedTileCache& cache)
+        {
+            if (tiles.empty())
+            {
+                return {};
+            }
+
+            const uint64_t key = cache_key(tiles);
+            std::vector<CompressedTexture> compressed;
+
+            // A file with tiles of a different size is compressed again rather than uploaded, as the
+            // texture would be created with less data than it needs.
+            if (cache.load(key, compressed) && compressed.size() == tiles.size() &&
+                std::all_of(compressed.begin(), compressed.end(),
+                    [](const auto& tile) { return matches_dimensions(tile, Tile_Size, Tile_Size, Max_Mip_Levels); }))
+            {
+                return compressed;
+            }
+
+            compressed = compress_tiles(tiles);
+            cache.store(key, compressed);
+            return compressed;
+        }
+
+        graphics::Texture create_tile(const graphics::Device& device, const CompressedTexture& tile)
+        {
+            std::vector<D3D11_SUBRESOURCE_DATA> levels;
+            for (uint32_t i = 0; i < tile.levels.size(); ++i)
+            {
+                levels.push_back({ tile.levels[i].blocks.data(), tile.pitch(i), 0 });
+            }
+            const auto format = tile.format == BlockFormat::BC1 ? DXGI_FORMAT_BC1_UNORM : DXGI_FORMAT_BC3_UNORM;
+            return graphics::Texture(device, Tile_Size, Tile_Size, format, levels);
+        }
+    }
+
+    LevelTextureStorage::LevelTextureStorage(const graphics::Device& device, const trlevel::ILevel& level, const CompressedTileCache& tile_cache)
         : _device(device), _texture_storage(std::make_unique<TextureStorage>(device)), _version(level.get_version())
     {
+        std::vector<std::vector<uint32_t>> tiles;
         for (uint32_t i = 0; i < level.num_textiles(); ++i)
         {
-            std::vector<uint32_t> data = level.get_textile(i);
-            _tiles.emplace_back(device, 256, 256, data);
+            tiles.push_back(level.get_textile(i));
+        }
+
+        // Tiles are compressed with a mip chain when the device can use compressed textures, which uses a
+        // quarter of the memory or less and stops distant textures from shimmering.
+        if (supports_block_compression(device))
+        {
+            for (const auto& tile : load_compressed_tiles(tiles, tile_cache))
+            {
+                _tiles.push_back(create_tile(device, tile));
+            }
+        }
+        else
+        {
+            for (const auto& tile : tiles)
+            {
+                _tiles.emplace_back(device, Tile_Size, Tile_Size, tile);
+            }
         }
 
         // Copy object textures locally from the level.
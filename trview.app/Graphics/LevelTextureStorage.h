@@ -8,13 +8,18 @@
 #include <trlevel/ILevel.h>
 #include <trview.app/Graphics/ILevelTextureStorage.h>
 #include <trview.graphics/Device.h>
+#include <trview.app/Graphics/CompressedTileCache.h>
 
 namespace trview
 {
     class LevelTextureStorage final : public ILevelTextureStorage
     {
     public:
-        explicit LevelTextureStorage(const graphics::Device& device, const trlevel::ILevel& level);
+        /// Create the textures for a level.
+        /// @param device The device to create the textures with.
+        /// @param level The level to get the tiles from.
+        /// @param tile_cache The cache to keep the compressed tiles of the level in.
+        explicit LevelTextureStorage(const graphics::Device& device, const trlevel::ILevel& level, const CompressedTileCache& tile_cache);
         virtual ~LevelTextureStorage() = default;
         virtual graphics::Texture texture(uint32_t tile_index) const override;
         virtual graphics::Texture coloured(uint32_t colour) const override;
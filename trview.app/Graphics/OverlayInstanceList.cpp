@@ -0,0 +1,54 @@
+#include "OverlayInstanceList.h"
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    void OverlayInstanceList::add_cube(const Matrix& world, const Color& colour, const Vector3& light_direction)
+    {
+        const float lit = light_direction != Vector3::Zero ? 1.0f : 0.0f;
+        _instances[static_cast<uint32_t>(Primitive::Cube)].push_back({ world, colour, Vector4(light_direction.x, light_direction.y, light_direction.z, lit) });
+    }
+
+    void OverlayInstanceList::add_triangle(const Vector3& a, const Vector3& b, const Vector3& c, const Matrix& world, const Color& colour)
+    {
+        // Map the corners of the unit triangle on to the corners of this triangle. The y axis is never
+        // used by the unit triangle, so it can be anything.
+        const auto ab = b - a;
+        const auto ac = c - a;
+        const Matrix corners(
+            ab.x, ab.y, ab.z, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            ac.x, ac.y, ac.z, 0.0f,
+            a.x, a.y, a.z, 1.0f);
+        _instances[static_cast<uint32_t>(Primitive::Triangle)].push_back({ corners * world, colour, Vector4::Zero });
+    }
+
+    const std::vector<OverlayInstanceList::Instance>& OverlayInstanceList::instances(Primitive primitive) const
+    {
+        return _instances[static_cast<uint32_t>(primitive)];
+    }
+
+    std::size_t OverlayInstanceList::size() const
+    {
+        std::size_t total = 0;
+        for (const auto& instances : _instances)
+        {
+            total += instances.size();
+        }
+        return total;
+    }
+
+    bool OverlayInstanceList::empty() const
+    {
+        return size() == 0;
+    }
+
+    void OverlayInstanceList::clear()
+    {
+        for (auto& instances : _instances)
+        {
+            instances.clear();
+        }
+    }
+}
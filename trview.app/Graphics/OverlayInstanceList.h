@@ -0,0 +1,72 @@
+/// @file OverlayInstanceList.h
+/// @brief The simple shapes that tools and the route draw on top of the level in a frame.
+///
+/// Tools such as the measure tool, the route and the sector highlight are made of many copies of
+/// the same few shapes. Each copy is added to this list as an instance, and the whole list is then
+/// drawn by the OverlayRenderer with one instanced draw for each kind of shape.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SimpleMath.h>
+
+namespace trview
+{
+    /// The simple shapes that tools and the route draw on top of the level in a frame.
+    class OverlayInstanceList final
+    {
+    public:
+        /// The kinds of shape that can be drawn.
+        enum class Primitive : uint32_t
+        {
+            /// A white unit cube centred on the origin.
+            Cube,
+            /// A white triangle with corners at (0,0,0), (1,0,0) and (0,0,1).
+            Triangle,
+            /// The number of kinds of shape.
+            Count
+        };
+
+        /// A single copy of a shape. This is the layout of the per-instance data in the overlay vertex shader.
+        struct Instance
+        {
+            /// The world transform of the shape.
+            DirectX::SimpleMath::Matrix  world;
+            /// The colour of the shape.
+            DirectX::SimpleMath::Color   colour;
+            /// The direction of the light in xyz. The shape is lit if w is not zero.
+            DirectX::SimpleMath::Vector4 light_direction;
+        };
+
+        /// Add a cube.
+        /// @param world The world transform of the unit cube.
+        /// @param colour The colour of the cube.
+        /// @param light_direction The direction of the light. If this is zero the cube is not lit.
+        void add_cube(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Color& colour, const DirectX::SimpleMath::Vector3& light_direction = DirectX::SimpleMath::Vector3::Zero);
+
+        /// Add a triangle. The triangle is not lit.
+        /// @param a The first corner of the triangle.
+        /// @param b The second corner of the triangle.
+        /// @param c The third corner of the triangle.
+        /// @param world The transform to apply after the corners, such as the room offset.
+        /// @param colour The colour of the triangle.
+        void add_triangle(const DirectX::SimpleMath::Vector3& a, const DirectX::SimpleMath::Vector3& b, const DirectX::SimpleMath::Vector3& c,
+            const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Color& colour);
+
+        /// Gets the instances of a kind of shape.
+        /// @param primitive The kind of shape.
+        const std::vector<Instance>& instances(Primitive primitive) const;
+
+        /// Gets the total number of instances of every kind of shape.
+        std::size_t size() const;
+
+        /// Gets whether there are no instances.
+        bool empty() const;
+
+        /// Remove all of the instances. The memory is kept for the next frame.
+        void clear();
+    private:
+        std::vector<Instance> _instances[static_cast<uint32_t>(Primitive::Count)];
+    };
+}
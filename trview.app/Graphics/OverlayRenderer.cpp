@@ -0,0 +1,167 @@
+#define NOMINMAX
+#include "OverlayRenderer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <trview.app/Camera/ICamera.h>
+#include <trview.app/Geometry/Mesh.h>
+#include <trview.common/Profiler.h>
+#include <trview.graphics/Device.h>
+#include <trview.graphics/IShader.h>
+#include <trview.graphics/IShaderStorage.h>
+#include <trview.graphics/VertexShaderStore.h>
+#include "ILevelTextureStorage.h"
+
+using namespace Microsoft::WRL;
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    using namespace graphics;
+
+    namespace
+    {
+        /// The smallest number of instances that the instance buffer is made for.
+        const std::size_t Minimum_Instances = 256;
+
+        void create_static_buffer(const Device& device, UINT bind_flags, const void* data, UINT size, ComPtr<ID3D11Buffer>& buffer)
+        {
+            D3D11_BUFFER_DESC desc;
+            memset(&desc, 0, sizeof(desc));
+            desc.Usage = D3D11_USAGE_IMMUTABLE;
+            desc.ByteWidth = size;
+            desc.BindFlags = bind_flags;
+
+            D3D11_SUBRESOURCE_DATA initial_data;
+            memset(&initial_data, 0, sizeof(initial_data));
+            initial_data.pSysMem = data;
+
+            device.device()->CreateBuffer(&desc, &initial_data, &buffer);
+        }
+    }
+
+    OverlayRenderer::OverlayRenderer(const Device& device, const IShaderStorage& shader_storage)
+        : _vertex_shader(shader_storage.get("overlay_vertex_shader"))
+    {
+        create_geometry(device);
+
+        D3D11_BUFFER_DESC matrix_desc;
+        memset(&matrix_desc, 0, sizeof(matrix_desc));
+        matrix_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        matrix_desc.ByteWidth = sizeof(Matrix);
+        matrix_desc.Usage = D3D11_USAGE_DYNAMIC;
+        matrix_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        device.device()->CreateBuffer(&matrix_desc, nullptr, &_matrix_buffer);
+    }
+
+    void OverlayRenderer::create_geometry(const Device& device)
+    {
+        auto store = [&](OverlayInstanceList::Primitive primitive, const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices)
+        {
+            auto& geometry = _geometry[static_cast<uint32_t>(primitive)];
+            create_static_buffer(device, D3D11_BIND_VERTEX_BUFFER, &vertices[0], static_cast<UINT>(sizeof(MeshVertex) * vertices.size()), geometry.vertex_buffer);
+            create_static_buffer(device, D3D11_BIND_INDEX_BUFFER, &indices[0], static_cast<UINT>(sizeof(uint32_t) * indices.size()), geometry.index_buffer);
+            geometry.index_count = static_cast<uint32_t>(indices.size());
+        };
+
+        std::vector<MeshVertex> cube_vertices;
+        std::vector<uint32_t> cube_indices;
+        create_cube_geometry(cube_vertices, cube_indices);
+        store(OverlayInstanceList::Primitive::Cube, cube_vertices, cube_indices);
+
+        const std::vector<MeshVertex> triangle_vertices
+        {
+            { { 0, 0, 0 }, Vector3::Down, { 0, 0 }, { 1.0f, 1.0f, 1.0f } },
+            { { 1, 0, 0 }, Vector3::Down, { 0, 0 }, { 1.0f, 1.0f, 1.0f } },
+            { { 0, 0, 1 }, Vector3::Down, { 0, 0 }, { 1.0f, 1.0f, 1.0f } }
+        };
+        store(OverlayInstanceList::Primitive::Triangle, triangle_vertices, { 0, 1, 2 });
+    }
+
+    void OverlayRenderer::reserve_instances(const Device& device, std::size_t count)
+    {
+        if (_instance_buffer && count <= _instance_capacity)
+        {
+            return;
+        }
+
+        _instance_capacity = std::max(Minimum_Instances, _instance_capacity);
+        while (_instance_capacity < count)
+        {
+            _instance_capacity *= 2;
+        }
+
+        D3D11_BUFFER_DESC desc;
+        memset(&desc, 0, sizeof(desc));
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.ByteWidth = static_cast<UINT>(sizeof(OverlayInstanceList::Instance) * _instance_capacity);
+        desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        _instance_buffer.Reset();
+        device.device()->CreateBuffer(&desc, nullptr, &_instance_buffer);
+    }
+
+    void OverlayRenderer::render(const Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, const OverlayInstanceList& instances)
+    {
+        if (instances.empty())
+        {
+            return;
+        }
+
+        auto context = device.context();
+        reserve_instances(device, instances.size());
+
+        // Copy every instance into the instance buffer, one kind of shape after another.
+        D3D11_MAPPED_SUBRESOURCE mapped_resource;
+        memset(&mapped_resource, 0, sizeof(mapped_resource));
+        context->Map(_instance_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+        profile_count(ProfileCounter::BufferMaps);
+        auto destination = static_cast<OverlayInstanceList::Instance*>(mapped_resource.pData);
+        for (uint32_t i = 0; i < static_cast<uint32_t>(OverlayInstanceList::Primitive::Count); ++i)
+        {
+            const auto& source = instances.instances(static_cast<OverlayInstanceList::Primitive>(i));
+            destination = std::copy(source.begin(), source.end(), destination);
+        }
+        context->Unmap(_instance_buffer.Get(), 0);
+
+        const auto view_projection = camera.view_projection();
+        context->Map(_matrix_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+        profile_count(ProfileCounter::BufferMaps);
+        memcpy(mapped_resource.pData, &view_projection, sizeof(view_projection));
+        context->Unmap(_matrix_buffer.Get(), 0);
+
+        VertexShaderStore vs_store(context);
+        _vertex_shader->apply(context);
+        context->VSSetConstantBuffers(0, 1, _matrix_buffer.GetAddressOf());
+
+        auto texture = texture_storage.untextured();
+        context->PSSetShaderResources(0, 1, texture.view().GetAddressOf());
+
+        UINT first_instance = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(OverlayInstanceList::Primitive::Count); ++i)
+        {
+            const auto count = static_cast<UINT>(instances.instances(static_cast<OverlayInstanceList::Primitive>(i)).size());
+            if (!count)
+            {
+                continue;
+            }
+
+            const auto& geometry = _geometry[i];
+            ID3D11Buffer* buffers[] = { geometry.vertex_buffer.Get(), _instance_buffer.Get() };
+            UINT strides[] = { sizeof(MeshVertex), sizeof(OverlayInstanceList::Instance) };
+            UINT offsets[] = { 0, 0 };
+            context->IASetVertexBuffers(0, 2, buffers, strides, offsets);
+            context->IASetIndexBuffer(geometry.index_buffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+            context->DrawIndexedInstanced(geometry.index_count, count, 0, 0, first_instance);
+            profile_count(ProfileCounter::DrawCalls);
+            first_instance += count;
+        }
+
+        // Meshes drawn after this only bind the first slot.
+        ID3D11Buffer* no_buffer = nullptr;
+        UINT zero = 0;
+        context->IASetVertexBuffers(1, 1, &no_buffer, &zero, &zero);
+    }
+}
@@ -0,0 +1,65 @@
+/// @file OverlayRenderer.h
+/// @brief Draws the instances in an OverlayInstanceList.
+///
+/// Each kind of shape has its own vertex and index buffers that are made once. The instances for
+/// a frame are copied into a single instance buffer with one map, and each kind of shape is then
+/// drawn with one instanced draw call no matter how many copies of it there are.
+
+#pragma once
+
+#include <cstdint>
+#include <wrl/client.h>
+#include <d3d11.h>
+
+#include "OverlayInstanceList.h"
+
+namespace trview
+{
+    struct ICamera;
+    struct ILevelTextureStorage;
+
+    namespace graphics
+    {
+        struct IShader;
+        struct IShaderStorage;
+        class Device;
+    }
+
+    /// Draws the instances in an OverlayInstanceList.
+    class OverlayRenderer final
+    {
+    public:
+        /// Create a new overlay renderer.
+        /// @param device The device to create the buffers with.
+        /// @param shader_storage The shader storage instance.
+        explicit OverlayRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage);
+
+        /// Draw the instances.
+        /// @param device The device to use to render.
+        /// @param camera The current camera.
+        /// @param texture_storage The current level texture storage instance.
+        /// @param instances The instances to draw.
+        void render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, const OverlayInstanceList& instances);
+    private:
+        /// The buffers for one kind of shape.
+        struct Geometry
+        {
+            Microsoft::WRL::ComPtr<ID3D11Buffer> vertex_buffer;
+            Microsoft::WRL::ComPtr<ID3D11Buffer> index_buffer;
+            uint32_t                             index_count{ 0u };
+        };
+
+        void create_geometry(const graphics::Device& device);
+
+        /// Make sure that the instance buffer can hold at least this many instances.
+        /// @param device The device to create the buffer with.
+        /// @param count The number of instances.
+        void reserve_instances(const graphics::Device& device, std::size_t count);
+
+        Geometry                             _geometry[static_cast<uint32_t>(OverlayInstanceList::Primitive::Count)];
+        Microsoft::WRL::ComPtr<ID3D11Buffer> _instance_buffer;
+        std::size_t                          _instance_capacity{ 0u };
+        Microsoft::WRL::ComPtr<ID3D11Buffer> _matrix_buffer;
+        graphics::IShader*                   _vertex_shader;
+    };
+}
@@ -13,39 +13,34 @@ namespace trview
     {
         _sector = sector;
         _room_offset = room_offset;
-        _mesh.reset();
+        _corners.clear();
     }
 
-    void SectorHighlight::render(graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage)
+    void SectorHighlight::render(OverlayInstanceList& overlays)
     {
         if (!_sector)
         {
             return;
         }
 
-        if (!_mesh)
+        if (_corners.empty())
         {
-            auto triangles = _sector->triangles();
-            auto c1 = (triangles[1] - triangles[0]).Cross(triangles[2] - triangles[0]);
-            auto c2 = (triangles[4] - triangles[3]).Cross(triangles[5] - triangles[3]);
+            // Move each triangle slightly off the floor so that it isn't hidden by the floor.
+            _corners = _sector->triangles();
+            auto c1 = (_corners[1] - _corners[0]).Cross(_corners[2] - _corners[0]);
+            auto c2 = (_corners[4] - _corners[3]).Cross(_corners[5] - _corners[3]);
 
             c1.Normalize();
             c2.Normalize();
 
-            const std::vector<MeshVertex> vertices
+            for (int i = 0; i < 3; ++i)
             {
-                { triangles[0] - c1 * 0.05f, Vector3::Down, {0, 0}, Highlight_Colour },
-                { triangles[1] - c1 * 0.05f, Vector3::Down, {0, 0}, Highlight_Colour },
-                { triangles[2] - c1 * 0.05f, Vector3::Down, {0, 0}, Highlight_Colour },
-                { triangles[3] - c2 * 0.05f, Vector3::Down, {0, 0}, Highlight_Colour },
-                { triangles[4] - c2 * 0.05f, Vector3::Down, {0, 0}, Highlight_Colour },
-                { triangles[5] - c2 * 0.05f, Vector3::Down, {0, 0}, Highlight_Colour }
-            };
-
-            const std::vector<uint32_t> indices{ 0,  1,  2,  3,  4,  5, };
-            _mesh = std::make_unique<Mesh>(device, vertices, std::vector<std::vector<uint32_t>>(), indices, std::vector<TransparentTriangle>(), std::vector<Triangle>());
+                _corners[i] -= c1 * 0.05f;
+                _corners[i + 3] -= c2 * 0.05f;
+            }
         }
 
-        _mesh->render(device.context(), _room_offset * camera.view_projection(), texture_storage, Color(1,1,1));
+        overlays.add_triangle(_corners[0], _corners[1], _corners[2], _room_offset, Highlight_Colour);
+        overlays.add_triangle(_corners[3], _corners[4], _corners[5], _room_offset, Highlight_Colour);
     }
 }
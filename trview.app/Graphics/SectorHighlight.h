@@ -1,11 +1,9 @@
 #pragma once
 
 #include <cstdint>
-#include <trview.graphics/Device.h>
-#include <trview.app/Geometry/Mesh.h>
+#include <memory>
 #include <trview.app/Elements/Sector.h>
-#include <trview.app/Camera/ICamera.h>
-#include "ILevelTextureStorage.h"
+#include "OverlayInstanceList.h"
 
 namespace trview
 {
@@ -13,10 +11,10 @@ namespace trview
     {
     public:
         void set_sector(const std::shared_ptr<Sector>& sector, const DirectX::SimpleMath::Matrix& room_offset);
-        void render(graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage);
+        void render(OverlayInstanceList& overlays);
     private:
         DirectX::SimpleMath::Matrix _room_offset;
         std::shared_ptr<Sector> _sector;
-        std::unique_ptr<Mesh> _mesh;
+        std::vector<DirectX::SimpleMath::Vector3> _corners;
     };
 }
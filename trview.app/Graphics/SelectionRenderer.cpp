@@ -2,9 +2,12 @@
 #include <trview.graphics/IShaderStorage.h>
 #include <trview.graphics/IShader.h>
 #include <trview.graphics/RenderTarget.h>
+#include <trview.graphics/RenderTargetPool.h>
 #include <trview.graphics/RenderTargetStore.h>
 #include <trview.graphics/VertexShaderStore.h>
 #include <trview.graphics/PixelShaderStore.h>
+#include <trview.common/ContentKey.h>
+#include <trview.common/Profiler.h>
 #include <SimpleMath.h>
 #include <trview.app/Elements/Trigger.h>
 
@@ -12,6 +15,8 @@
 #include <trview.app/Camera/ICamera.h>
 #include "ILevelTextureStorage.h"
 
+#include <algorithm>
+
 using namespace Microsoft::WRL;
 using namespace DirectX::SimpleMath;
 
@@ -35,16 +40,53 @@ namespace trview
             double _; // Padding.
             Color outline_colour;
         }; 
+
+        /// The number of objects to keep silhouettes for. The level has an item and a trigger selected at most.
+        const std::size_t Max_Silhouettes = 4;
+
+        /// Get a key for everything about the camera that changes how an object is drawn.
+        uint64_t view_key(const ICamera& camera)
+        {
+            ContentKey key;
+            key.add(camera.view_projection())
+                .add(camera.position())
+                .add(camera.forward())
+                .add(camera.up())
+                .add(camera.view_size());
+            return key.value();
+        }
     }
 
     SelectionRenderer::SelectionRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage)
+        : _device(device)
     {
         _pixel_shader = shader_storage.get("selection_pixel_shader");
         _vertex_shader = shader_storage.get("ui_vertex_shader");
-        _transparency = std::make_unique<TransparencyBuffer>(device);
         create_buffers(device);
     }
 
+    SelectionRenderer::~SelectionRenderer()
+    {
+        clear();
+    }
+
+    void SelectionRenderer::clear()
+    {
+        for (auto& silhouette : _silhouettes)
+        {
+            _device.render_target_pool().release(std::move(silhouette.second.texture));
+        }
+        _silhouettes.clear();
+    }
+
+    void SelectionRenderer::invalidate()
+    {
+        for (auto& silhouette : _silhouettes)
+        {
+            silhouette.second.stale = true;
+        }
+    }
+
     void SelectionRenderer::create_buffers(const graphics::Device& device)
     {
         const SelectionVertex vertices[] =
@@ -81,16 +123,22 @@ namespace trview
 
         hr = device.device()->CreateBuffer(&index_desc, &index_data, &_index_buffer);
 
+        // Since we don't require any kind of scaling (we just want to fill the viewport), identity matrix is fine
+        // for scale. This never changes, so it is set when the buffer is created.
         using namespace DirectX::SimpleMath;
         D3D11_BUFFER_DESC desc;
         memset(&desc, 0, sizeof(desc));
 
         desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
         desc.ByteWidth = sizeof(MeshData);
-        desc.Usage = D3D11_USAGE_DYNAMIC;
-        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        desc.Usage = D3D11_USAGE_IMMUTABLE;
 
-        device.device()->CreateBuffer(&desc, nullptr, _matrix_buffer.GetAddressOf());
+        const MeshData matrix_data{ Matrix::Identity, Color(1,1,1,1), Vector4::Zero };
+        D3D11_SUBRESOURCE_DATA matrix_initial_data;
+        memset(&matrix_initial_data, 0, sizeof(matrix_initial_data));
+        matrix_initial_data.pSysMem = &matrix_data;
+
+        device.device()->CreateBuffer(&desc, &matrix_initial_data, _matrix_buffer.GetAddressOf());
 
         using namespace DirectX::SimpleMath;
         D3D11_BUFFER_DESC scale_desc;
@@ -104,59 +152,96 @@ namespace trview
         device.device()->CreateBuffer(&scale_desc, nullptr, _scale_buffer.GetAddressOf());
     }
 
-    void SelectionRenderer::render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, IRenderable& selected_item, const DirectX::SimpleMath::Color& outline_colour)
+    void SelectionRenderer::update_vertices(const ComPtr<ID3D11DeviceContext>& context, const Vector2& uv)
     {
-        auto context = device.context();
-
-        // Get viewport size - this is used for checking if the texture size needs to change and for
-        // scaling the coordinates that the pixel shader uses for the edge detection.
-        uint32_t num_viewports = 1;
-        D3D11_VIEWPORT viewport;
-        context->RSGetViewports(&num_viewports, &viewport);
+        const SelectionVertex vertices[] =
+        {
+            { Vector3(-1.0f, 1.0f, 0.0f), Vector2::Zero },
+            { Vector3(1.0f, 1.0f, 0.0f), Vector2(uv.x, 0) },
+            { Vector3(-1.0f, -1.0f, 0.0f), Vector2(0, uv.y) },
+            { Vector3(1.0f, -1.0f, 0.0f), uv }
+        };
+        context->UpdateSubresource(_vertex_buffer.Get(), 0, nullptr, vertices, 0, 0);
+        _uv = uv;
+    }
 
-        // If the texture hasn't been made yet or the size needs to change, re-create the texture.
-        if (!_texture || _texture->size() != Size(viewport.Width, viewport.Height))
+    SelectionRenderer::Silhouette& SelectionRenderer::find_silhouette(const IRenderable& item)
+    {
+        auto found = _silhouettes.find(&item);
+        if (found == _silhouettes.end())
         {
-            _texture = std::make_unique<RenderTarget>(device, static_cast<uint32_t>(viewport.Width), static_cast<uint32_t>(viewport.Height), RenderTarget::DepthStencilMode::Enabled);
+            if (_silhouettes.size() >= Max_Silhouettes)
+            {
+                auto oldest = std::min_element(_silhouettes.begin(), _silhouettes.end(),
+                    [](const auto& l, const auto& r) { return l.second.last_used < r.second.last_used; });
+                _device.render_target_pool().release(std::move(oldest->second.texture));
+                _silhouettes.erase(oldest);
+            }
+
+            found = _silhouettes.emplace(&item, Silhouette()).first;
+            found->second.transparency = std::make_unique<TransparencyBuffer>(_device);
         }
 
-        // Render the item (all regular faces and transparent faces) to a render target.
+        found->second.last_used = ++_renders;
+        return found->second;
+    }
+
+    void SelectionRenderer::render_silhouette(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, IRenderable& item, Silhouette& silhouette)
+    {
+        auto context = device.context();
+
+        // If the texture hasn't been made yet or the size needs to change, get a texture of the right size from
+        // the pool. The texture can be larger than the view, so only the used part of it is sampled.
+        const auto& view_size = camera.view_size();
+        if (!silhouette.texture || silhouette.texture->size() != view_size)
         {
-            // Clear the render target with red. This also clears depth. Start rendering to the render target.
-            graphics::RenderTargetStore store(context);
-            _texture->clear(context, Color(1.0f, 0.0f, 0.0f, 1.0f));
-            _texture->apply(context);
-
-            // Draw the regular faces of the item with a black colouring.
-            selected_item.render(device, camera, texture_storage, Color(0.0f, 0.0f, 0.0f));
-
-            // Also render the transparent parts of the meshes, again with black.
-            _transparency->reset();
-            selected_item.get_transparent_triangles(*_transparency, camera, Color(0.0f, 0.0f, 0.0f));
-            _transparency->sort(camera.rendering_position());
-            _transparency->render(context, camera, texture_storage, true);
+            device.render_target_pool().resize(silhouette.texture, static_cast<uint32_t>(view_size.width), static_cast<uint32_t>(view_size.height), RenderTarget::DepthStencilMode::Enabled);
         }
 
-        // Set vertex shader parameters. Since we don't require any kind of scaling (we just want to fill the viewport), 
-        // identity matrix is fine for scale.
+        // Clear the render target with red. This also clears depth. Start rendering to the render target.
+        graphics::RenderTargetStore store(context);
+        silhouette.texture->clear(context, Color(1.0f, 0.0f, 0.0f, 1.0f));
+        silhouette.texture->apply(context);
+
+        // Draw the regular faces of the item with a black colouring.
+        item.render(device, camera, texture_storage, Color(0.0f, 0.0f, 0.0f));
+
+        // Also render the transparent parts of the meshes, again with black. Every triangle is the same colour
+        // so the order that they are drawn in doesn't change the result and they don't have to be sorted.
+        silhouette.transparency->reset();
+        item.get_transparent_triangles(*silhouette.transparency, camera, Color(0.0f, 0.0f, 0.0f));
+        silhouette.transparency->complete();
+        silhouette.transparency->render(context, camera, texture_storage, true);
+    }
+
+    void SelectionRenderer::render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, IRenderable& selected_item, const DirectX::SimpleMath::Color& outline_colour)
+    {
+        auto context = device.context();
+
+        // The silhouette only has to be drawn again if the camera or the object has changed since it was last drawn.
+        auto& silhouette = find_silhouette(selected_item);
+        const auto key = view_key(camera);
+        if (!silhouette.texture || silhouette.stale || silhouette.view_key != key)
         {
-            D3D11_MAPPED_SUBRESOURCE mapped_resource;
-            memset(&mapped_resource, 0, sizeof(mapped_resource));
+            render_silhouette(device, camera, texture_storage, selected_item, silhouette);
+            silhouette.view_key = key;
+            silhouette.stale = false;
+        }
 
-            MeshData data{ Matrix::Identity, Color(1,1,1,1), Vector4::Zero };
-            context->Map(_matrix_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
-            memcpy(mapped_resource.pData, &data, sizeof(data));
-            context->Unmap(_matrix_buffer.Get(), 0);
+        if (silhouette.texture->active_uv() != _uv)
+        {
+            update_vertices(context, silhouette.texture->active_uv());
         }
 
-        // Set the pixel shader parameters. It only needs to know about the width and height of the viewport, so it knows
+        // Set the pixel shader parameters. It only needs to know about the width and height of the texture, so it knows
         // what coordinates to use to the get the next pixel over.
         {
             D3D11_MAPPED_SUBRESOURCE mapped_resource;
             memset(&mapped_resource, 0, sizeof(mapped_resource));
 
-            PS_Data data{ 1.0f / viewport.Width, 1.0f / viewport.Height, 0, outline_colour };
+            PS_Data data{ 1.0f / silhouette.texture->texture_width(), 1.0f / silhouette.texture->texture_height(), 0, outline_colour };
             context->Map(_scale_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+            profile_count(ProfileCounter::BufferMaps);
             memcpy(mapped_resource.pData, &data, sizeof(data));
             context->Unmap(_scale_buffer.Get(), 0);
         }
@@ -170,7 +255,7 @@ namespace trview
         _vertex_shader->apply(context);
         _pixel_shader->apply(context);
         
-        context->PSSetShaderResources(0, 1, _texture->texture().view().GetAddressOf());
+        context->PSSetShaderResources(0, 1, silhouette.texture->texture().view().GetAddressOf());
         UINT stride = sizeof(SelectionVertex);
         UINT offset = 0;
         context->IASetVertexBuffers(0, 1, _vertex_buffer.GetAddressOf(), &stride, &offset);
@@ -179,6 +264,7 @@ namespace trview
         context->PSSetConstantBuffers(0, 1, _scale_buffer.GetAddressOf());
         context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
         context->DrawIndexed(4, 0, 0);
+        profile_count(ProfileCounter::DrawCalls);
 
         context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     }
@@ -2,12 +2,15 @@
 /// @brief Draws an outline around an object.
 /// 
 /// Draws an outline around an object to help the user find the object and know which one
-/// is selected.
+/// is selected. The silhouette of each selected object is kept in its own render target and is
+/// only drawn again when the camera or the size of the view changes, so a frame that only
+/// redraws the scene for another reason just draws the outline from the kept silhouette.
 
 #pragma once
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <d3d11.h>
 #include <wrl/client.h>
 #include <SimpleMath.h>
@@ -38,24 +41,67 @@ namespace trview
         /// @param shader_storage The shader storage instance.
         explicit SelectionRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage);
 
+        /// Destructor for the SelectionRenderer. The render targets are returned to the device's pool.
+        ~SelectionRenderer();
+
         /// Render the outline around the specified object.
         /// @param context The device context.
         /// @param camera The current camera.
         /// @param texture_storage The current level texture storage instance.
         /// @param selected_item The entity to outline.
         void render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, IRenderable& selected_item, const DirectX::SimpleMath::Color& outline_colour);
+
+        /// Discard the silhouettes that have been kept. This must be called when an object that may have been
+        /// outlined has been changed, moved or destroyed.
+        void clear();
+
+        /// Mark the silhouettes that have been kept as out of date, so they are drawn again the next time they are
+        /// used. The render targets are kept. This should be called when objects change pose but still exist.
+        void invalidate();
     private:
+        /// The silhouette of an object that has been outlined.
+        struct Silhouette
+        {
+            std::unique_ptr<graphics::RenderTarget> texture;
+            std::unique_ptr<TransparencyBuffer>     transparency;
+            uint64_t                                view_key{ 0u };
+            uint64_t                                last_used{ 0u };
+            bool                                    stale{ false };
+        };
+
+        /// Find the kept silhouette for an object, or make a new one. If there are too many silhouettes the
+        /// one that was used the longest time ago is discarded.
+        /// @param item The object to find.
+        /// @returns The silhouette for the object.
+        Silhouette& find_silhouette(const IRenderable& item);
+
+        /// Draw the object in black on red into the silhouette.
+        /// @param device The device to use to render.
+        /// @param camera The current camera.
+        /// @param texture_storage The current level texture storage instance.
+        /// @param item The object to draw.
+        /// @param silhouette The silhouette to draw into.
+        void render_silhouette(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage, IRenderable& item, Silhouette& silhouette);
+
         /// Create vertex, index and parameter buffers.
         /// @param device The device to use to create the buffers.
         void create_buffers(const graphics::Device& device);
 
-        std::unique_ptr<graphics::RenderTarget> _texture;
-        std::unique_ptr<TransparencyBuffer> _transparency;
+        /// Update the texture coordinates of the quad so that only the used part of the render target is sampled.
+        /// @param context The device context.
+        /// @param uv The texture coordinates of the bottom right of the used area.
+        void update_vertices(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const DirectX::SimpleMath::Vector2& uv);
+
+        const graphics::Device& _device;
+
+        std::unordered_map<const IRenderable*, Silhouette> _silhouettes;
+        uint64_t _renders{ 0u };
         Microsoft::WRL::ComPtr<ID3D11Buffer> _vertex_buffer;
         Microsoft::WRL::ComPtr<ID3D11Buffer> _index_buffer;
         Microsoft::WRL::ComPtr<ID3D11Buffer> _matrix_buffer;
         Microsoft::WRL::ComPtr<ID3D11Buffer> _scale_buffer;
         graphics::IShader* _pixel_shader;
         graphics::IShader* _vertex_shader;
+        DirectX::SimpleMath::Vector2 _uv{ 1.0f, 1.0f };
     };
 }
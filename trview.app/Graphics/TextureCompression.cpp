@@ -0,0 +1,566 @@
+#define NOMINMAX
+#include "TextureCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+namespace trview
+{
+    namespace
+    {
+        /// The first value in saved textures. The last byte is the version, which is changed when the format changes.
+        const uint32_t Magic = 0x54564301;
+        /// The number of pixels along each side of a block.
+        const uint32_t Block_Width = 4;
+        /// The most levels a saved texture can have, to stop a bad file asking for lots of memory.
+        const uint32_t Max_Saved_Levels = 16;
+        /// The number of times to refine the principal axis of the colours of a block.
+        const uint32_t Axis_Iterations = 4;
+
+        uint32_t red(uint32_t pixel) { return pixel & 0xff; }
+        uint32_t green(uint32_t pixel) { return (pixel >> 8) & 0xff; }
+        uint32_t blue(uint32_t pixel) { return (pixel >> 16) & 0xff; }
+        uint32_t alpha(uint32_t pixel) { return pixel >> 24; }
+
+        uint32_t make_pixel(uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+        {
+            return r | (g << 8) | (b << 16) | (a << 24);
+        }
+
+        uint16_t to_565(float r, float g, float b)
+        {
+            auto quantise = [](float value, float levels)
+            {
+                return static_cast<uint16_t>(std::min(std::max(value, 0.0f), 255.0f) * levels / 255.0f + 0.5f);
+            };
+            return static_cast<uint16_t>((quantise(r, 31.0f) << 11) | (quantise(g, 63.0f) << 5) | quantise(b, 31.0f));
+        }
+
+        void from_565(uint16_t colour, uint32_t* rgb)
+        {
+            const uint32_t r = (colour >> 11) & 0x1f;
+            const uint32_t g = (colour >> 5) & 0x3f;
+            const uint32_t b = colour & 0x1f;
+            rgb[0] = (r << 3) | (r >> 2);
+            rgb[1] = (g << 2) | (g >> 4);
+            rgb[2] = (b << 3) | (b >> 2);
+        }
+
+        /// Work out the four colours of a colour block. When three_colour is set the third colour is half way
+        /// between the endpoints and the fourth is transparent black.
+        void colour_palette(uint16_t c0, uint16_t c1, bool three_colour, uint32_t* palette)
+        {
+            uint32_t e0[3];
+            uint32_t e1[3];
+            from_565(c0, e0);
+            from_565(c1, e1);
+            palette[0] = make_pixel(e0[0], e0[1], e0[2], 255);
+            palette[1] = make_pixel(e1[0], e1[1], e1[2], 255);
+            if (three_colour)
+            {
+                palette[2] = make_pixel((e0[0] + e1[0]) / 2, (e0[1] + e1[1]) / 2, (e0[2] + e1[2]) / 2, 255);
+                palette[3] = 0;
+            }
+            else
+            {
+                palette[2] = make_pixel((2 * e0[0] + e1[0]) / 3, (2 * e0[1] + e1[1]) / 3, (2 * e0[2] + e1[2]) / 3, 255);
+                palette[3] = make_pixel((e0[0] + 2 * e1[0]) / 3, (e0[1] + 2 * e1[1]) / 3, (e0[2] + 2 * e1[2]) / 3, 255);
+            }
+        }
+
+        uint32_t colour_distance(uint32_t l, uint32_t r)
+        {
+            const int dr = static_cast<int>(red(l)) - static_cast<int>(red(r));
+            const int dg = static_cast<int>(green(l)) - static_cast<int>(green(r));
+            const int db = static_cast<int>(blue(l)) - static_cast<int>(blue(r));
+            return static_cast<uint32_t>(dr * dr + dg * dg + db * db);
+        }
+
+        /// Compress the colour of a block to the 8 byte colour block used by BC1 and BC3.
+        /// @param pixels The 16 pixels of the block.
+        /// @param ignore_transparent Whether pixels with no alpha should be left out of the fit.
+        /// @param block Set to the 8 bytes of the colour block.
+        void encode_colour(const uint32_t* pixels, bool ignore_transparent, uint8_t* block)
+        {
+            float colours[16][3];
+            uint32_t count = 0;
+            float mean[3] = { 0, 0, 0 };
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                if (ignore_transparent && alpha(pixels[i]) == 0)
+                {
+                    continue;
+                }
+                colours[count][0] = static_cast<float>(red(pixels[i]));
+                colours[count][1] = static_cast<float>(green(pixels[i]));
+                colours[count][2] = static_cast<float>(blue(pixels[i]));
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    mean[c] += colours[count][c];
+                }
+                ++count;
+            }
+
+            std::fill(block, block + 8, static_cast<uint8_t>(0));
+            if (count == 0)
+            {
+                return;
+            }
+
+            float covariance[3][3] = {};
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                mean[c] /= count;
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                for (uint32_t a = 0; a < 3; ++a)
+                {
+                    for (uint32_t b = 0; b < 3; ++b)
+                    {
+                        covariance[a][b] += (colours[i][a] - mean[a]) * (colours[i][b] - mean[b]);
+                    }
+                }
+            }
+
+            // The principal axis is the direction that the colours are most spread out along.
+            float axis[3] = { 1.0f, 1.0f, 1.0f };
+            for (uint32_t iteration = 0; iteration < Axis_Iterations; ++iteration)
+            {
+                float next[3];
+                for (uint32_t a = 0; a < 3; ++a)
+                {
+                    next[a] = covariance[a][0] * axis[0] + covariance[a][1] * axis[1] + covariance[a][2] * axis[2];
+                }
+                const float length = std::max({ std::abs(next[0]), std::abs(next[1]), std::abs(next[2]) });
+                if (length == 0.0f)
+                {
+                    break;
+                }
+                for (uint32_t a = 0; a < 3; ++a)
+                {
+                    axis[a] = next[a] / length;
+                }
+            }
+
+            const float axis_length = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+            float min_t = 0.0f;
+            float max_t = 0.0f;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const float t = ((colours[i][0] - mean[0]) * axis[0] + (colours[i][1] - mean[1]) * axis[1] + (colours[i][2] - mean[2]) * axis[2]) / axis_length;
+                min_t = std::min(min_t, t);
+                max_t = std::max(max_t, t);
+            }
+
+            uint16_t c0 = to_565(mean[0] + axis[0] * max_t, mean[1] + axis[1] * max_t, mean[2] + axis[2] * max_t);
+            uint16_t c1 = to_565(mean[0] + axis[0] * min_t, mean[1] + axis[1] * min_t, mean[2] + axis[2] * min_t);
+
+            // The first endpoint has to be the larger one for the block to use four colours in BC1.
+            if (c0 < c1)
+            {
+                std::swap(c0, c1);
+            }
+
+            uint32_t indices = 0;
+            if (c0 != c1)
+            {
+                uint32_t palette[4];
+                colour_palette(c0, c1, false, palette);
+                for (uint32_t i = 0; i < 16; ++i)
+                {
+                    uint32_t best = 0;
+                    uint32_t best_distance = std::numeric_limits<uint32_t>::max();
+                    for (uint32_t p = 0; p < 4; ++p)
+                    {
+                        const uint32_t distance = colour_distance(pixels[i], palette[p]);
+                        if (distance < best_distance)
+                        {
+                            best_distance = distance;
+                            best = p;
+                        }
+                    }
+                    indices |= best << (2 * i);
+                }
+            }
+
+            block[0] = static_cast<uint8_t>(c0);
+            block[1] = static_cast<uint8_t>(c0 >> 8);
+            block[2] = static_cast<uint8_t>(c1);
+            block[3] = static_cast<uint8_t>(c1 >> 8);
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                block[4 + i] = static_cast<uint8_t>(indices >> (8 * i));
+            }
+        }
+
+        void decode_colour(const uint8_t* block, bool allow_three_colour, uint32_t* pixels)
+        {
+            const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+            const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+            uint32_t palette[4];
+            colour_palette(c0, c1, allow_three_colour && c0 <= c1, palette);
+
+            const uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32_t>(block[7]) << 24);
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                pixels[i] = palette[(indices >> (2 * i)) & 0x3];
+            }
+        }
+
+        /// Work out the eight alpha values of an alpha block. When a0 is not more than a1 there are six values
+        /// between the endpoints and the last two are 0 and 255.
+        void alpha_palette(uint32_t a0, uint32_t a1, uint32_t* palette)
+        {
+            palette[0] = a0;
+            palette[1] = a1;
+            if (a0 > a1)
+            {
+                for (uint32_t i = 1; i < 7; ++i)
+                {
+                    palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+                }
+            }
+            else
+            {
+                for (uint32_t i = 1; i < 5; ++i)
+                {
+                    palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+        }
+
+        /// Pick the nearest alpha value for each pixel.
+        /// @returns The total squared error.
+        uint32_t fit_alpha(const uint32_t* alphas, uint32_t a0, uint32_t a1, uint64_t& indices)
+        {
+            uint32_t palette[8];
+            alpha_palette(a0, a1, palette);
+
+            uint32_t error = 0;
+            indices = 0;
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                uint32_t best = 0;
+                uint32_t best_error = std::numeric_limits<uint32_t>::max();
+                for (uint32_t p = 0; p < 8; ++p)
+                {
+                    const int difference = static_cast<int>(alphas[i]) - static_cast<int>(palette[p]);
+                    const uint32_t squared = static_cast<uint32_t>(difference * difference);
+                    if (squared < best_error)
+                    {
+                        best_error = squared;
+                        best = p;
+                    }
+                }
+                error += best_error;
+                indices |= static_cast<uint64_t>(best) << (3 * i);
+            }
+            return error;
+        }
+
+        /// Compress the alpha of a block to the 8 byte alpha block used by BC3.
+        void encode_alpha(const uint32_t* pixels, uint8_t* block)
+        {
+            uint32_t alphas[16];
+            uint32_t min_alpha = 255;
+            uint32_t max_alpha = 0;
+            uint32_t min_inner = 255;
+            uint32_t max_inner = 0;
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                alphas[i] = alpha(pixels[i]);
+                min_alpha = std::min(min_alpha, alphas[i]);
+                max_alpha = std::max(max_alpha, alphas[i]);
+                if (alphas[i] != 0 && alphas[i] != 255)
+                {
+                    min_inner = std::min(min_inner, alphas[i]);
+                    max_inner = std::max(max_inner, alphas[i]);
+                }
+            }
+
+            // Eight values spread between the lowest and highest alpha.
+            uint32_t a0 = max_alpha;
+            uint32_t a1 = min_alpha;
+            uint64_t indices = 0;
+            uint32_t error = fit_alpha(alphas, a0, a1, indices);
+
+            // Six values spread between the lowest and highest alpha that aren't 0 or 255, with exact 0 and 255 as well.
+            if (error != 0)
+            {
+                if (min_inner > max_inner)
+                {
+                    min_inner = max_inner = 0;
+                }
+                uint64_t inner_indices = 0;
+                const uint32_t inner_error = fit_alpha(alphas, min_inner, max_inner, inner_indices);
+                if (inner_error < error)
+                {
+                    a0 = min_inner;
+                    a1 = max_inner;
+                    indices = inner_indices;
+                }
+            }
+
+            block[0] = static_cast<uint8_t>(a0);
+            block[1] = static_cast<uint8_t>(a1);
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                block[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+            }
+        }
+
+        template <typename T>
+        void write_value(std::ostream& stream, T value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        template <typename T>
+        bool read_value(std::istream& stream, T& value)
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+        }
+
+        uint32_t level_size(BlockFormat format, uint32_t width, uint32_t height)
+        {
+            return (width / Block_Width) * (height / Block_Width) * block_size(format);
+        }
+    }
+
+    uint32_t CompressedTexture::pitch(uint32_t level) const
+    {
+        return (levels[level].width / Block_Width) * block_size(format);
+    }
+
+    uint32_t block_size(BlockFormat format)
+    {
+        return format == BlockFormat::BC1 ? 8u : 16u;
+    }
+
+    std::vector<std::vector<uint32_t>> generate_mips(const std::vector<uint32_t>& pixels, uint32_t width, uint32_t height, uint32_t max_levels)
+    {
+        std::vector<std::vector<uint32_t>> levels{ pixels };
+        while (levels.size() < max_levels && (width > 1 || height > 1))
+        {
+            const uint32_t next_width = std::max(width / 2, 1u);
+            const uint32_t next_height = std::max(height / 2, 1u);
+            const auto& source = levels.back();
+            std::vector<uint32_t> next(next_width * next_height);
+
+            for (uint32_t y = 0; y < next_height; ++y)
+            {
+                for (uint32_t x = 0; x < next_width; ++x)
+                {
+                    const uint32_t x0 = std::min(x * 2, width - 1);
+                    const uint32_t x1 = std::min(x * 2 + 1, width - 1);
+                    const uint32_t y0 = std::min(y * 2, height - 1);
+                    const uint32_t y1 = std::min(y * 2 + 1, height - 1);
+                    const uint32_t samples[4] = { source[y0 * width + x0], source[y0 * width + x1], source[y1 * width + x0], source[y1 * width + x1] };
+
+                    // Weight the colour of each pixel by its alpha so that transparent pixels don't add their colour.
+                    uint32_t total_alpha = 0;
+                    uint32_t weighted[3] = { 0, 0, 0 };
+                    uint32_t plain[3] = { 0, 0, 0 };
+                    for (const auto sample : samples)
+                    {
+                        const uint32_t a = alpha(sample);
+                        total_alpha += a;
+                        weighted[0] += red(sample) * a;
+                        weighted[1] += green(sample) * a;
+                        weighted[2] += blue(sample) * a;
+                        plain[0] += red(sample);
+                        plain[1] += green(sample);
+                        plain[2] += blue(sample);
+                    }
+
+                    if (total_alpha == 0)
+                    {
+                        next[y * next_width + x] = make_pixel((plain[0] + 2) / 4, (plain[1] + 2) / 4, (plain[2] + 2) / 4, 0);
+                    }
+                    else
+                    {
+                        const uint32_t half = total_alpha / 2;
+                        next[y * next_width + x] = make_pixel(
+                            (weighted[0] + half) / total_alpha,
+                            (weighted[1] + half) / total_alpha,
+                            (weighted[2] + half) / total_alpha,
+                            (total_alpha + 2) / 4);
+                    }
+                }
+            }
+
+            levels.push_back(std::move(next));
+            width = next_width;
+            height = next_height;
+        }
+        return levels;
+    }
+
+    void encode_bc1_block(const uint32_t* pixels, uint8_t* block)
+    {
+        encode_colour(pixels, false, block);
+    }
+
+    void encode_bc3_block(const uint32_t* pixels, uint8_t* block)
+    {
+        encode_alpha(pixels, block);
+        encode_colour(pixels, true, block + 8);
+    }
+
+    void decode_bc1_block(const uint8_t* block, uint32_t* pixels)
+    {
+        decode_colour(block, true, pixels);
+    }
+
+    void decode_bc3_block(const uint8_t* block, uint32_t* pixels)
+    {
+        decode_colour(block + 8, false, pixels);
+
+        uint32_t palette[8];
+        alpha_palette(block[0], block[1], palette);
+        uint64_t indices = 0;
+        for (uint32_t i = 0; i < 6; ++i)
+        {
+            indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+        }
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            pixels[i] = (pixels[i] & 0x00ffffff) | (palette[(indices >> (3 * i)) & 0x7] << 24);
+        }
+    }
+
+    CompressedTexture compress_texture(const std::vector<uint32_t>& pixels, uint32_t width, uint32_t height, uint32_t max_levels)
+    {
+        CompressedTexture texture;
+        texture.format = std::all_of(pixels.begin(), pixels.end(), [](uint32_t p) { return alpha(p) == 255; }) ? BlockFormat::BC1 : BlockFormat::BC3;
+
+        const uint32_t bytes = block_size(texture.format);
+        const auto mips = generate_mips(pixels, width, height, max_levels);
+        for (const auto& mip : mips)
+        {
+            if (width < Block_Width || height < Block_Width)
+            {
+                break;
+            }
+
+            CompressedTexture::Level level{ width, height, {} };
+            level.blocks.resize(level_size(texture.format, width, height));
+            uint8_t* block = level.blocks.data();
+            for (uint32_t y = 0; y < height; y += Block_Width)
+            {
+                for (uint32_t x = 0; x < width; x += Block_Width, block += bytes)
+                {
+                    uint32_t block_pixels[16];
+                    for (uint32_t row = 0; row < Block_Width; ++row)
+                    {
+                        std::copy_n(&mip[(y + row) * width + x], Block_Width, &block_pixels[row * Block_Width]);
+                    }
+
+                    if (texture.format == BlockFormat::BC1)
+                    {
+                        encode_bc1_block(block_pixels, block);
+                    }
+                    else
+                    {
+                        encode_bc3_block(block_pixels, block);
+                    }
+                }
+            }
+
+            texture.levels.push_back(std::move(level));
+            width /= 2;
+            height /= 2;
+        }
+        return texture;
+    }
+
+    bool matches_dimensions(const CompressedTexture& texture, uint32_t width, uint32_t height, uint32_t max_levels)
+    {
+        if (texture.levels.empty() || texture.levels.size() > max_levels)
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < texture.levels.size(); ++i)
+        {
+            const auto& level = texture.levels[i];
+            const uint32_t level_width = width >> i;
+            const uint32_t level_height = height >> i;
+            if (level.width != level_width || level.height != level_height ||
+                level_width < Block_Width || level_height < Block_Width ||
+                level.blocks.size() != level_size(texture.format, level_width, level_height))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void write_compressed_textures(std::ostream& stream, const std::vector<CompressedTexture>& textures)
+    {
+        write_value(stream, Magic);
+        write_value(stream, static_cast<uint32_t>(textures.size()));
+        for (const auto& texture : textures)
+        {
+            write_value(stream, static_cast<uint32_t>(texture.format));
+            write_value(stream, static_cast<uint32_t>(texture.levels.size()));
+            for (const auto& level : texture.levels)
+            {
+                write_value(stream, level.width);
+                write_value(stream, level.height);
+                stream.write(reinterpret_cast<const char*>(level.blocks.data()), level.blocks.size());
+            }
+        }
+    }
+
+    bool read_compressed_textures(std::istream& stream, std::vector<CompressedTexture>& textures)
+    {
+        textures.clear();
+
+        uint32_t magic = 0;
+        uint32_t count = 0;
+        if (!read_value(stream, magic) || magic != Magic || !read_value(stream, count))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            CompressedTexture texture;
+            uint32_t format = 0;
+            uint32_t levels = 0;
+            if (!read_value(stream, format) || format > static_cast<uint32_t>(BlockFormat::BC3) ||
+                !read_value(stream, levels) || levels > Max_Saved_Levels)
+            {
+                return false;
+            }
+            texture.format = static_cast<BlockFormat>(format);
+
+            for (uint32_t l = 0; l < levels; ++l)
+            {
+                CompressedTexture::Level level{ 0, 0, {} };
+                if (!read_value(stream, level.width) || !read_value(stream, level.height) ||
+                    level.width < Block_Width || level.height < Block_Width ||
+                    level.width > (1u << Max_Saved_Levels) || level.height > (1u << Max_Saved_Levels))
+                {
+                    return false;
+                }
+
+                level.blocks.resize(level_size(texture.format, level.width, level.height));
+                if (!stream.read(reinterpret_cast<char*>(level.blocks.data()), level.blocks.size()))
+                {
+                    return false;
+                }
+                texture.levels.push_back(std::move(level));
+            }
+            textures.push_back(std::move(texture));
+        }
+        return true;
+    }
+}
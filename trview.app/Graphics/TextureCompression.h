@@ -0,0 +1,111 @@
+/// @file TextureCompression.h
+/// @brief Builds mip chains for textures and compresses them to BC1 or BC3 blocks on the CPU.
+///
+/// Each level of the mip chain is made by averaging 2x2 pixels of the level above, weighting the
+/// colour of each pixel by its alpha so that transparent pixels don't bleed their colour into the
+/// pixels around them. Textures that are fully opaque are compressed to BC1, which is 8 bytes for
+/// each 4x4 block, and textures with any transparency to BC3, which is 16 bytes for each block.
+///
+/// The colour endpoints of each block are found along the principal axis of the colours in the
+/// block, ignoring pixels that are fully transparent as these are never seen. The alpha of a BC3
+/// block is tried with both alpha modes and the one with the smallest error is kept, as the mode
+/// that has exact 0 and 255 values suits colour keyed textures.
+///
+/// Pixels are 32 bit values with red in the lowest byte and alpha in the highest.
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace trview
+{
+    /// The type of blocks that a texture has been compressed to.
+    enum class BlockFormat : uint32_t
+    {
+        BC1,
+        BC3
+    };
+
+    /// A texture that has been compressed to blocks, with a mip chain.
+    struct CompressedTexture
+    {
+        /// One level of the mip chain.
+        struct Level
+        {
+            uint32_t             width;
+            uint32_t             height;
+            std::vector<uint8_t> blocks;
+        };
+
+        BlockFormat        format{ BlockFormat::BC1 };
+        std::vector<Level> levels;
+
+        /// Gets the number of bytes in each row of blocks of a level.
+        /// @param level The index of the level.
+        uint32_t pitch(uint32_t level) const;
+    };
+
+    /// Gets the number of bytes in a block of a format.
+    /// @param format The format.
+    uint32_t block_size(BlockFormat format);
+
+    /// Make the levels of a mip chain for a texture.
+    /// @param pixels The pixels of the texture.
+    /// @param width The width of the texture. This must be a power of two.
+    /// @param height The height of the texture. This must be a power of two.
+    /// @param max_levels The most levels to make, including the texture itself.
+    /// @returns The pixels of each level, starting with the texture itself.
+    std::vector<std::vector<uint32_t>> generate_mips(const std::vector<uint32_t>& pixels, uint32_t width, uint32_t height, uint32_t max_levels);
+
+    /// Compress a 4x4 block of opaque pixels to a BC1 block.
+    /// @param pixels The 16 pixels of the block, row by row.
+    /// @param block Set to the 8 bytes of the block.
+    void encode_bc1_block(const uint32_t* pixels, uint8_t* block);
+
+    /// Compress a 4x4 block of pixels to a BC3 block.
+    /// @param pixels The 16 pixels of the block, row by row.
+    /// @param block Set to the 16 bytes of the block.
+    void encode_bc3_block(const uint32_t* pixels, uint8_t* block);
+
+    /// Decompress a BC1 block.
+    /// @param block The 8 bytes of the block.
+    /// @param pixels Set to the 16 pixels of the block, row by row.
+    void decode_bc1_block(const uint8_t* block, uint32_t* pixels);
+
+    /// Decompress a BC3 block.
+    /// @param block The 16 bytes of the block.
+    /// @param pixels Set to the 16 pixels of the block, row by row.
+    void decode_bc3_block(const uint8_t* block, uint32_t* pixels);
+
+    /// Make a mip chain for a texture and compress each level.
+    /// @param pixels The pixels of the texture.
+    /// @param width The width of the texture. This must be a power of two and at least 4.
+    /// @param height The height of the texture. This must be a power of two and at least 4.
+    /// @param max_levels The most levels to make, including the texture itself. Levels smaller than a block are not made.
+    /// @returns The compressed texture.
+    CompressedTexture compress_texture(const std::vector<uint32_t>& pixels, uint32_t width, uint32_t height, uint32_t max_levels);
+
+    /// Check that a compressed texture is the size that is expected, with a mip chain like the one that
+    /// compress_texture makes. Textures that were loaded from a file are checked before they are used so
+    /// that a texture of a different size can't be read past the end of its blocks.
+    /// @param texture The texture to check.
+    /// @param width The width that the texture should be.
+    /// @param height The height that the texture should be.
+    /// @param max_levels The most levels that the texture should have.
+    /// @returns True if the first level is width by height, each level after it is half the size of the one
+    ///          before it, there are no more than max_levels levels and each level has the right number of blocks.
+    bool matches_dimensions(const CompressedTexture& texture, uint32_t width, uint32_t height, uint32_t max_levels);
+
+    /// Save compressed textures.
+    /// @param stream The stream to write to.
+    /// @param textures The textures to save.
+    void write_compressed_textures(std::ostream& stream, const std::vector<CompressedTexture>& textures);
+
+    /// Load compressed textures that were saved with write_compressed_textures.
+    /// @param stream The stream to read from.
+    /// @param textures Set to the textures that were loaded.
+    /// @returns True if the textures were loaded, false if the stream was not valid.
+    bool read_compressed_textures(std::istream& stream, std::vector<CompressedTexture>& textures);
+}
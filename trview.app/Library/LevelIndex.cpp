@@ -0,0 +1,336 @@
+#include "LevelIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <istream>
+#include <ostream>
+
+namespace trview
+{
+    namespace
+    {
+        /// The first line of a saved index. The number is changed when the format changes.
+        const std::string Header = "trview level index 2";
+        /// The separator between folders in the paths of the levels.
+        const char Separator = '\\';
+        /// The number of values on each line of a saved index.
+        const std::size_t Fields = 11;
+
+        bool starts_with(const std::string& value, const std::string& prefix)
+        {
+            return value.compare(0, prefix.size(), prefix) == 0;
+        }
+
+        /// Whether a path that starts with the prefix of a folder is in a folder in that folder.
+        bool in_subfolder(const std::string& path, const std::string& prefix)
+        {
+            return path.find(Separator, prefix.size()) != std::string::npos;
+        }
+
+        std::string to_lower(std::string value)
+        {
+            std::transform(value.begin(), value.end(), value.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+            return value;
+        }
+
+        bool entry_before(const LevelIndexEntry& entry, const std::string& path)
+        {
+            return entry.file.path < path;
+        }
+
+        std::vector<std::string> split(const std::string& value, char separator)
+        {
+            std::vector<std::string> parts;
+            std::size_t start = 0;
+            while (true)
+            {
+                const std::size_t end = value.find(separator, start);
+                parts.push_back(value.substr(start, end - start));
+                if (end == std::string::npos)
+                {
+                    return parts;
+                }
+                start = end + 1;
+            }
+        }
+
+        template <typename T>
+        void write_values(std::ostream& stream, const std::vector<T>& values)
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                stream << (i ? "," : "") << values[i];
+            }
+            stream << '\t';
+        }
+
+        template <typename T>
+        std::vector<T> read_values(const std::string& value)
+        {
+            std::vector<T> values;
+            if (!value.empty())
+            {
+                for (const auto& part : split(value, ','))
+                {
+                    values.push_back(static_cast<T>(std::stoi(part)));
+                }
+            }
+            return values;
+        }
+    }
+
+    std::string normalise_folder(const std::string& folder)
+    {
+        std::string path = folder;
+        std::replace(path.begin(), path.end(), '/', Separator);
+        while (!path.empty() && path.back() == Separator)
+        {
+            path.pop_back();
+        }
+        return path;
+    }
+
+    std::string LevelIndexEntry::friendly_name() const
+    {
+        const std::size_t pos = file.path.find_last_of("\\/");
+        return pos == std::string::npos ? file.path : file.path.substr(pos + 1);
+    }
+
+    std::vector<LevelFile> LevelIndex::merge(const std::string& folder, std::vector<LevelFile> files, bool recursive)
+    {
+        const std::string prefix = normalise_folder(folder) + Separator;
+        files.erase(std::remove_if(files.begin(), files.end(), [&](const auto& file) { return !starts_with(file.path, prefix); }), files.end());
+        std::sort(files.begin(), files.end(), [](const auto& l, const auto& r) { return l.path < r.path; });
+        files.erase(std::unique(files.begin(), files.end(), [](const auto& l, const auto& r) { return l.path == r.path; }), files.end());
+
+        // The levels in the folder are next to each other as the entries are in order of path.
+        const auto begin = std::lower_bound(_entries.begin(), _entries.end(), prefix, entry_before);
+        auto end = begin;
+        while (end != _entries.end() && starts_with(end->file.path, prefix))
+        {
+            ++end;
+        }
+
+        std::vector<LevelIndexEntry> merged;
+        merged.reserve(files.size());
+        std::vector<LevelFile> changed;
+
+        // Levels that weren't found are only kept if they are in a folder that wasn't scanned.
+        auto keep_unscanned = [&](auto& entry)
+        {
+            if (!recursive && in_subfolder(entry.file.path, prefix))
+            {
+                merged.push_back(std::move(entry));
+            }
+            else
+            {
+                _search.remove(entry.file.path);
+            }
+        };
+
+        auto existing = begin;
+        for (const auto& file : files)
+        {
+            for (; existing != end && existing->file.path < file.path; ++existing)
+            {
+                keep_unscanned(*existing);
+            }
+
+            if (existing != end && existing->file.path == file.path)
+            {
+                const bool unchanged = existing->file.size == file.size && existing->file.modified == file.modified;
+                if (unchanged && existing->status != LevelIndexEntry::Status::Pending)
+                {
+                    merged.push_back(std::move(*existing++));
+                    continue;
+                }
+                _search.remove(existing->file.path);
+                ++existing;
+            }
+
+            LevelIndexEntry entry;
+            entry.file = file;
+            merged.push_back(entry);
+            changed.push_back(file);
+        }
+
+        for (; existing != end; ++existing)
+        {
+            keep_unscanned(*existing);
+        }
+
+        const auto position = _entries.erase(begin, end);
+        _entries.insert(position, std::make_move_iterator(merged.begin()), std::make_move_iterator(merged.end()));
+        return changed;
+    }
+
+    bool LevelIndex::set_summary(const LevelFile& file, const trlevel::LevelSummary& summary)
+    {
+        auto entry = find_entry(file);
+        if (!entry)
+        {
+            return false;
+        }
+        entry->status = LevelIndexEntry::Status::Indexed;
+        entry->summary = summary;
+        _search.add(file.path, summary);
+        return true;
+    }
+
+    bool LevelIndex::set_failed(const LevelFile& file)
+    {
+        auto entry = find_entry(file);
+        if (!entry)
+        {
+            return false;
+        }
+        entry->status = LevelIndexEntry::Status::Failed;
+        entry->summary = {};
+        _search.remove(file.path);
+        return true;
+    }
+
+    std::vector<LevelIndexEntry> LevelIndex::in_folder(const std::string& folder) const
+    {
+        const std::string prefix = normalise_folder(folder) + Separator;
+        std::vector<LevelIndexEntry> entries;
+        for (auto entry = std::lower_bound(_entries.begin(), _entries.end(), prefix, entry_before);
+            entry != _entries.end() && starts_with(entry->file.path, prefix); ++entry)
+        {
+            if (!in_subfolder(entry->file.path, prefix))
+            {
+                entries.push_back(*entry);
+            }
+        }
+        return entries;
+    }
+
+    std::vector<LevelIndexEntry> LevelIndex::find(const LevelFilter& filter) const
+    {
+        std::vector<SearchTerm> terms;
+        if (filter.version != trlevel::LevelVersion::Unknown)
+        {
+            terms.push_back({ SearchTerm::Kind::Version, static_cast<uint16_t>(filter.version) });
+        }
+        if (filter.entity_type)
+        {
+            terms.push_back({ SearchTerm::Kind::EntityType, static_cast<uint16_t>(filter.entity_type.value()) });
+        }
+        if (filter.trigger_command)
+        {
+            terms.push_back({ SearchTerm::Kind::TriggerCommand, filter.trigger_command.value() });
+        }
+        if (filter.static_mesh)
+        {
+            terms.push_back({ SearchTerm::Kind::StaticMesh, filter.static_mesh.value() });
+        }
+
+        // The search index only has the levels that have been summarised, so every level it finds is indexed.
+        const std::string name = to_lower(filter.name);
+        std::vector<LevelIndexEntry> entries;
+        for (const auto& path : _search.find(terms))
+        {
+            const auto entry = std::lower_bound(_entries.begin(), _entries.end(), path, entry_before);
+            if (entry != _entries.end() && entry->file.path == path &&
+                (name.empty() || to_lower(entry->friendly_name()).find(name) != std::string::npos))
+            {
+                entries.push_back(*entry);
+            }
+        }
+        return entries;
+    }
+
+    std::size_t LevelIndex::size() const
+    {
+        return _entries.size();
+    }
+
+    void LevelIndex::read(std::istream& stream)
+    {
+        _entries.clear();
+        _search.clear();
+
+        std::string line;
+        if (!std::getline(stream, line) || line != Header)
+        {
+            return;
+        }
+
+        while (std::getline(stream, line))
+        {
+            const auto fields = split(line, '\t');
+            if (fields.size() != Fields || fields[10].empty())
+            {
+                continue;
+            }
+
+            try
+            {
+                const int status = std::stoi(fields[0]);
+                if (status < static_cast<int>(LevelIndexEntry::Status::Pending) || status > static_cast<int>(LevelIndexEntry::Status::Failed))
+                {
+                    continue;
+                }
+
+                LevelIndexEntry entry;
+                entry.status = static_cast<LevelIndexEntry::Status>(status);
+                entry.file.size = std::stoull(fields[1]);
+                entry.file.modified = std::stoull(fields[2]);
+                entry.summary.version = static_cast<trlevel::LevelVersion>(std::stoi(fields[3]));
+                entry.summary.rooms = std::stoul(fields[4]);
+                entry.summary.entities = std::stoul(fields[5]);
+                entry.summary.triggers = std::stoul(fields[6]);
+                entry.summary.entity_types = read_values<int16_t>(fields[7]);
+                entry.summary.trigger_commands = read_values<uint16_t>(fields[8]);
+                entry.summary.static_meshes = read_values<uint16_t>(fields[9]);
+                entry.file.path = fields[10];
+                _entries.push_back(entry);
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+
+        std::sort(_entries.begin(), _entries.end(), [](const auto& l, const auto& r) { return l.file.path < r.file.path; });
+        _entries.erase(std::unique(_entries.begin(), _entries.end(), [](const auto& l, const auto& r) { return l.file.path == r.file.path; }), _entries.end());
+
+        for (const auto& entry : _entries)
+        {
+            if (entry.status == LevelIndexEntry::Status::Indexed)
+            {
+                _search.add(entry.file.path, entry.summary);
+            }
+        }
+    }
+
+    void LevelIndex::write(std::ostream& stream) const
+    {
+        stream << Header << '\n';
+        for (const auto& entry : _entries)
+        {
+            stream << static_cast<int>(entry.status) << '\t'
+                << entry.file.size << '\t'
+                << entry.file.modified << '\t'
+                << static_cast<int>(entry.summary.version) << '\t'
+                << entry.summary.rooms << '\t'
+                << entry.summary.entities << '\t'
+                << entry.summary.triggers << '\t';
+            write_values(stream, entry.summary.entity_types);
+            write_values(stream, entry.summary.trigger_commands);
+            write_values(stream, entry.summary.static_meshes);
+            stream << entry.file.path << '\n';
+        }
+    }
+
+    LevelIndexEntry* LevelIndex::find_entry(const LevelFile& file)
+    {
+        auto entry = std::lower_bound(_entries.begin(), _entries.end(), file.path, entry_before);
+        if (entry == _entries.end() || entry->file.path != file.path ||
+            entry->file.size != file.size || entry->file.modified != file.modified)
+        {
+            return nullptr;
+        }
+        return &*entry;
+    }
+}
@@ -0,0 +1,129 @@
+/// @file LevelIndex.h
+/// @brief A record of the levels that have been found in a library of levels and a summary of each one.
+///
+/// Levels are found by scanning folders, and the size and the time that each file was last written
+/// are kept with the summary. When a folder is scanned again only the levels that have been added
+/// or changed need to be loaded to be summarised, so the index can be kept up to date with a large
+/// library without loading every level each time. The entries are kept in order of path, so the
+/// levels in a folder are next to each other and can be found with a binary search.
+///
+/// What is in each level is also kept in a LevelSearchIndex, so finding the levels that have a
+/// particular entity, trigger command or static mesh doesn't have to look at every level.
+///
+/// The index is saved as one line of tab separated values for each level, as it can have tens of
+/// thousands of entries and this can be read and written quickly.
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <trlevel/LevelSummary.h>
+#include "LevelSearchIndex.h"
+
+namespace trview
+{
+    /// A level file that was found when scanning a folder.
+    struct LevelFile
+    {
+        std::string path;
+        uint64_t    size{ 0u };
+        /// The time that the file was last written to.
+        uint64_t    modified{ 0u };
+    };
+
+    /// A level in the index.
+    struct LevelIndexEntry
+    {
+        enum class Status
+        {
+            /// The level has been found but has not been summarised yet.
+            Pending,
+            /// The level has been summarised.
+            Indexed,
+            /// The level could not be loaded.
+            Failed
+        };
+
+        LevelFile            file;
+        Status               status{ Status::Pending };
+        trlevel::LevelSummary summary;
+
+        /// Gets the name of the file without the folder.
+        std::string friendly_name() const;
+    };
+
+    /// The conditions that a level has to meet to be found by LevelIndex::find. Conditions that are
+    /// not set match every level.
+    struct LevelFilter
+    {
+        /// Part of the file name, which is matched ignoring case.
+        std::string             name;
+        trlevel::LevelVersion   version{ trlevel::LevelVersion::Unknown };
+        /// A type of entity that has to be in the level.
+        std::optional<int16_t>  entity_type;
+        /// A type of trigger command, matching TriggerCommandType, that has to be used in the level.
+        std::optional<uint16_t> trigger_command;
+        /// A static mesh that has to be placed in the level.
+        std::optional<uint16_t> static_mesh;
+    };
+
+    /// Convert a folder to the form used for paths in the index, with '\\' between folders and no separator at the end.
+    /// @param folder The folder to convert.
+    /// @returns The converted folder.
+    std::string normalise_folder(const std::string& folder);
+
+    /// A record of the levels that have been found in a library of levels and a summary of each one.
+    class LevelIndex final
+    {
+    public:
+        /// Merge the result of scanning a folder into the index. Levels in the folder that were not found
+        /// are removed, and levels that are new or have changed since they were summarised are added as pending.
+        /// @param folder The folder that was scanned.
+        /// @param files The levels that were found.
+        /// @param recursive Whether the folders in the folder were also scanned. If not, the levels in these
+        ///                  folders are left as they are.
+        /// @returns The levels that need to be summarised.
+        std::vector<LevelFile> merge(const std::string& folder, std::vector<LevelFile> files, bool recursive);
+
+        /// Set the summary of a level. This is ignored if the level has been removed or has changed since the
+        /// file was found.
+        /// @param file The level that was summarised.
+        /// @param summary The summary of the level.
+        /// @returns True if the index was changed.
+        bool set_summary(const LevelFile& file, const trlevel::LevelSummary& summary);
+
+        /// Record that a level could not be loaded, so that it is not loaded again until it changes.
+        /// @param file The level that could not be loaded.
+        /// @returns True if the index was changed.
+        bool set_failed(const LevelFile& file);
+
+        /// Gets the levels that are directly in a folder, in order of path.
+        /// @param folder The folder to get the levels for.
+        std::vector<LevelIndexEntry> in_folder(const std::string& folder) const;
+
+        /// Gets the levels that have been summarised and match a filter, in order of path.
+        /// @param filter The conditions that the levels have to meet.
+        std::vector<LevelIndexEntry> find(const LevelFilter& filter) const;
+
+        /// Gets the number of levels in the index.
+        std::size_t size() const;
+
+        /// Replace the contents of the index with an index that was saved with write. Lines that can't be
+        /// read are skipped, and if the stream is not an index the index is left empty.
+        /// @param stream The stream to read from.
+        void read(std::istream& stream);
+
+        /// Save the index.
+        /// @param stream The stream to write to.
+        void write(std::ostream& stream) const;
+    private:
+        LevelIndexEntry* find_entry(const LevelFile& file);
+
+        std::vector<LevelIndexEntry> _entries;
+        LevelSearchIndex             _search;
+    };
+}
@@ -0,0 +1,335 @@
+#define NOMINMAX
+#include "LevelIndexer.h"
+
+#include <windows.h>
+#include <ShlObj.h>
+#include <algorithm>
+#include <cwctype>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <trlevel/LevelSummary.h>
+#include <trview.common/Strings.h>
+
+namespace trview
+{
+    namespace
+    {
+        /// The number of changes to the index that can be made before it is saved while there is still work to do.
+        const uint32_t Save_Interval = 100;
+        /// The most threads that will be used to summarise levels. Each one has a whole level loaded at once.
+        const uint32_t Max_Threads = 8;
+
+        struct SafePath
+        {
+            wchar_t* path;
+            ~SafePath()
+            {
+                if (path)
+                {
+                    CoTaskMemFree(path);
+                }
+            }
+        };
+
+        /// Whether a file name has one of the level extensions - .TR* or .PHD.
+        bool is_level(const std::wstring& name)
+        {
+            const std::size_t dot = name.find_last_of(L'.');
+            if (dot == std::wstring::npos)
+            {
+                return false;
+            }
+
+            std::wstring extension = name.substr(dot);
+            std::transform(extension.begin(), extension.end(), extension.begin(), std::towlower);
+            return extension.compare(0, 3, L".tr") == 0 || extension == L".phd";
+        }
+
+        uint64_t combine(DWORD high, DWORD low)
+        {
+            return (static_cast<uint64_t>(high) << 32) | low;
+        }
+
+        /// Find the levels in a folder.
+        /// @param folder The folder to search.
+        /// @param recursive Whether to search the folders in the folder as well.
+        /// @param files The levels that are found are added to this.
+        void find_levels(const std::wstring& folder, bool recursive, std::vector<LevelFile>& files)
+        {
+            WIN32_FIND_DATA data;
+            HANDLE find = FindFirstFile((folder + L"\\*").c_str(), &data);
+            if (find == INVALID_HANDLE_VALUE)
+            {
+                return;
+            }
+
+            do
+            {
+                const std::wstring name(data.cFileName);
+                if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                {
+                    // Links are not followed so that a link to a parent folder can't make the scan go round in circles.
+                    if (recursive && name != L"." && name != L".." && !(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+                    {
+                        find_levels(folder + L"\\" + name, recursive, files);
+                    }
+                }
+                else if (is_level(name))
+                {
+                    files.push_back(
+                        {
+                            to_utf8(folder + L"\\" + name),
+                            combine(data.nFileSizeHigh, data.nFileSizeLow),
+                            combine(data.ftLastWriteTime.dwHighDateTime, data.ftLastWriteTime.dwLowDateTime)
+                        });
+                }
+            } while (FindNextFile(find, &data) != 0);
+
+            FindClose(find);
+        }
+    }
+
+    LevelIndexer::LevelIndexer(const std::wstring& index_path, uint32_t threads, std::function<void()> on_changed)
+        : _on_changed(on_changed), _index_path(index_path)
+    {
+        if (threads == 0)
+        {
+            threads = std::min(std::max(std::thread::hardware_concurrency(), 1u), Max_Threads);
+        }
+        for (uint32_t i = 0; i < threads; ++i)
+        {
+            _threads.emplace_back(&LevelIndexer::run, this);
+        }
+    }
+
+    LevelIndexer::~LevelIndexer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _condition.notify_all();
+        for (auto& thread : _threads)
+        {
+            thread.join();
+        }
+        save();
+    }
+
+    std::wstring LevelIndexer::default_index_path()
+    {
+        SafePath path;
+        if (S_OK != SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &path.path))
+        {
+            return std::wstring();
+        }
+
+        std::wstring file_path(path.path);
+        file_path += L"\\trview";
+        if (!CreateDirectory(file_path.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
+        {
+            return std::wstring();
+        }
+        return file_path + L"\\levels.txt";
+    }
+
+    void LevelIndexer::scan(const std::string& folder, bool recursive, bool summarise)
+    {
+        const std::string path = normalise_folder(folder);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _scans.erase(std::remove_if(_scans.begin(), _scans.end(),
+                [&](const auto& scan) { return scan.folder == path && scan.recursive == recursive && scan.summarise == summarise; }), _scans.end());
+            _scans.push_front({ path, recursive, summarise });
+        }
+        _condition.notify_all();
+    }
+
+    void LevelIndexer::update()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_changed)
+            {
+                return;
+            }
+            _changed = false;
+        }
+        on_index_changed();
+    }
+
+    bool LevelIndexer::busy() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return !_loaded || _working || !_scans.empty() || !_to_summarise.empty() || _changed;
+    }
+
+    void LevelIndexer::wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [&] { return _loaded && !_working && _scans.empty() && _to_summarise.empty(); });
+    }
+
+    std::vector<LevelIndexEntry> LevelIndexer::in_folder(const std::string& folder) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _index.in_folder(folder);
+    }
+
+    std::vector<LevelIndexEntry> LevelIndexer::find(const LevelFilter& filter) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _index.find(filter);
+    }
+
+    void LevelIndexer::run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            _condition.wait(lock, [&] { return _stop || _load_pending || (_loaded && (!_scans.empty() || !_to_summarise.empty())); });
+            if (_stop)
+            {
+                return;
+            }
+
+            if (_load_pending)
+            {
+                load(lock);
+                continue;
+            }
+
+            ++_working;
+            if (!_scans.empty())
+            {
+                const Scan scan = _scans.front();
+                _scans.pop_front();
+                lock.unlock();
+
+                std::vector<LevelFile> files;
+                find_levels(to_utf16(scan.folder), scan.recursive, files);
+
+                lock.lock();
+                // The levels that have just been found are summarised first, as these are the ones being looked at.
+                // Levels that aren't summarised stay pending, so a later scan that summarises will find them.
+                const auto changed = _index.merge(scan.folder, std::move(files), scan.recursive);
+                if (scan.summarise)
+                {
+                    _to_summarise.insert(_to_summarise.begin(), changed.begin(), changed.end());
+                }
+                set_changed();
+                ++_unsaved;
+                _condition.notify_all();
+            }
+            else
+            {
+                const LevelFile level = _to_summarise.front();
+                _to_summarise.pop_front();
+                lock.unlock();
+
+                std::optional<trlevel::LevelSummary> summary;
+                try
+                {
+                    summary = trlevel::summarise_level(level.path);
+                }
+                catch (...)
+                {
+                    // Anything that stops the level loading means it can't be summarised.
+                }
+
+                lock.lock();
+                if (summary ? _index.set_summary(level, summary.value()) : _index.set_failed(level))
+                {
+                    set_changed();
+                    ++_unsaved;
+                }
+            }
+            --_working;
+
+            const bool idle = !_working && _scans.empty() && _to_summarise.empty();
+            if (_unsaved >= Save_Interval || (idle && _unsaved))
+            {
+                lock.unlock();
+                save();
+                lock.lock();
+            }
+
+            if (idle)
+            {
+                _condition.notify_all();
+            }
+        }
+    }
+
+    void LevelIndexer::load(std::unique_lock<std::mutex>& lock)
+    {
+        // The index is read without holding the lock, so the viewer isn't held up if it asks for levels.
+        // Nothing else changes the index until it has been loaded.
+        _load_pending = false;
+        lock.unlock();
+
+        LevelIndex index;
+        bool read = false;
+        if (!_index_path.empty())
+        {
+            std::ifstream file(_index_path);
+            if (file.is_open())
+            {
+                index.read(file);
+                read = true;
+            }
+        }
+
+        lock.lock();
+        if (read)
+        {
+            _index = std::move(index);
+            set_changed();
+        }
+        _loaded = true;
+        _condition.notify_all();
+    }
+
+    void LevelIndexer::set_changed()
+    {
+        _changed = true;
+        if (_on_changed)
+        {
+            _on_changed();
+        }
+    }
+
+    void LevelIndexer::save()
+    {
+        // Only one thread writes the file at a time, and the index is written out in the order that it
+        // was copied so that an older copy can't replace a newer one.
+        std::lock_guard<std::mutex> save_lock(_save_mutex);
+
+        // The index is written to a string while holding the lock and then to the file without it, so
+        // that the viewer isn't held up by the disk.
+        std::ostringstream contents;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_index_path.empty() || !_unsaved)
+            {
+                return;
+            }
+            _index.write(contents);
+            _unsaved = 0;
+        }
+
+        // Write to another file and then replace the index, so that the saved index isn't lost if the
+        // viewer stops part of the way through writing it.
+        const std::wstring temporary_path = _index_path + L".tmp";
+        {
+            std::ofstream file(temporary_path);
+            if (!file.is_open() || !(file << contents.str()))
+            {
+                return;
+            }
+        }
+        MoveFileEx(temporary_path.c_str(), _index_path.c_str(), MOVEFILE_REPLACE_EXISTING);
+    }
+}
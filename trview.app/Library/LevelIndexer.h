@@ -0,0 +1,107 @@
+/// @file LevelIndexer.h
+/// @brief Keeps a LevelIndex up to date on a background thread.
+///
+/// Folders are scanned and the levels that are new or have changed are loaded and summarised on
+/// background threads, so that large libraries can be indexed without holding up the viewer. Levels
+/// are summarised on several threads at once, as each level is loaded and summarised on its own. The
+/// viewer saves the index in the user's local app data folder, and it is loaded on a background thread
+/// when the indexer is created, so levels that have already been summarised can be listed soon after.
+/// Tools that index their own folders use an indexer with no index file, so the viewer's index isn't changed.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <trview.common/Event.h>
+#include "LevelIndex.h"
+
+namespace trview
+{
+    /// Keeps a LevelIndex up to date on background threads.
+    class LevelIndexer final
+    {
+    public:
+        /// Create a new indexer and start the background threads. The saved index is loaded on one of the
+        /// threads before any folders are scanned.
+        /// @param index_path The file to load the index from and save it to. If this is empty the index starts
+        ///                   empty and isn't saved.
+        /// @param threads The number of threads to summarise levels on, or 0 to use one for each core, up to a limit.
+        /// @param on_changed Called on a background thread when the index has changed, so that the thread that
+        ///                   calls update can be woken up to raise on_index_changed.
+        explicit LevelIndexer(const std::wstring& index_path, uint32_t threads = 0u, std::function<void()> on_changed = {});
+
+        /// Get the path of the index that the viewer uses, creating the folder that it is in if it doesn't exist.
+        /// @returns The path or an empty string if there is nowhere to save the index.
+        static std::wstring default_index_path();
+
+        /// Stops the background threads, waiting for any levels being summarised, and saves the index.
+        ~LevelIndexer();
+
+        /// Request that a folder is scanned. Levels in the folder that is scanned most recently are
+        /// summarised before levels found by earlier scans.
+        /// @param folder The folder to scan.
+        /// @param recursive Whether to scan the folders in the folder as well.
+        /// @param summarise Whether to load and summarise the levels that are new or have changed. If not,
+        ///                  they are listed in the index as pending until a scan that summarises them.
+        void scan(const std::string& folder, bool recursive, bool summarise = true);
+
+        /// Raise on_index_changed if the index has changed since this was last called. This should be
+        /// called regularly on the thread that on_index_changed should be raised on.
+        void update();
+
+        /// Gets whether there are folders waiting to be scanned or levels waiting to be summarised.
+        bool busy() const;
+
+        /// Wait until every folder has been scanned and every level that was found has been summarised.
+        void wait();
+
+        /// Gets the levels that are directly in a folder, in order of path.
+        /// @param folder The folder to get the levels for.
+        std::vector<LevelIndexEntry> in_folder(const std::string& folder) const;
+
+        /// Gets the levels that have been summarised and match a filter, in order of path.
+        /// @param filter The conditions that the levels have to meet.
+        std::vector<LevelIndexEntry> find(const LevelFilter& filter) const;
+
+        /// Event raised when levels have been added to, removed from or summarised in the index.
+        Event<> on_index_changed;
+    private:
+        struct Scan
+        {
+            std::string folder;
+            bool        recursive;
+            bool        summarise;
+        };
+
+        void run();
+        void load(std::unique_lock<std::mutex>& lock);
+        void save();
+
+        /// Mark the index as changed so that update raises on_index_changed. The lock must be held.
+        void set_changed();
+
+        std::function<void()>    _on_changed;
+        mutable std::mutex       _mutex;
+        /// Held while the index is saved, so that only one thread writes the file at a time.
+        std::mutex               _save_mutex;
+        std::condition_variable  _condition;
+        LevelIndex               _index;
+        std::wstring             _index_path;
+        std::deque<Scan>         _scans;
+        std::deque<LevelFile>    _to_summarise;
+        uint32_t                 _working{ 0u };
+        bool                     _load_pending{ true };
+        bool                     _loaded{ false };
+        bool                     _changed{ false };
+        uint32_t                 _unsaved{ 0u };
+        bool                     _stop{ false };
+        std::vector<std::thread> _threads;
+    };
+}
@@ -0,0 +1,169 @@
+#include "LevelSearchIndex.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace trview
+{
+    namespace
+    {
+        /// The fewest removed levels there have to be before the levels are numbered again.
+        const std::size_t Min_Removed_To_Compact = 64;
+
+        uint32_t key(SearchTerm::Kind kind, uint16_t value)
+        {
+            return (static_cast<uint32_t>(kind) << 16) | value;
+        }
+
+        template <typename T>
+        void add_keys(std::vector<uint32_t>& keys, SearchTerm::Kind kind, const std::vector<T>& values)
+        {
+            for (const auto& value : values)
+            {
+                keys.push_back(key(kind, static_cast<uint16_t>(value)));
+            }
+        }
+    }
+
+    void LevelSearchIndex::add(const std::string& path, const trlevel::LevelSummary& summary)
+    {
+        remove(path);
+
+        std::vector<uint32_t> keys{ key(SearchTerm::Kind::Version, static_cast<uint16_t>(summary.version)) };
+        add_keys(keys, SearchTerm::Kind::EntityType, summary.entity_types);
+        add_keys(keys, SearchTerm::Kind::TriggerCommand, summary.trigger_commands);
+        add_keys(keys, SearchTerm::Kind::StaticMesh, summary.static_meshes);
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        const auto number = static_cast<uint32_t>(_paths.size());
+        for (const auto k : keys)
+        {
+            _postings[k].push_back(number);
+        }
+        _numbers.emplace(path, number);
+        _paths.push_back(path);
+        _keys.push_back(std::move(keys));
+    }
+
+    void LevelSearchIndex::remove(const std::string& path)
+    {
+        const auto found = _numbers.find(path);
+        if (found == _numbers.end())
+        {
+            return;
+        }
+
+        const uint32_t number = found->second;
+        for (const auto k : _keys[number])
+        {
+            auto& levels = _postings[k];
+            levels.erase(std::lower_bound(levels.begin(), levels.end(), number));
+            if (levels.empty())
+            {
+                _postings.erase(k);
+            }
+        }
+        _numbers.erase(found);
+        _paths[number].clear();
+        _keys[number].clear();
+
+        const std::size_t removed = _paths.size() - _numbers.size();
+        if (removed >= Min_Removed_To_Compact && removed > _numbers.size())
+        {
+            compact();
+        }
+    }
+
+    void LevelSearchIndex::clear()
+    {
+        _postings.clear();
+        _numbers.clear();
+        _paths.clear();
+        _keys.clear();
+    }
+
+    std::vector<std::string> LevelSearchIndex::find(const std::vector<SearchTerm>& terms) const
+    {
+        std::vector<std::string> paths;
+        if (terms.empty())
+        {
+            paths.reserve(_numbers.size());
+            std::copy_if(_paths.begin(), _paths.end(), std::back_inserter(paths), [](const auto& path) { return !path.empty(); });
+        }
+        else
+        {
+            std::vector<const std::vector<uint32_t>*> lists;
+            for (const auto& term : terms)
+            {
+                const auto found = _postings.find(key(term.kind, term.value));
+                if (found == _postings.end())
+                {
+                    return paths;
+                }
+                lists.push_back(&found->second);
+            }
+
+            // Start with the shortest list so that the intersection is as small as possible from the start.
+            std::sort(lists.begin(), lists.end(), [](const auto& l, const auto& r) { return l->size() < r->size(); });
+            std::vector<uint32_t> levels(*lists.front());
+            std::vector<uint32_t> next;
+            for (std::size_t i = 1; i < lists.size() && !levels.empty(); ++i)
+            {
+                next.clear();
+                std::set_intersection(levels.begin(), levels.end(), lists[i]->begin(), lists[i]->end(), std::back_inserter(next));
+                levels.swap(next);
+            }
+
+            paths.reserve(levels.size());
+            for (const auto number : levels)
+            {
+                paths.push_back(_paths[number]);
+            }
+        }
+
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+    std::size_t LevelSearchIndex::size() const
+    {
+        return _numbers.size();
+    }
+
+    std::size_t LevelSearchIndex::num_terms() const
+    {
+        return _postings.size();
+    }
+
+    void LevelSearchIndex::compact()
+    {
+        // Levels keep the same order when they are numbered again, so the lists stay in order.
+        std::vector<uint32_t> renumbered(_paths.size());
+        std::vector<std::string> paths;
+        std::vector<std::vector<uint32_t>> keys;
+        paths.reserve(_numbers.size());
+        keys.reserve(_numbers.size());
+        for (uint32_t i = 0; i < _paths.size(); ++i)
+        {
+            if (!_paths[i].empty())
+            {
+                renumbered[i] = static_cast<uint32_t>(paths.size());
+                _numbers[_paths[i]] = renumbered[i];
+                paths.push_back(std::move(_paths[i]));
+                keys.push_back(std::move(_keys[i]));
+            }
+        }
+
+        for (auto& posting : _postings)
+        {
+            for (auto& number : posting.second)
+            {
+                number = renumbered[number];
+            }
+        }
+
+        _paths.swap(paths);
+        _keys.swap(keys);
+    }
+}
@@ -0,0 +1,74 @@
+/// @file LevelSearchIndex.h
+/// @brief An inverted index of what is in each level of a library of levels.
+///
+/// For each game version, entity type, trigger command type and static mesh there is a list of
+/// the levels that have it, so the levels that have everything that is being searched for can be
+/// found by intersecting a few lists instead of looking at every level. Each level is given a number
+/// when it is added, and as numbers only go up the lists stay in order by appending to them. When
+/// enough levels have been removed the levels are numbered again to keep the lists short.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <trlevel/LevelSummary.h>
+
+namespace trview
+{
+    /// Something that a level can be searched for.
+    struct SearchTerm
+    {
+        enum class Kind : uint16_t
+        {
+            /// The value is a trlevel::LevelVersion.
+            Version,
+            /// The value is an entity type ID.
+            EntityType,
+            /// The value is a trigger command type, matching TriggerCommandType.
+            TriggerCommand,
+            /// The value is a static mesh ID.
+            StaticMesh
+        };
+
+        Kind     kind;
+        uint16_t value;
+    };
+
+    /// An inverted index of what is in each level of a library of levels.
+    class LevelSearchIndex final
+    {
+    public:
+        /// Add a level to the index, replacing it if it is already in the index.
+        /// @param path The path of the level.
+        /// @param summary The summary of the level.
+        void add(const std::string& path, const trlevel::LevelSummary& summary);
+
+        /// Remove a level from the index if it is in the index.
+        /// @param path The path of the level.
+        void remove(const std::string& path);
+
+        /// Remove all levels from the index.
+        void clear();
+
+        /// Find the levels that match all of the terms.
+        /// @param terms The terms to search for.
+        /// @returns The paths of the levels, in order. If there are no terms every level is returned.
+        std::vector<std::string> find(const std::vector<SearchTerm>& terms) const;
+
+        /// Gets the number of levels in the index.
+        std::size_t size() const;
+
+        /// Gets the number of different terms that the levels in the index have.
+        std::size_t num_terms() const;
+    private:
+        void compact();
+
+        std::unordered_map<uint32_t, std::vector<uint32_t>> _postings; // Term key to level numbers, in order.
+        std::unordered_map<std::string, uint32_t>            _numbers;  // Path to level number.
+        std::vector<std::string>                             _paths;    // Path for each level number, empty once removed.
+        std::vector<std::vector<uint32_t>>                   _keys;     // Term keys for each level number.
+    };
+}
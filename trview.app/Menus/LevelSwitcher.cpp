@@ -1,7 +1,7 @@
 #include "LevelSwitcher.h"
 #include <trview.app/Windows/WindowIDs.h>
-#include "DirectoryListing.h"
 #include <trview.common/Strings.h>
+#include <algorithm>
 
 namespace trview
 {
@@ -49,8 +49,10 @@ namespace trview
     }
 
     LevelSwitcher::LevelSwitcher(const Window& window)
-        : MessageHandler(window), _directory_listing_menu(create_directory_listing_menu(window))
+        : MessageHandler(window), _directory_listing_menu(create_directory_listing_menu(window)),
+        _indexer(LevelIndexer::default_index_path(), 1, [window = window.window()]() { PostMessage(window, WM_NULL, 0, 0); })
     {
+        _token_store += _indexer.on_index_changed += [&]() { populate_menu(); };
     }
 
     void LevelSwitcher::process_message(UINT message, WPARAM wParam, LPARAM)
@@ -60,8 +62,8 @@ namespace trview
             int wmId = LOWORD(wParam);
             if (wmId >= ID_SWITCHFILE_BASE && wmId <= (ID_SWITCHFILE_BASE + GetMenuItemCount(_directory_listing_menu)))
             {
-                const trview::File& f = _file_switcher_list.at(wmId - ID_SWITCHFILE_BASE);
-                on_switch_level(f.path);
+                const auto& entry = _file_switcher_list.at(wmId - ID_SWITCHFILE_BASE);
+                on_switch_level(entry.file.path);
             }
         }
     }
@@ -69,19 +71,44 @@ namespace trview
     void LevelSwitcher::open_file(const std::string& filepath)
     {
         const std::size_t pos = filepath.find_last_of("\\/");
-        const std::string folder = filepath.substr(0, pos);
-
-        DirectoryListing dir_lister(folder);
-        _file_switcher_list = dir_lister.GetFiles();
+        _folder = normalise_folder(filepath.substr(0, pos));
 
         // Enable menu when populating in case it's not enabled
         EnableMenuItem(GetMenu(window()), ID_APP_FILE_SWITCHLEVEL, MF_ENABLED);
 
+        // List the levels that are already in the index and then check whether the folder has changed.
+        _file_switcher_list.clear();
+        populate_menu();
+        // The menu only needs the names of the levels, so they aren't loaded to be summarised.
+        _indexer.scan(_folder, false, false);
+    }
+
+    void LevelSwitcher::update()
+    {
+        _indexer.update();
+    }
+
+    void LevelSwitcher::populate_menu()
+    {
+        if (_folder.empty())
+        {
+            return;
+        }
+
+        auto files = _indexer.in_folder(_folder);
+        const bool same = std::equal(files.begin(), files.end(), _file_switcher_list.begin(), _file_switcher_list.end(),
+            [](const auto& l, const auto& r) { return l.file.path == r.file.path; });
+        if (same && !_file_switcher_list.empty())
+        {
+            return;
+        }
+        _file_switcher_list = std::move(files);
+
         // Clear all items from menu and repopulate
         reset_menu(window(), _directory_listing_menu);
         for (auto i = 0u; i < _file_switcher_list.size(); ++i)
         {
-            AppendMenu(_directory_listing_menu, MF_STRING, ID_SWITCHFILE_BASE + static_cast<int>(i), to_utf16(_file_switcher_list[i].friendly_name).c_str());
+            AppendMenu(_directory_listing_menu, MF_STRING, ID_SWITCHFILE_BASE + static_cast<int>(i), to_utf16(_file_switcher_list[i].friendly_name()).c_str());
         }
 
         DrawMenuBar(window());
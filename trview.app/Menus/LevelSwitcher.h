@@ -2,12 +2,18 @@
 /// @brief When a file is loaded this will find other levels that are in the same
 ///        directory as that file and add them to a menu so the user can quickly
 ///        switch between levels.
+///
+/// The levels are taken from the level index, so a folder that has been opened before
+/// is listed straight away. The folder is scanned again in the background and the menu
+/// is updated if the levels in it have changed. The levels are only listed, not loaded, so
+/// opening a level doesn't load the other levels in the folder.
 
 #pragma once
 
 #include <trview.common/MessageHandler.h>
 #include <trview.common/Event.h>
-#include "DirectoryListing.h"
+#include <trview.common/TokenStore.h>
+#include <trview.app/Library/LevelIndexer.h>
 
 namespace trview
 {
@@ -34,11 +40,20 @@ namespace trview
         /// @param filename The file that was opened.
         void open_file(const std::string& filename);
 
+        /// Update the menu if the levels in the folder have changed. This should be called regularly. A message
+        /// is posted to the window when the levels have changed, so that a message loop that waits for messages
+        /// wakes up to call this.
+        void update();
+
         /// Event raised when the user switches level. The opened level is passed as a parameter.
         Event<std::string> on_switch_level;
     private:
+        void populate_menu();
 
-        HMENU             _directory_listing_menu;
-        std::vector<File> _file_switcher_list;
+        HMENU                        _directory_listing_menu;
+        std::vector<LevelIndexEntry> _file_switcher_list;
+        std::string                  _folder;
+        LevelIndexer                 _indexer;
+        TokenStore                   _token_store;
     };
 }
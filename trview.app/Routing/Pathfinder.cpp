@@ -0,0 +1,310 @@
+#define NOMINMAX
+#include "Pathfinder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        /// The scale of heights in the level data.
+        const float Height_Scale = 1024.0f;
+        /// The bits of the overlap index of a box that are the index. The others are flags.
+        const uint16_t Overlap_Index_Mask = 0x3fff;
+        /// The bits of an overlap value that are the index of a box.
+        const uint16_t Overlap_Box_Mask = 0x7fff;
+        /// Set on the last overlap value in the list of a box.
+        const uint16_t Overlap_End = 0x8000;
+
+        std::vector<trlevel::tr2_box> level_boxes(const trlevel::ILevel& level)
+        {
+            std::vector<trlevel::tr2_box> boxes;
+            boxes.reserve(level.num_boxes());
+            for (uint32_t i = 0; i < level.num_boxes(); ++i)
+            {
+                boxes.push_back(level.get_box(i));
+            }
+            return boxes;
+        }
+
+        std::vector<uint16_t> level_overlaps(const trlevel::ILevel& level)
+        {
+            std::vector<uint16_t> overlaps;
+            overlaps.reserve(level.num_overlaps());
+            for (uint32_t i = 0; i < level.num_overlaps(); ++i)
+            {
+                overlaps.push_back(level.get_overlap(i));
+            }
+            return overlaps;
+        }
+
+        uint32_t find_root(std::vector<uint32_t>& parents, uint32_t index)
+        {
+            while (parents[index] != index)
+            {
+                parents[index] = parents[parents[index]];
+                index = parents[index];
+            }
+            return index;
+        }
+
+        /// Pick the position on one axis of the edge between two boxes that is closest to a target.
+        /// When the boxes only touch on this axis the edge is a line and the position is on it, otherwise
+        /// the position is the centre of the sector along the edge that is closest to the target.
+        float crossing(float min, float max, float target)
+        {
+            if (max - min < 1.0f)
+            {
+                return (min + max) * 0.5f;
+            }
+            return std::floor(std::min(std::max(target, min), max - 0.5f)) + 0.5f;
+        }
+    }
+
+    Vector3 Pathfinder::Box::centre() const
+    {
+        return Vector3((x0 + x1) * 0.5f, floor, (z0 + z1) * 0.5f);
+    }
+
+    Pathfinder::Pathfinder(const std::vector<trlevel::tr2_box>& boxes, const std::vector<uint16_t>& overlaps, float max_step_up, float max_step_down)
+    {
+        _boxes.reserve(boxes.size());
+        for (const auto& box : boxes)
+        {
+            _boxes.push_back(
+                {
+                    static_cast<float>(box.Xmin),
+                    static_cast<float>(box.Xmax),
+                    static_cast<float>(box.Zmin),
+                    static_cast<float>(box.Zmax),
+                    box.TrueFloor / Height_Scale
+                });
+        }
+
+        build_connections(boxes, overlaps, max_step_up, max_step_down);
+        build_components();
+        _nodes.resize(_boxes.size());
+    }
+
+    Pathfinder::Pathfinder(const trlevel::ILevel& level, float max_step_up, float max_step_down)
+        : Pathfinder(level_boxes(level), level_overlaps(level), max_step_up, max_step_down)
+    {
+    }
+
+    uint32_t Pathfinder::num_boxes() const
+    {
+        return static_cast<uint32_t>(_boxes.size());
+    }
+
+    uint32_t Pathfinder::num_connections() const
+    {
+        return static_cast<uint32_t>(_connections.size());
+    }
+
+    bool Pathfinder::find_box(const Vector3& position, uint32_t& box) const
+    {
+        bool found = false;
+        float nearest = std::numeric_limits<float>::max();
+        for (uint32_t i = 0; i < _boxes.size(); ++i)
+        {
+            const auto& candidate = _boxes[i];
+            if (position.x < candidate.x0 || position.x >= candidate.x1 ||
+                position.z < candidate.z0 || position.z >= candidate.z1)
+            {
+                continue;
+            }
+
+            const float distance = std::abs(candidate.floor - position.y);
+            if (distance < nearest)
+            {
+                nearest = distance;
+                box = i;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    bool Pathfinder::connected(uint32_t from, uint32_t to) const
+    {
+        return from < _components.size() && to < _components.size() && _components[from] == _components[to];
+    }
+
+    std::vector<uint32_t> Pathfinder::find_box_path(uint32_t from, uint32_t to) const
+    {
+        if (!connected(from, to))
+        {
+            return {};
+        }
+        return search(from, to);
+    }
+
+    std::vector<Vector3> Pathfinder::find_path(const Vector3& from, const Vector3& to) const
+    {
+        uint32_t from_box = 0;
+        uint32_t to_box = 0;
+        if (!find_box(from, from_box) || !find_box(to, to_box) || !connected(from_box, to_box))
+        {
+            return {};
+        }
+
+        const auto boxes = search(from_box, to_box);
+        if (boxes.empty())
+        {
+            return {};
+        }
+
+        std::vector<Vector3> path{ from };
+        for (std::size_t i = 1; i < boxes.size(); ++i)
+        {
+            const auto& current = _boxes[boxes[i - 1]];
+            const auto& next = _boxes[boxes[i]];
+
+            // Aim for the goal, or the centre of the box after the next one if there is one, so
+            // that the path heads towards where it is going rather than through each box centre.
+            const auto target = i + 1 < boxes.size() ? _boxes[boxes[i + 1]].centre() : to;
+            const float x = crossing(std::max(current.x0, next.x0), std::min(current.x1, next.x1), target.x);
+            const float z = crossing(std::max(current.z0, next.z0), std::min(current.z1, next.z1), target.z);
+
+            path.emplace_back(x, current.floor, z);
+            if (next.floor != current.floor)
+            {
+                path.emplace_back(x, next.floor, z);
+            }
+        }
+        path.push_back(to);
+        return path;
+    }
+
+    std::vector<uint32_t> Pathfinder::search(uint32_t from, uint32_t to) const
+    {
+        if (++_generation == 0)
+        {
+            // The generation has wrapped around, so the old nodes could look current.
+            std::fill(_nodes.begin(), _nodes.end(), Node{});
+            _generation = 1;
+        }
+
+        const auto goal = _boxes[to].centre();
+
+        using Entry = std::pair<float, uint32_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+        _nodes[from] = { 0.0f, from, _generation, false };
+        open.emplace(Vector3::Distance(_boxes[from].centre(), goal), from);
+
+        while (!open.empty())
+        {
+            const uint32_t current = open.top().second;
+            open.pop();
+
+            auto& node = _nodes[current];
+            if (node.closed)
+            {
+                continue;
+            }
+            node.closed = true;
+
+            if (current == to)
+            {
+                std::vector<uint32_t> path;
+                for (uint32_t box = to; box != from; box = _nodes[box].parent)
+                {
+                    path.push_back(box);
+                }
+                path.push_back(from);
+                std::reverse(path.begin(), path.end());
+                return path;
+            }
+
+            const auto centre = _boxes[current].centre();
+            for (uint32_t c = _first_connection[current]; c < _first_connection[current + 1]; ++c)
+            {
+                const uint32_t next = _connections[c];
+                const auto next_centre = _boxes[next].centre();
+                const float cost = node.cost + Vector3::Distance(centre, next_centre);
+
+                auto& next_node = _nodes[next];
+                if (next_node.generation != _generation)
+                {
+                    next_node = { cost, current, _generation, false };
+                }
+                else if (next_node.closed || cost >= next_node.cost)
+                {
+                    continue;
+                }
+                else
+                {
+                    next_node.cost = cost;
+                    next_node.parent = current;
+                }
+                open.emplace(cost + Vector3::Distance(next_centre, goal), next);
+            }
+        }
+
+        return {};
+    }
+
+    void Pathfinder::build_connections(const std::vector<trlevel::tr2_box>& boxes, const std::vector<uint16_t>& overlaps, float max_step_up, float max_step_down)
+    {
+        _first_connection.reserve(boxes.size() + 1);
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            _first_connection.push_back(static_cast<uint32_t>(_connections.size()));
+
+            const auto& box = _boxes[i];
+            for (uint32_t o = boxes[i].OverlapIndex & Overlap_Index_Mask; o < overlaps.size(); ++o)
+            {
+                const uint32_t other = overlaps[o] & Overlap_Box_Mask;
+                if (other != i && other < _boxes.size())
+                {
+                    // Up is negative y, so the step up is how much lower the floor value is.
+                    const float step = box.floor - _boxes[other].floor;
+                    if (step <= max_step_up && -step <= max_step_down)
+                    {
+                        _connections.push_back(other);
+                    }
+                }
+
+                if (overlaps[o] & Overlap_End)
+                {
+                    break;
+                }
+            }
+        }
+        _first_connection.push_back(static_cast<uint32_t>(_connections.size()));
+    }
+
+    void Pathfinder::build_components()
+    {
+        // A connection can be used in one direction and not the other, so the components are the boxes
+        // that are connected in either direction. Boxes in different components can't have a path.
+        _components.resize(_boxes.size());
+        std::iota(_components.begin(), _components.end(), 0u);
+        for (uint32_t i = 0; i < _boxes.size(); ++i)
+        {
+            for (uint32_t c = _first_connection[i]; c < _first_connection[i + 1]; ++c)
+            {
+                const uint32_t a = find_root(_components, i);
+                const uint32_t b = find_root(_components, _connections[c]);
+                if (a != b)
+                {
+                    _components[std::max(a, b)] = std::min(a, b);
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < _boxes.size(); ++i)
+        {
+            _components[i] = find_root(_components, i);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/// @file Pathfinder.h
+/// @brief Finds walkable paths through a level using the boxes that the game AI navigates with.
+///
+/// Each box is a rectangle of sectors with a single floor height, and the overlaps list the boxes
+/// that can be moved to from each box. The boxes and the overlaps that are within the step limits
+/// form a graph that is searched with A*, with the distance between box centres as the cost and the
+/// straight line distance to the goal as the heuristic. The boxes that are connected at all are worked
+/// out once when the pathfinder is created, so a query between two parts of the level that can't be
+/// reached from each other fails straight away instead of searching every box.
+///
+/// The path through the boxes is then refined to sector level: the path crosses from one box to the
+/// next through the centre of the sector on the shared edge that is nearest to the goal, and steps
+/// up or down at the edge when the floors are at different heights.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SimpleMath.h>
+#include <trlevel/ILevel.h>
+
+namespace trview
+{
+    /// Finds walkable paths through a level.
+    ///
+    /// The queries are const but reuse the search state in _nodes and _generation, so a pathfinder
+    /// is not thread safe: it must only be queried from one thread at a time. Create a pathfinder
+    /// per thread to search in parallel.
+    class Pathfinder final
+    {
+    public:
+        /// The default height that a path can step up, in world units.
+        static constexpr float Default_Step_Up = 0.25f;
+        /// The default height that a path can step down, in world units.
+        static constexpr float Default_Step_Down = 0.25f;
+
+        /// Create a pathfinder from the boxes and overlaps of a level.
+        /// @param boxes The boxes, with the horizontal dimensions in sectors.
+        /// @param overlaps The overlap lists of the boxes.
+        /// @param max_step_up The highest that a path can step up from one box to the next, in world units.
+        /// @param max_step_down The furthest that a path can step down from one box to the next, in world units.
+        Pathfinder(const std::vector<trlevel::tr2_box>& boxes, const std::vector<uint16_t>& overlaps, float max_step_up = Default_Step_Up, float max_step_down = Default_Step_Down);
+
+        /// Create a pathfinder for a level.
+        /// @param level The level to use the boxes and overlaps from.
+        /// @param max_step_up The highest that a path can step up from one box to the next, in world units.
+        /// @param max_step_down The furthest that a path can step down from one box to the next, in world units.
+        explicit Pathfinder(const trlevel::ILevel& level, float max_step_up = Default_Step_Up, float max_step_down = Default_Step_Down);
+
+        /// Gets the number of boxes.
+        uint32_t num_boxes() const;
+
+        /// Gets the number of connections between boxes that are within the step limits.
+        uint32_t num_connections() const;
+
+        /// Find the box that a position is in. When more than one box is under or over the position
+        /// the one with the floor closest to the position is used.
+        /// @param position The position in the world.
+        /// @param box Set to the index of the box.
+        /// @returns True if the position is in a box.
+        bool find_box(const DirectX::SimpleMath::Vector3& position, uint32_t& box) const;
+
+        /// Determines whether there could be a path from one box to another. This is false if the boxes
+        /// are in parts of the level that aren't connected at all.
+        /// @param from The index of the first box.
+        /// @param to The index of the second box.
+        bool connected(uint32_t from, uint32_t to) const;
+
+        /// Find the shortest path between two boxes.
+        /// @param from The index of the box to start in.
+        /// @param to The index of the box to finish in.
+        /// @returns The boxes on the path, including the first and last boxes, or empty if there is no path.
+        std::vector<uint32_t> find_box_path(uint32_t from, uint32_t to) const;
+
+        /// Find the shortest walkable path between two positions.
+        /// @param from The position to start at.
+        /// @param to The position to finish at.
+        /// @returns The points on the path, including the start and finish, or empty if there is no path.
+        std::vector<DirectX::SimpleMath::Vector3> find_path(const DirectX::SimpleMath::Vector3& from, const DirectX::SimpleMath::Vector3& to) const;
+    private:
+        struct Box
+        {
+            float x0;
+            float x1;
+            float z0;
+            float z1;
+            float floor;
+
+            DirectX::SimpleMath::Vector3 centre() const;
+        };
+
+        struct Node
+        {
+            float    cost;
+            uint32_t parent;
+            uint32_t generation;
+            bool     closed;
+        };
+
+        /// A* search between box centres. The heuristic is the distance to the centre of the goal box, which is
+        /// what the path costs are measured to, so it never overestimates.
+        std::vector<uint32_t> search(uint32_t from, uint32_t to) const;
+        void build_connections(const std::vector<trlevel::tr2_box>& boxes, const std::vector<uint16_t>& overlaps, float max_step_up, float max_step_down);
+        void build_components();
+
+        std::vector<Box>      _boxes;
+        std::vector<uint32_t> _first_connection; // Index into _connections for each box, with one extra at the end.
+        std::vector<uint32_t> _connections;
+        std::vector<uint32_t> _components;
+
+        // Search state, kept between queries so that it doesn't have to be allocated and cleared
+        // for each one. A node is only valid if its generation matches the current generation.
+        mutable std::vector<Node> _nodes;
+        mutable uint32_t          _generation{ 0u };
+    };
+}
@@ -4,13 +4,11 @@
 #include <algorithm>
 #include <trview.app/Camera/ICamera.h>
 #include <trview.app/Graphics/ILevelTextureStorage.h>
-#pragma warning(push)
-#pragma warning(disable : 4127)
-#include <external/nlohmann/json.hpp>
-#pragma warning(pop)
 #include <fstream>
+#include <stdexcept>
 #include <trview.common/Strings.h>
-#include <sstream>
+#include "Pathfinder.h"
+#include "RouteFile.h"
 
 using namespace DirectX;
 using namespace DirectX::SimpleMath;
@@ -21,6 +19,12 @@ namespace trview
     {
         const float PoleThickness = 0.05f;
         const float RopeThickness = 0.015f;
+
+        /// Get the position of the blob at the bottom of a waypoint, which is where the ropes are attached.
+        Vector3 rope_position(const Vector3& waypoint)
+        {
+            return waypoint - Vector3(0, 0.5f + PoleThickness * 0.5f, 0);
+        }
     }
 
     Route::Route(const graphics::Device& device, const graphics::IShaderStorage& shader_storage)
@@ -35,7 +39,8 @@ namespace trview
 
     void Route::add(const DirectX::SimpleMath::Vector3& position, uint32_t room, Waypoint::Type type, uint32_t type_index)
     {
-        _waypoints.emplace_back(_waypoint_mesh.get(), position, room, type, type_index, _colour);
+        _waypoints.push_back(position, room, type, type_index);
+        waypoints_changed();
     }
 
     Colour Route::colour() const
@@ -47,6 +52,7 @@ namespace trview
     {
         _waypoints.clear();
         _selected_index = 0u;
+        waypoints_changed();
     }
 
     void Route::insert(const DirectX::SimpleMath::Vector3& position, uint32_t room, uint32_t index)
@@ -67,7 +73,8 @@ namespace trview
 
     void Route::insert(const DirectX::SimpleMath::Vector3& position, uint32_t room, uint32_t index, Waypoint::Type type, uint32_t type_index)
     {
-        _waypoints.insert(_waypoints.begin() + index, Waypoint(_waypoint_mesh.get(), position, room, type, type_index, _colour));
+        _waypoints.insert(index, position, room, type, type_index);
+        waypoints_changed();
     }
 
     uint32_t Route::insert(const DirectX::SimpleMath::Vector3& position, uint32_t room, Waypoint::Type type, uint32_t type_index)
@@ -82,11 +89,13 @@ namespace trview
         PickResult result;
         result.hit = false;
 
-        for (uint32_t i = 0; i < _waypoints.size(); ++i)
-        {
-            const auto& waypoint = _waypoints[i];
+        // Only the waypoints whose boxes the ray hits need to be tested against the pole.
+        update_index();
+        _index.query(position, direction, _hits);
 
-            auto box = BoundingBox(waypoint.position() - Vector3(0, 0.25f, 0), Vector3(PoleThickness, 0.5f, PoleThickness) * 0.5f);
+        for (const auto i : _hits)
+        {
+            auto box = BoundingBox(_waypoints.position(i) - Vector3(0, 0.25f, 0), Vector3(PoleThickness, 0.5f, PoleThickness) * 0.5f);
 
             float distance = 0;
             if (box.Intersects(position, direction, distance) && (!result.hit || distance < result.distance))
@@ -108,37 +117,59 @@ namespace trview
         {
             return;
         }
-        _waypoints.erase(_waypoints.begin() + index);
+        _waypoints.erase(index);
+        waypoints_changed();
         if (_selected_index >= index && _selected_index > 0)
         {
             --_selected_index;
         }
     }
 
-    void Route::render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage)
+    void Route::render(const ICamera& camera, OverlayInstanceList& overlays)
     {
-        for (std::size_t i = 0; i < _waypoints.size(); ++i)
+        update_index();
+        if (camera.projection_mode() == ProjectionMode::Orthographic)
         {
-            auto& waypoint = _waypoints[i];
-            waypoint.render(device, camera, texture_storage, Color(1.0f, 1.0f, 1.0f));
+            _visible.resize(_waypoints.size());
+            for (uint32_t i = 0; i < _visible.size(); ++i)
+            {
+                _visible[i] = i;
+            }
+        }
+        else
+        {
+            _index.query(camera.frustum(), _visible);
+        }
 
-            // Should render the in-between line somehow - if there is another point in the list.
-            if (i < _waypoints.size() - 1)
+        // The box of each waypoint also covers the rope to the next waypoint, so the rope is drawn with it.
+        const auto& positions = _waypoints.positions();
+        for (const auto i : _visible)
+        {
+            add_waypoint_instances(overlays, camera, positions[i], Color(1.0f, 1.0f, 1.0f), _colour);
+
+            if (i + 1 < positions.size())
             {
-                const auto current = waypoint.position() - Vector3(0, 0.5f + PoleThickness * 0.5f, 0);
-                const auto next_waypoint = _waypoints[i + 1].position() - Vector3(0, 0.5f + PoleThickness * 0.5f, 0);
+                const auto current = rope_position(positions[i]);
+                const auto next_waypoint = rope_position(positions[i + 1]);
                 const auto mid = Vector3::Lerp(current, next_waypoint, 0.5f);
                 const auto matrix = Matrix(DirectX::XMMatrixLookAtRH(mid, next_waypoint, Vector3::Up)).Invert();
                 const auto length = (next_waypoint - current).Length();
-                const auto to_wvp = Matrix::CreateScale(RopeThickness, RopeThickness, length) * matrix * camera.view_projection();
-                _waypoint_mesh->render(device.context(), to_wvp, texture_storage, _colour);
+                overlays.add_cube(Matrix::CreateScale(RopeThickness, RopeThickness, length) * matrix, _colour);
             }
         }
+    }
 
-        // Render selected waypoint...
+    void Route::render_selection(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage)
+    {
         if (_selected_index < _waypoints.size())
         {
-            _selection_renderer.render(device, camera, texture_storage, _waypoints[_selected_index], Color(1.0f, 1.0f, 1.0f));
+            // The outline is drawn with the mesh, so it needs a waypoint object. The same object is kept until the
+            // selection changes so that the selection renderer can keep its silhouette.
+            if (!_selected)
+            {
+                _selected.emplace(waypoint(_selected_index));
+            }
+            _selection_renderer.render(device, camera, texture_storage, *_selected, Color(1.0f, 1.0f, 1.0f));
         }
     }
 
@@ -149,39 +180,68 @@ namespace trview
 
     void Route::select_waypoint(uint32_t index)
     {
+        if (index != _selected_index)
+        {
+            _selected.reset();
+            _selection_renderer.clear();
+        }
         _selected_index = index;
     }
 
     void Route::set_colour(const Colour& colour)
     {
         _colour = colour;
-        for (auto& waypoint : _waypoints)
+        if (_selected)
         {
-            waypoint.set_route_colour(colour);
+            _selected->set_route_colour(colour);
         }
     }
 
-    const Waypoint& Route::waypoint(uint32_t index) const
+    Waypoint Route::waypoint(uint32_t index) const
     {
-        if (index < _waypoints.size())
+        if (index >= _waypoints.size())
         {
-            return _waypoints[index];
+            throw std::range_error("Waypoint index out of range");
         }
-        throw std::range_error("Waypoint index out of range");
+
+        Waypoint waypoint(_waypoint_mesh.get(), _waypoints.position(index), _waypoints.room(index), _waypoints.type(index), _waypoints.type_index(index), _colour);
+        waypoint.set_notes(_waypoints.notes(index));
+        return waypoint;
     }
 
-    Waypoint& Route::waypoint(uint32_t index)
+    uint32_t Route::waypoints() const
     {
-        if (index < _waypoints.size())
+        return _waypoints.size();
+    }
+
+    void Route::set_waypoint_notes(uint32_t index, const std::wstring& notes)
+    {
+        if (index >= _waypoints.size())
         {
-            return _waypoints[index];
+            throw std::range_error("Waypoint index out of range");
         }
-        throw std::range_error("Waypoint index out of range");
+        _waypoints.set_notes(index, notes);
     }
 
-    uint32_t Route::waypoints() const
+    const WaypointStore& Route::waypoint_store() const
     {
-        return _waypoints.size();
+        return _waypoints;
+    }
+
+    std::vector<Vector3> Route::find_path(const Pathfinder& pathfinder, uint32_t from, uint32_t to) const
+    {
+        if (from >= _waypoints.size() || to >= _waypoints.size())
+        {
+            throw std::range_error("Waypoint index out of range");
+        }
+        return pathfinder.find_path(_waypoints.position(from), _waypoints.position(to));
+    }
+
+    void Route::set_waypoints(WaypointStore&& waypoints)
+    {
+        _waypoints = std::move(waypoints);
+        _selected_index = 0u;
+        waypoints_changed();
     }
 
     uint32_t Route::next_index() const
@@ -189,94 +249,69 @@ namespace trview
         return _waypoints.empty() ? 0 : _selected_index + 1;
     }
 
-    std::unique_ptr<Route> import_route(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const std::string& filename)
+    void Route::waypoints_changed()
     {
-        try
-        {
-            std::ifstream file(to_utf16(filename));
-            file.exceptions(std::ifstream::failbit | std::ifstream::badbit | std::ifstream::eofbit);
-            if (!file.is_open())
-            {
-                return std::unique_ptr<Route>();
-            }
-
-            auto route = std::make_unique<Route>(device, shader_storage);
+        _index_dirty = true;
+        _selected.reset();
+        _selection_renderer.clear();
+    }
 
-            nlohmann::json json;
-            file >> json;
+    void Route::update_index() const
+    {
+        if (!_index_dirty)
+        {
+            return;
+        }
 
-            if (json["colour"].is_string())
+        // Each box covers the pole and blob of the waypoint and the rope to the next waypoint.
+        const auto& positions = _waypoints.positions();
+        std::vector<BoundingBox> boxes(positions.size());
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            auto minimum = rope_position(positions[i]) - Vector3(PoleThickness * 0.5f);
+            auto maximum = positions[i] + Vector3(PoleThickness * 0.5f, 0, PoleThickness * 0.5f);
+            if (i + 1 < positions.size())
             {
-                route->set_colour(named_colour(to_utf16(json["colour"].get<std::string>())));
+                const auto next = rope_position(positions[i + 1]);
+                minimum = Vector3::Min(minimum, next - Vector3(RopeThickness));
+                maximum = Vector3::Max(maximum, next + Vector3(RopeThickness));
             }
+            BoundingBox::CreateFromPoints(boxes[i], minimum, maximum);
+        }
 
-            for (const auto& waypoint : json["waypoints"])
-            {
-                auto type_string = waypoint["type"].get<std::string>();
-                Waypoint::Type type = waypoint_type_from_string(type_string);
- 
-                auto position_string = waypoint["position"].get<std::string>();
-
-                std::stringstream stringstream(position_string);
-
-                std::vector<float> result;
-                for (int i = 0; i < 3; ++i)
-                {
-                    std::string substr;
-                    std::getline(stringstream, substr, ',');
-                    result.push_back(std::stof(substr));
-                }
-
-                Vector3 position = Vector3(result[0], result[1], result[2]);
-
-                auto room = waypoint["room"].get<int>();
-                auto index = waypoint["index"].get<int>();
-                auto notes = waypoint["notes"].get<std::string>();
-
-                route->add(position, room, type, index);
-                route->waypoint(route->waypoints() - 1).set_notes(to_utf16(notes));
-            }
+        _index.build(boxes);
+        _index_dirty = false;
+    }
 
-            return route;
+    std::unique_ptr<Route> import_route(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const std::string& filename)
+    {
+        std::ifstream stream(to_utf16(filename));
+        if (!stream.is_open())
+        {
+            return std::unique_ptr<Route>();
         }
-        catch (std::exception&)
+
+        RouteFile file;
+        if (!read_route_file(stream, file))
         {
             return std::unique_ptr<Route>();
         }
+
+        auto route = std::make_unique<Route>(device, shader_storage);
+        if (!file.colour.empty())
+        {
+            route->set_colour(named_colour(to_utf16(file.colour)));
+        }
+        route->set_waypoints(std::move(file.waypoints));
+        return route;
     }
 
     void export_route(const Route& route, const std::string& filename)
     {
         try
         {
-            nlohmann::json json;
-
-            json["colour"] = to_utf8(route.colour().name());
-
-            std::vector<nlohmann::json> waypoints;
-
-            for (uint32_t i = 0; i < route.waypoints(); ++i)
-            {
-                const Waypoint& waypoint = route.waypoint(i);
-                nlohmann::json waypoint_json;
-                waypoint_json["type"] = to_utf8(waypoint_type_to_string(waypoint.type()));
-
-                std::stringstream pos_string;
-                auto pos = waypoint.position();
-                pos_string << pos.x << "," << pos.y << "," << pos.z;
-                waypoint_json["position"] = pos_string.str();
-                
-                waypoint_json["room"] = waypoint.room();
-                waypoint_json["index"] = waypoint.index();
-                waypoint_json["notes"] = to_utf8(waypoint.notes());
-
-                waypoints.push_back(waypoint_json);
-            }
-
-            json["waypoints"] = waypoints;
-
             std::ofstream file(to_utf16(filename));
-            file << json;
+            write_route_file(file, to_utf8(route.colour().name()), route.waypoint_store());
         }
         catch (...)
         {
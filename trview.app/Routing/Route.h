@@ -1,18 +1,23 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <trview.graphics/Device.h>
 #include <trview.graphics/IShaderStorage.h>
 #include <trview.app/Geometry/Mesh.h>
 #include <trview.app/Graphics/SelectionRenderer.h>
 #include "Waypoint.h"
+#include "WaypointIndex.h"
+#include "WaypointStore.h"
 
 namespace trview
 {
     struct ICamera;
     struct ILevelTextureStorage;
+    class Pathfinder;
 
-    /// A series of waypoints.
+    /// A series of waypoints. The waypoints are kept in a WaypointStore and a spatial index of them is
+    /// used to pick them and to only draw the ones that can be seen.
     class Route final
     {
     public:
@@ -75,11 +80,16 @@ namespace trview
         /// @param index The index of the waypoint to remove.
         void remove(uint32_t index);
 
-        /// Render the route.
+        /// Add the waypoints and the ropes between them that are in view to the overlays for this frame.
+        /// @param camera The camera to use to render.
+        /// @param overlays The overlay instances to add the waypoints and ropes to.
+        void render(const ICamera& camera, OverlayInstanceList& overlays);
+
+        /// Render the outline around the selected waypoint. This should be called after the overlays have been drawn.
         /// @param device The device to use to render.
         /// @param camera The camera to use to render.
         /// @param texture_storage Texture storage for the mesh.
-        void render(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage);
+        void render_selection(const graphics::Device& device, const ICamera& camera, const ILevelTextureStorage& texture_storage);
 
         /// Get the index of the currently selected waypoint.
         uint32_t selected_waypoint() const;
@@ -94,22 +104,49 @@ namespace trview
 
         /// Get the waypoint at the specified index.
         /// @param index The index to get.
-        const Waypoint& waypoint(uint32_t index) const;
-
-        /// Get the waypoint at the specified index.
-        /// @param index The index to get.
-        Waypoint& waypoint(uint32_t index);
+        /// @returns A copy of the waypoint.
+        Waypoint waypoint(uint32_t index) const;
 
         /// Get the number of waypoints in the route.
         uint32_t waypoints() const;
+
+        /// Set the notes for the waypoint at the specified index.
+        /// @param index The index of the waypoint.
+        /// @param notes The new notes.
+        void set_waypoint_notes(uint32_t index, const std::wstring& notes);
+
+        /// Get the waypoints in the route.
+        const WaypointStore& waypoint_store() const;
+
+        /// Find the shortest walkable path between two waypoints.
+        /// @param pathfinder The pathfinder for the level that the route is in.
+        /// @param from The index of the waypoint to start at.
+        /// @param to The index of the waypoint to finish at.
+        /// @returns The points on the path, or empty if there is no path.
+        std::vector<DirectX::SimpleMath::Vector3> find_path(const Pathfinder& pathfinder, uint32_t from, uint32_t to) const;
+
+        /// Replace all of the waypoints in the route.
+        /// @param waypoints The new waypoints.
+        void set_waypoints(WaypointStore&& waypoints);
     private:
         uint32_t next_index() const;
 
-        std::vector<Waypoint> _waypoints;
-        std::unique_ptr<Mesh> _waypoint_mesh;
-        SelectionRenderer     _selection_renderer;
-        uint32_t              _selected_index{ 0u };
-        Colour                _colour{ Colour::Green };
+        /// Called when waypoints have been added, moved or removed.
+        void waypoints_changed();
+
+        /// Build the spatial index if the waypoints have changed since it was last built.
+        void update_index() const;
+
+        WaypointStore                 _waypoints;
+        mutable WaypointIndex         _index;
+        mutable bool                  _index_dirty{ true };
+        std::vector<uint32_t>         _visible;
+        mutable std::vector<uint32_t> _hits;
+        std::unique_ptr<Mesh>         _waypoint_mesh;
+        std::optional<Waypoint>       _selected;
+        SelectionRenderer             _selection_renderer;
+        uint32_t                      _selected_index{ 0u };
+        Colour                        _colour{ Colour::Green };
     };
 
     std::unique_ptr<Route> import_route(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const std::string& filename);
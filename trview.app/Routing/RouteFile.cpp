@@ -0,0 +1,229 @@
+#include "RouteFile.h"
+
+#include <cstdlib>
+#include <istream>
+#include <limits>
+#include <ostream>
+#pragma warning(push)
+#pragma warning(disable : 4127)
+#include <external/nlohmann/json.hpp>
+#pragma warning(pop)
+#include <trview.common/Strings.h>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        /// Depth of the keys in the root object.
+        const int Root_Depth = 1;
+        /// Depth of the elements of the waypoints array.
+        const int Waypoints_Depth = 2;
+        /// Depth of the keys in each waypoint.
+        const int Waypoint_Depth = 3;
+        /// Depth of the elements of a position array.
+        const int Position_Depth = 4;
+
+        /// Reads the tokens of a route file into a RouteFile as they are parsed.
+        class RouteFileReader final : public nlohmann::json_sax<nlohmann::json>
+        {
+        public:
+            explicit RouteFileReader(RouteFile& file)
+                : _file(file)
+            {
+            }
+
+            bool null() override
+            {
+                return true;
+            }
+
+            bool boolean(bool) override
+            {
+                return true;
+            }
+
+            bool number_integer(number_integer_t value) override
+            {
+                return number(static_cast<double>(value));
+            }
+
+            bool number_unsigned(number_unsigned_t value) override
+            {
+                return number(static_cast<double>(value));
+            }
+
+            bool number_float(number_float_t value, const string_t&) override
+            {
+                return number(value);
+            }
+
+            bool string(string_t& value) override
+            {
+                if (_depth == Root_Depth && _key == "colour")
+                {
+                    _file.colour = value;
+                }
+                else if (_in_waypoints && _depth == Waypoint_Depth)
+                {
+                    if (_key == "type")
+                    {
+                        _type = waypoint_type_from_string(value);
+                    }
+                    else if (_key == "position")
+                    {
+                        // Older files have the position as "x,y,z".
+                        const char* start = value.c_str();
+                        char* end = nullptr;
+                        for (int i = 0; i < 3; ++i)
+                        {
+                            _position[i] = std::strtof(start, &end);
+                            start = *end == ',' ? end + 1 : end;
+                        }
+                    }
+                    else if (_key == "notes")
+                    {
+                        _notes = value;
+                    }
+                }
+                return true;
+            }
+
+            bool start_object(std::size_t) override
+            {
+                if (_in_waypoints && _depth == Waypoints_Depth)
+                {
+                    _type = Waypoint::Type::Position;
+                    _position[0] = _position[1] = _position[2] = 0.0f;
+                    _room = 0u;
+                    _index = 0u;
+                    _notes.clear();
+                }
+                ++_depth;
+                return true;
+            }
+
+            bool key(string_t& value) override
+            {
+                _key = value;
+                return true;
+            }
+
+            bool end_object() override
+            {
+                --_depth;
+                if (_in_waypoints && _depth == Waypoints_Depth)
+                {
+                    const auto index = _file.waypoints.size();
+                    _file.waypoints.push_back(Vector3(_position[0], _position[1], _position[2]), _room, _type, _index);
+                    if (!_notes.empty())
+                    {
+                        _file.waypoints.set_notes(index, to_utf16(_notes));
+                    }
+                }
+                return true;
+            }
+
+            bool start_array(std::size_t elements) override
+            {
+                if (_depth == Root_Depth && _key == "waypoints")
+                {
+                    _in_waypoints = true;
+                    if (elements != static_cast<std::size_t>(-1))
+                    {
+                        _file.waypoints.reserve(static_cast<uint32_t>(elements));
+                    }
+                }
+                _position_element = 0;
+                ++_depth;
+                return true;
+            }
+
+            bool end_array() override
+            {
+                --_depth;
+                if (_depth == Root_Depth)
+                {
+                    _in_waypoints = false;
+                }
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override
+            {
+                return false;
+            }
+        private:
+            bool number(double value)
+            {
+                if (_in_waypoints)
+                {
+                    if (_depth == Waypoint_Depth)
+                    {
+                        if (_key == "room")
+                        {
+                            _room = static_cast<uint32_t>(value);
+                        }
+                        else if (_key == "index")
+                        {
+                            _index = static_cast<uint32_t>(value);
+                        }
+                    }
+                    else if (_depth == Position_Depth && _key == "position" && _position_element < 3)
+                    {
+                        _position[_position_element++] = static_cast<float>(value);
+                    }
+                }
+                return true;
+            }
+
+            RouteFile&     _file;
+            int            _depth{ 0 };
+            bool           _in_waypoints{ false };
+            std::string    _key;
+            Waypoint::Type _type{ Waypoint::Type::Position };
+            float          _position[3]{ 0, 0, 0 };
+            int            _position_element{ 0 };
+            uint32_t       _room{ 0u };
+            uint32_t       _index{ 0u };
+            std::string    _notes;
+        };
+
+        std::string quoted(const std::string& value)
+        {
+            return nlohmann::json(value).dump();
+        }
+    }
+
+    bool read_route_file(std::istream& stream, RouteFile& file)
+    {
+        RouteFileReader reader(file);
+        try
+        {
+            return nlohmann::json::sax_parse(stream, &reader);
+        }
+        catch (std::exception&)
+        {
+            return false;
+        }
+    }
+
+    void write_route_file(std::ostream& stream, const std::string& colour, const WaypointStore& waypoints)
+    {
+        stream.precision(std::numeric_limits<float>::max_digits10);
+        stream << "{\"colour\":" << quoted(colour) << ",\"waypoints\":[";
+        for (uint32_t i = 0; i < waypoints.size(); ++i)
+        {
+            const auto& position = waypoints.position(i);
+            stream << (i ? ",\n" : "\n")
+                << "{\"index\":" << waypoints.type_index(i)
+                << ",\"notes\":" << quoted(to_utf8(waypoints.notes(i)))
+                << ",\"position\":[" << position.x << "," << position.y << "," << position.z << "]"
+                << ",\"room\":" << waypoints.room(i)
+                << ",\"type\":" << quoted(to_utf8(waypoint_type_to_string(waypoints.type(i))))
+                << "}";
+        }
+        stream << "]}";
+    }
+}
@@ -0,0 +1,37 @@
+/// @file RouteFile.h
+/// @brief Reads and writes route files.
+///
+/// Route files are JSON. They are read one token at a time straight into a WaypointStore and are
+/// written one waypoint at a time, so a long route never has to be held as a JSON document.
+/// Positions are written as an array of numbers. Older files that have the position as a
+/// comma separated string can still be read.
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include "WaypointStore.h"
+
+namespace trview
+{
+    /// The contents of a route file.
+    struct RouteFile
+    {
+        /// The name of the colour of the route, or empty if the file doesn't have one.
+        std::string   colour;
+        /// The waypoints in the route.
+        WaypointStore waypoints;
+    };
+
+    /// Read a route file.
+    /// @param stream The stream to read from.
+    /// @param file Set to the contents of the file.
+    /// @returns True if the file was read.
+    bool read_route_file(std::istream& stream, RouteFile& file);
+
+    /// Write a route file.
+    /// @param stream The stream to write to.
+    /// @param colour The name of the colour of the route.
+    /// @param waypoints The waypoints to write.
+    void write_route_file(std::ostream& stream, const std::string& colour, const WaypointStore& waypoints);
+}
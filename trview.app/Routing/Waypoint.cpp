@@ -76,6 +76,15 @@ namespace trview
         _route_colour = colour;
     }
 
+    void add_waypoint_instances(OverlayInstanceList& overlays, const ICamera& camera, const Vector3& position, const Color& colour, const Color& route_colour)
+    {
+        auto light_direction = position - camera.position();
+        light_direction.Normalize();
+
+        overlays.add_cube(Matrix::CreateScale(PoleThickness, 0.5f, PoleThickness) * Matrix::CreateTranslation(position - Vector3(0, 0.25f, 0)), colour, light_direction);
+        overlays.add_cube(Matrix::CreateScale(PoleThickness, PoleThickness, PoleThickness) * Matrix::CreateTranslation(position - Vector3(0, 0.5f + PoleThickness * 0.5f, 0)), route_colour);
+    }
+
     Waypoint::Type waypoint_type_from_string(const std::string& value)
     {
         if (value == "Trigger")
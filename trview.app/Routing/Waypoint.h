@@ -3,6 +3,7 @@
 #include <SimpleMath.h>
 #include <trview.app/Geometry/IRenderable.h>
 #include <trview.app/Geometry/Mesh.h>
+#include <trview.app/Graphics/OverlayInstanceList.h>
 #include <trview.common/Colour.h>
 
 namespace trview
@@ -85,6 +86,15 @@ namespace trview
         Colour                       _route_colour;
     };
 
+    /// Add the pole and blob of a waypoint to the overlays for this frame.
+    /// @param overlays The overlay instances to add the waypoint to.
+    /// @param camera The current camera being used for rendering.
+    /// @param position The position of the waypoint.
+    /// @param colour The colour of the pole.
+    /// @param route_colour The colour of the blob.
+    void add_waypoint_instances(OverlayInstanceList& overlays, const ICamera& camera, const DirectX::SimpleMath::Vector3& position,
+        const DirectX::SimpleMath::Color& colour, const DirectX::SimpleMath::Color& route_colour);
+
     Waypoint::Type waypoint_type_from_string(const std::string& value);
     std::wstring waypoint_type_to_string(Waypoint::Type type);
 }
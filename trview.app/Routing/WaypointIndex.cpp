@@ -0,0 +1,122 @@
+#include "WaypointIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+using namespace DirectX;
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    WaypointIndex::WaypointIndex(float cell_size)
+        : _cell_size(cell_size)
+    {
+    }
+
+    void WaypointIndex::build(const std::vector<BoundingBox>& boxes)
+    {
+        _boxes = boxes;
+        _cells.clear();
+        _items.assign(boxes.size(), 0u);
+
+        // Find the cell for each box and count how many boxes are in each cell.
+        std::unordered_map<uint64_t, uint32_t> cell_numbers;
+        std::vector<uint32_t> box_cells(boxes.size());
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            const auto found = cell_numbers.emplace(cell_key(boxes[i]), static_cast<uint32_t>(_cells.size()));
+            if (found.second)
+            {
+                _cells.push_back({ boxes[i], 0u, 0u });
+            }
+
+            auto& cell = _cells[found.first->second];
+            BoundingBox::CreateMerged(cell.bounds, cell.bounds, boxes[i]);
+            ++cell.count;
+            box_cells[i] = found.first->second;
+        }
+
+        // Place the boxes so that the boxes in each cell are next to each other. They stay in ascending order in each cell.
+        uint32_t first = 0;
+        for (auto& cell : _cells)
+        {
+            cell.first = first;
+            first += cell.count;
+        }
+
+        std::vector<uint32_t> next(_cells.size());
+        for (uint32_t i = 0; i < _cells.size(); ++i)
+        {
+            next[i] = _cells[i].first;
+        }
+
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            _items[next[box_cells[i]]++] = i;
+        }
+    }
+
+    void WaypointIndex::query(const BoundingFrustum& frustum, std::vector<uint32_t>& results) const
+    {
+        results.clear();
+        for (const auto& cell : _cells)
+        {
+            const auto containment = frustum.Contains(cell.bounds);
+            if (containment == DISJOINT)
+            {
+                continue;
+            }
+
+            for (uint32_t i = cell.first; i < cell.first + cell.count; ++i)
+            {
+                const auto item = _items[i];
+                if (containment == CONTAINS || frustum.Contains(_boxes[item]) != DISJOINT)
+                {
+                    results.push_back(item);
+                }
+            }
+        }
+        std::sort(results.begin(), results.end());
+    }
+
+    void WaypointIndex::query(const Vector3& position, const Vector3& direction, std::vector<uint32_t>& results) const
+    {
+        results.clear();
+        for (const auto& cell : _cells)
+        {
+            float distance = 0;
+            if (!cell.bounds.Contains(position) && !cell.bounds.Intersects(position, direction, distance))
+            {
+                continue;
+            }
+
+            for (uint32_t i = cell.first; i < cell.first + cell.count; ++i)
+            {
+                const auto item = _items[i];
+                if (_boxes[item].Contains(position) || _boxes[item].Intersects(position, direction, distance))
+                {
+                    results.push_back(item);
+                }
+            }
+        }
+        std::sort(results.begin(), results.end());
+    }
+
+    uint32_t WaypointIndex::size() const
+    {
+        return static_cast<uint32_t>(_boxes.size());
+    }
+
+    uint32_t WaypointIndex::cells() const
+    {
+        return static_cast<uint32_t>(_cells.size());
+    }
+
+    uint64_t WaypointIndex::cell_key(const BoundingBox& box) const
+    {
+        const auto x = static_cast<int32_t>(std::floor(box.Center.x / _cell_size));
+        const auto z = static_cast<int32_t>(std::floor(box.Center.z / _cell_size));
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+    }
+}
@@ -0,0 +1,61 @@
+/// @file WaypointIndex.h
+/// @brief A spatial index of the waypoints in a route, used for picking and culling.
+///
+/// Each waypoint has a box that covers everything that is drawn for it. The boxes are put in a
+/// loose grid on the x and z axes: a box goes in the cell that its centre is in, and each cell
+/// keeps the box around everything in it. A query only looks at the waypoints in the cells that
+/// it touches, so picking and culling a long route doesn't have to test every waypoint.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <DirectXCollision.h>
+#include <SimpleMath.h>
+
+namespace trview
+{
+    /// A spatial index of the waypoints in a route.
+    class WaypointIndex final
+    {
+    public:
+        /// Create a new index.
+        /// @param cell_size The width and depth of each cell of the grid.
+        explicit WaypointIndex(float cell_size = 4.0f);
+
+        /// Replace the boxes in the index.
+        /// @param boxes The box of each waypoint. The results of queries are indices into this list.
+        void build(const std::vector<DirectX::BoundingBox>& boxes);
+
+        /// Find the waypoints whose boxes are at least partly in the frustum.
+        /// @param frustum The frustum to test.
+        /// @param results Set to the indices of the waypoints, in ascending order.
+        void query(const DirectX::BoundingFrustum& frustum, std::vector<uint32_t>& results) const;
+
+        /// Find the waypoints whose boxes are hit by a ray.
+        /// @param position The start of the ray.
+        /// @param direction The direction of the ray.
+        /// @param results Set to the indices of the waypoints, in ascending order.
+        void query(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, std::vector<uint32_t>& results) const;
+
+        /// Gets the number of waypoints in the index.
+        uint32_t size() const;
+
+        /// Gets the number of cells of the grid that have waypoints in them.
+        uint32_t cells() const;
+    private:
+        struct Cell
+        {
+            DirectX::BoundingBox bounds;
+            uint32_t             first{ 0u };
+            uint32_t             count{ 0u };
+        };
+
+        uint64_t cell_key(const DirectX::BoundingBox& box) const;
+
+        float                                  _cell_size;
+        std::vector<DirectX::BoundingBox>      _boxes;
+        std::vector<Cell>                      _cells;
+        std::vector<uint32_t>                  _items; // Waypoint indices, grouped by cell.
+    };
+}
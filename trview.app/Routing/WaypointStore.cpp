@@ -0,0 +1,149 @@
+#include "WaypointStore.h"
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        const std::wstring Empty_Notes;
+
+        /// The value in the notes column for a waypoint without notes.
+        const uint32_t No_Notes = 0xffffffff;
+    }
+
+    uint32_t WaypointStore::size() const
+    {
+        return static_cast<uint32_t>(_positions.size());
+    }
+
+    bool WaypointStore::empty() const
+    {
+        return _positions.empty();
+    }
+
+    void WaypointStore::reserve(uint32_t count)
+    {
+        _positions.reserve(count);
+        _rooms.reserve(count);
+        _type_indices.reserve(count);
+        _types.reserve(count);
+        _notes.reserve(count);
+    }
+
+    void WaypointStore::push_back(const Vector3& position, uint32_t room, Waypoint::Type type, uint32_t type_index)
+    {
+        _positions.push_back(position);
+        _rooms.push_back(room);
+        _type_indices.push_back(type_index);
+        _types.push_back(static_cast<uint8_t>(type));
+        _notes.push_back(No_Notes);
+    }
+
+    void WaypointStore::insert(uint32_t index, const Vector3& position, uint32_t room, Waypoint::Type type, uint32_t type_index)
+    {
+        if (index >= size())
+        {
+            return push_back(position, room, type, type_index);
+        }
+
+        _positions.insert(_positions.begin() + index, position);
+        _rooms.insert(_rooms.begin() + index, room);
+        _type_indices.insert(_type_indices.begin() + index, type_index);
+        _types.insert(_types.begin() + index, static_cast<uint8_t>(type));
+        _notes.insert(_notes.begin() + index, No_Notes);
+    }
+
+    void WaypointStore::erase(uint32_t index)
+    {
+        if (index >= size())
+        {
+            return;
+        }
+
+        release_notes(_notes[index]);
+        _positions.erase(_positions.begin() + index);
+        _rooms.erase(_rooms.begin() + index);
+        _type_indices.erase(_type_indices.begin() + index);
+        _types.erase(_types.begin() + index);
+        _notes.erase(_notes.begin() + index);
+    }
+
+    void WaypointStore::clear()
+    {
+        _positions.clear();
+        _rooms.clear();
+        _type_indices.clear();
+        _types.clear();
+        _notes.clear();
+        _note_text.clear();
+        _free_notes.clear();
+    }
+
+    const std::vector<Vector3>& WaypointStore::positions() const
+    {
+        return _positions;
+    }
+
+    const Vector3& WaypointStore::position(uint32_t index) const
+    {
+        return _positions[index];
+    }
+
+    uint32_t WaypointStore::room(uint32_t index) const
+    {
+        return _rooms[index];
+    }
+
+    Waypoint::Type WaypointStore::type(uint32_t index) const
+    {
+        return static_cast<Waypoint::Type>(_types[index]);
+    }
+
+    uint32_t WaypointStore::type_index(uint32_t index) const
+    {
+        return _type_indices[index];
+    }
+
+    const std::wstring& WaypointStore::notes(uint32_t index) const
+    {
+        const auto slot = _notes[index];
+        return slot == No_Notes ? Empty_Notes : _note_text[slot];
+    }
+
+    void WaypointStore::set_notes(uint32_t index, const std::wstring& notes)
+    {
+        auto& slot = _notes[index];
+        if (notes.empty())
+        {
+            release_notes(slot);
+            slot = No_Notes;
+            return;
+        }
+
+        if (slot == No_Notes)
+        {
+            if (_free_notes.empty())
+            {
+                slot = static_cast<uint32_t>(_note_text.size());
+                _note_text.emplace_back();
+            }
+            else
+            {
+                slot = _free_notes.back();
+                _free_notes.pop_back();
+            }
+        }
+        _note_text[slot] = notes;
+    }
+
+    void WaypointStore::release_notes(uint32_t slot)
+    {
+        if (slot != No_Notes)
+        {
+            _note_text[slot].clear();
+            _note_text[slot].shrink_to_fit();
+            _free_notes.push_back(slot);
+        }
+    }
+}
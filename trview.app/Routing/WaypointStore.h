@@ -0,0 +1,93 @@
+/// @file WaypointStore.h
+/// @brief Compact storage for the waypoints in a route.
+///
+/// Each field of a waypoint is kept in its own array so that a route with many thousands of waypoints
+/// is small, is quick to insert into and remove from, and can be read by the spatial index without
+/// touching the fields that it doesn't need. Most waypoints have no notes, so the notes are kept
+/// separately and each waypoint only has a slot number for its notes.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <SimpleMath.h>
+#include "Waypoint.h"
+
+namespace trview
+{
+    /// Compact storage for the waypoints in a route.
+    class WaypointStore final
+    {
+    public:
+        /// Gets the number of waypoints.
+        uint32_t size() const;
+
+        /// Gets whether there are no waypoints.
+        bool empty() const;
+
+        /// Make room for a number of waypoints.
+        /// @param count The number of waypoints.
+        void reserve(uint32_t count);
+
+        /// Add a waypoint to the end.
+        /// @param position The position of the waypoint in the world.
+        /// @param room The room that the waypoint is in.
+        /// @param type The type of the waypoint.
+        /// @param type_index The index of the entity or trigger that the waypoint refers to.
+        void push_back(const DirectX::SimpleMath::Vector3& position, uint32_t room, Waypoint::Type type, uint32_t type_index);
+
+        /// Insert a waypoint.
+        /// @param index The index to insert the waypoint at. If this is past the end the waypoint is added to the end.
+        /// @param position The position of the waypoint in the world.
+        /// @param room The room that the waypoint is in.
+        /// @param type The type of the waypoint.
+        /// @param type_index The index of the entity or trigger that the waypoint refers to.
+        void insert(uint32_t index, const DirectX::SimpleMath::Vector3& position, uint32_t room, Waypoint::Type type, uint32_t type_index);
+
+        /// Remove a waypoint.
+        /// @param index The index of the waypoint to remove.
+        void erase(uint32_t index);
+
+        /// Remove all of the waypoints.
+        void clear();
+
+        /// Gets the positions of all of the waypoints.
+        const std::vector<DirectX::SimpleMath::Vector3>& positions() const;
+
+        /// Gets the position of a waypoint.
+        /// @param index The index of the waypoint.
+        const DirectX::SimpleMath::Vector3& position(uint32_t index) const;
+
+        /// Gets the room that a waypoint is in.
+        /// @param index The index of the waypoint.
+        uint32_t room(uint32_t index) const;
+
+        /// Gets the type of a waypoint.
+        /// @param index The index of the waypoint.
+        Waypoint::Type type(uint32_t index) const;
+
+        /// Gets the index of the entity or trigger that a waypoint refers to.
+        /// @param index The index of the waypoint.
+        uint32_t type_index(uint32_t index) const;
+
+        /// Gets the notes for a waypoint.
+        /// @param index The index of the waypoint.
+        const std::wstring& notes(uint32_t index) const;
+
+        /// Set the notes for a waypoint.
+        /// @param index The index of the waypoint.
+        /// @param notes The new notes. If this is empty the slot used by the notes is freed.
+        void set_notes(uint32_t index, const std::wstring& notes);
+    private:
+        void release_notes(uint32_t slot);
+
+        std::vector<DirectX::SimpleMath::Vector3> _positions;
+        std::vector<uint32_t>                     _rooms;
+        std::vector<uint32_t>                     _type_indices;
+        std::vector<uint8_t>                      _types;
+        std::vector<uint32_t>                     _notes;
+        std::vector<std::wstring>                 _note_text;
+        std::vector<uint32_t>                     _free_notes;
+    };
+}
@@ -79,6 +79,7 @@ namespace trview
             settings.auto_orbit = json["autoorbit"].get<bool>();
             settings.recent_files = json["recent"].get<std::list<std::string>>();
             settings.invert_vertical_pan = json["invertverticalpan"].get<bool>();
+            settings.max_frame_rate = json["maxframerate"].get<uint32_t>();
         }
         catch (...)
         {
@@ -118,6 +119,7 @@ namespace trview
             json["autoorbit"] = settings.auto_orbit;
             json["recent"] = settings.recent_files;
             json["invertverticalpan"] = settings.invert_vertical_pan;
+            json["maxframerate"] = settings.max_frame_rate;
 
             std::ofstream file(file_path);
             file << json;
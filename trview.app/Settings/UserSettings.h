@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <string>
 
@@ -19,6 +20,8 @@ namespace trview
         bool                    triggers_startup{ false };
         bool                    auto_orbit{ true };
         bool                    invert_vertical_pan{ true };
+        /// The maximum number of frames to render per second, or 0 for no limit.
+        uint32_t                max_frame_rate{ 0 };
     };
 
     // Load the user settings from the settings file.
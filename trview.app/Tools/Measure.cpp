@@ -1,20 +1,13 @@
 #include "Measure.h"
-#include <trview.graphics/Device.h>
 #include <sstream>
 #include <iomanip>
 
 #include <trview.app/Camera/ICamera.h>
 
-using namespace trview::graphics;
 using namespace DirectX::SimpleMath;
 
 namespace trview
 {
-    Measure::Measure(const Device& device)
-        : _mesh(create_cube_mesh(device))
-    {
-    }
-
     void Measure::reset()
     {
         _start.reset();
@@ -49,7 +42,7 @@ namespace trview
         on_distance((_end.value() - _start.value()).Length());
     }
 
-    void Measure::render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const ICamera& camera, const ILevelTextureStorage& texture_storage)
+    void Measure::render(const ICamera& camera, OverlayInstanceList& overlays)
     {
         if (!_start.has_value() || !_end.has_value() || !_visible)
         {
@@ -60,7 +53,6 @@ namespace trview
 
         auto to = _end.value() - _start.value();
         const auto scale = Matrix::CreateScale(0.05f);
-        const auto view_projection = camera.view_projection();
 
         int blobs = static_cast<int>(to.Length() / 0.25f);
 
@@ -68,12 +60,10 @@ namespace trview
         for (int i = 0; i <= blobs; ++i)
         {
             auto pos = _start.value() + to * 0.25f * static_cast<float>(i);
-            auto wvp = scale * Matrix::CreateTranslation(pos) * view_projection;
-            _mesh->render(context, wvp, texture_storage, Color(1.0f, 1.0f, 1.0f));
+            overlays.add_cube(scale * Matrix::CreateTranslation(pos), Color(1.0f, 1.0f, 1.0f));
         }
 
-        auto wvp = scale * Matrix::CreateTranslation(_end.value()) * view_projection;
-        _mesh->render(context, wvp, texture_storage, Color(1.0f, 1.0f, 1.0f));
+        overlays.add_cube(scale * Matrix::CreateTranslation(_end.value()), Color(1.0f, 1.0f, 1.0f));
 
         auto halfway = Vector3::Lerp(_start.value(), _end.value(), 0.5f);
         const auto window_size = camera.view_size();
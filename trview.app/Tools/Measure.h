@@ -1,26 +1,19 @@
 #pragma once
 
 #include <optional>
+#include <string>
 #include <SimpleMath.h>
-#include <trview.app/Geometry/Mesh.h>
+#include <trview.app/Graphics/OverlayInstanceList.h>
 #include <trview.common/Event.h>
+#include <trview.common/Point.h>
 
 namespace trview
 {
     struct ICamera;
 
-    namespace graphics
-    {
-        class Device;
-    }
-
     class Measure final
     {
     public:
-        /// Create a new measure tool.
-        /// @param device The device to use to create graphics resources.
-        explicit Measure(const graphics::Device& device);
-
         /// Event raised when the measure distance has changed.
         Event<float> on_distance;
 
@@ -42,11 +35,10 @@ namespace trview
         /// @param position The position to use as the new end.
         void set(const DirectX::SimpleMath::Vector3& position);
 
-        /// Render the measurement.
-        /// @param context D3D device context.
+        /// Add the blobs along the measurement to the overlays for this frame.
         /// @param camera The camera being used to render the scene.
-        /// @param texture_storage Texture storage for the level.
-        void render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const ICamera& camera, const ILevelTextureStorage& texture_storage);
+        /// @param overlays The overlay instances to add the blobs to.
+        void render(const ICamera& camera, OverlayInstanceList& overlays);
 
         /// Get the current text version of the distance measured.
         /// @returns The text version of the distance.
@@ -61,7 +53,6 @@ namespace trview
     private:
         std::optional<DirectX::SimpleMath::Vector3> _start;
         std::optional<DirectX::SimpleMath::Vector3> _end;
-        std::unique_ptr<Mesh>                       _mesh;
         bool                                        _visible{ true };
     };
 }
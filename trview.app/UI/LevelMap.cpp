@@ -0,0 +1,236 @@
+#define NOMINMAX
+#include "LevelMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace trview
+{
+    bool LevelMap::TileKey::operator==(const TileKey& other) const
+    {
+        return zoom == other.zoom && x == other.x && y == other.y;
+    }
+
+    std::size_t LevelMap::TileKeyHash::operator()(const TileKey& key) const
+    {
+        const uint64_t value = (static_cast<uint64_t>(key.zoom) << 48) ^
+            (static_cast<uint64_t>(static_cast<uint32_t>(key.x)) << 24) ^
+            static_cast<uint64_t>(static_cast<uint32_t>(key.y));
+        return std::hash<uint64_t>()(value);
+    }
+
+    LevelMap::LevelMap(const std::vector<float>& zoom_levels)
+        : _zoom_levels(zoom_levels)
+    {
+    }
+
+    void LevelMap::set_rooms(const std::vector<RoomArea>& rooms)
+    {
+        _rooms = rooms;
+
+        // Draw the lowest rooms first so that rooms above them are drawn on top.
+        std::stable_sort(_rooms.begin(), _rooms.end(), [](const auto& l, const auto& r) { return l.y_bottom > r.y_bottom; });
+
+        uint32_t max_number = 0;
+        for (const auto& room : _rooms)
+        {
+            max_number = std::max(max_number, room.number + 1);
+        }
+
+        _room_index.assign(max_number, -1);
+        _visible.assign(max_number, true);
+        for (uint32_t i = 0; i < _rooms.size(); ++i)
+        {
+            _room_index[_rooms[i].number] = static_cast<int32_t>(i);
+        }
+
+        if (_rooms.empty())
+        {
+            _min_x = _min_z = _max_x = _max_z = 0;
+        }
+        else
+        {
+            _min_x = _min_z = INT32_MAX;
+            _max_x = _max_z = INT32_MIN;
+            for (const auto& room : _rooms)
+            {
+                _min_x = std::min(_min_x, room.x);
+                _min_z = std::min(_min_z, room.z);
+                _max_x = std::max(_max_x, room.x + room.columns);
+                _max_z = std::max(_max_z, room.z + room.rows);
+            }
+        }
+
+        _clean.clear();
+        ++_version;
+    }
+
+    const std::vector<LevelMap::RoomArea>& LevelMap::rooms() const
+    {
+        return _rooms;
+    }
+
+    void LevelMap::set_room_visible(uint32_t number, bool visible)
+    {
+        if (number >= _visible.size() || _visible[number] == visible)
+        {
+            return;
+        }
+        _visible[number] = visible;
+        invalidate_room(number);
+    }
+
+    bool LevelMap::room_visible(uint32_t number) const
+    {
+        return number < _visible.size() && _visible[number];
+    }
+
+    void LevelMap::invalidate_room(uint32_t number)
+    {
+        const auto room = find_room(number);
+        if (!room)
+        {
+            return;
+        }
+
+        for (auto iter = _clean.begin(); iter != _clean.end();)
+        {
+            if (overlaps(*room, *iter))
+            {
+                iter = _clean.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        ++_version;
+    }
+
+    uint32_t LevelMap::zoom_levels() const
+    {
+        return static_cast<uint32_t>(_zoom_levels.size());
+    }
+
+    float LevelMap::pixels_per_sector(uint32_t zoom) const
+    {
+        return _zoom_levels[zoom];
+    }
+
+    void LevelMap::size(int32_t& width, int32_t& height) const
+    {
+        width = _max_x - _min_x;
+        height = _max_z - _min_z;
+    }
+
+    void LevelMap::to_map(float x, float z, float& map_x, float& map_y) const
+    {
+        map_x = x - _min_x;
+        map_y = _max_z - z;
+    }
+
+    std::vector<LevelMap::TileKey> LevelMap::tiles_in_area(uint32_t zoom, float left, float top, float width, float height) const
+    {
+        int32_t map_width = 0;
+        int32_t map_height = 0;
+        size(map_width, map_height);
+
+        // Only return tiles that have some of the map on them.
+        const float scale = pixels_per_sector(zoom);
+        const float right = std::min(left + width, map_width * scale);
+        const float bottom = std::min(top + height, map_height * scale);
+        left = std::max(left, 0.0f);
+        top = std::max(top, 0.0f);
+
+        std::vector<TileKey> tiles;
+        if (right <= left || bottom <= top)
+        {
+            return tiles;
+        }
+
+        const int32_t first_x = static_cast<int32_t>(std::floor(left / Tile_Size));
+        const int32_t first_y = static_cast<int32_t>(std::floor(top / Tile_Size));
+        const int32_t last_x = static_cast<int32_t>(std::ceil(right / Tile_Size));
+        const int32_t last_y = static_cast<int32_t>(std::ceil(bottom / Tile_Size));
+        for (int32_t y = first_y; y < last_y; ++y)
+        {
+            for (int32_t x = first_x; x < last_x; ++x)
+            {
+                tiles.push_back({ zoom, x, y });
+            }
+        }
+        return tiles;
+    }
+
+    std::vector<const LevelMap::RoomArea*> LevelMap::rooms_in_tile(const TileKey& tile) const
+    {
+        std::vector<const RoomArea*> rooms;
+        for (const auto& room : _rooms)
+        {
+            if (room_visible(room.number) && overlaps(room, tile))
+            {
+                rooms.push_back(&room);
+            }
+        }
+        return rooms;
+    }
+
+    std::optional<uint32_t> LevelMap::room_at(float map_x, float map_y) const
+    {
+        // Rooms are in drawing order, so the last one that contains the point is the one on top.
+        for (auto iter = _rooms.rbegin(); iter != _rooms.rend(); ++iter)
+        {
+            if (!room_visible(iter->number))
+            {
+                continue;
+            }
+
+            float left = 0;
+            float top = 0;
+            to_map(static_cast<float>(iter->x), static_cast<float>(iter->z + iter->rows), left, top);
+            if (map_x >= left && map_y >= top && map_x < left + iter->columns && map_y < top + iter->rows)
+            {
+                return iter->number;
+            }
+        }
+        return {};
+    }
+
+    bool LevelMap::is_dirty(const TileKey& tile) const
+    {
+        return _clean.find(tile) == _clean.end();
+    }
+
+    void LevelMap::mark_clean(const TileKey& tile)
+    {
+        _clean.insert(tile);
+    }
+
+    uint64_t LevelMap::version() const
+    {
+        return _version;
+    }
+
+    const LevelMap::RoomArea* LevelMap::find_room(uint32_t number) const
+    {
+        if (number >= _room_index.size() || _room_index[number] == -1)
+        {
+            return nullptr;
+        }
+        return &_rooms[_room_index[number]];
+    }
+
+    bool LevelMap::overlaps(const RoomArea& room, const TileKey& tile) const
+    {
+        float left = 0;
+        float top = 0;
+        to_map(static_cast<float>(room.x), static_cast<float>(room.z + room.rows), left, top);
+
+        const float scale = pixels_per_sector(tile.zoom);
+        const float tile_left = static_cast<float>(tile.x * static_cast<int32_t>(Tile_Size));
+        const float tile_top = static_cast<float>(tile.y * static_cast<int32_t>(Tile_Size));
+        return left * scale < tile_left + Tile_Size && (left + room.columns) * scale > tile_left &&
+               top * scale < tile_top + Tile_Size && (top + room.rows) * scale > tile_top;
+    }
+}
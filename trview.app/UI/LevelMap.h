@@ -0,0 +1,146 @@
+/// @file LevelMap.h
+/// @brief Lays out every room in a level on a single top down map and tracks which parts of it need to be redrawn.
+///
+/// The map is split into fixed size square tiles at several zoom levels. Each tile only has to be
+/// drawn again when one of the rooms that overlaps it changes, so a renderer can keep the tiles
+/// that it has already drawn and rebuild the map a few tiles at a time.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+namespace trview
+{
+    /// Lays out every room in a level on a single top down map and tracks which tiles need to be redrawn.
+    class LevelMap final
+    {
+    public:
+        /// The area that a room covers on the map, in sectors.
+        struct RoomArea
+        {
+            /// The room number.
+            uint32_t number;
+            /// The world x position of the room, in sectors.
+            int32_t  x;
+            /// The world z position of the room, in sectors.
+            int32_t  z;
+            /// The number of sectors along the x axis.
+            uint16_t columns;
+            /// The number of sectors along the z axis.
+            uint16_t rows;
+            /// The world y position of the bottom of the room. Rooms that are higher up are drawn on top.
+            int32_t  y_bottom;
+        };
+
+        /// Identifies a tile on the map.
+        struct TileKey
+        {
+            uint32_t zoom;
+            int32_t  x;
+            int32_t  y;
+
+            bool operator==(const TileKey& other) const;
+        };
+
+        /// Hash function so that tiles can be used as keys.
+        struct TileKeyHash
+        {
+            std::size_t operator()(const TileKey& key) const;
+        };
+
+        /// The width and height of each tile in pixels.
+        static const uint32_t Tile_Size = 256;
+
+        /// Create a new level map.
+        /// @param zoom_levels The number of pixels per sector for each zoom level, from smallest to largest.
+        explicit LevelMap(const std::vector<float>& zoom_levels = { 1.0f, 2.0f, 4.0f, 8.0f, 16.0f });
+
+        /// Replace the rooms on the map. All rooms start visible and every tile will need to be drawn.
+        /// @param rooms The rooms in the level.
+        void set_rooms(const std::vector<RoomArea>& rooms);
+
+        /// Gets the rooms in the order that they should be drawn.
+        const std::vector<RoomArea>& rooms() const;
+
+        /// Set whether a room is shown on the map, for example when a flipmap is toggled. Only the tiles
+        /// that the room overlaps are affected.
+        /// @param number The room number.
+        /// @param visible Whether the room is shown.
+        void set_room_visible(uint32_t number, bool visible);
+
+        /// Gets whether a room is shown on the map.
+        /// @param number The room number.
+        bool room_visible(uint32_t number) const;
+
+        /// Mark the tiles that a room overlaps as needing to be drawn again.
+        /// @param number The room number.
+        void invalidate_room(uint32_t number);
+
+        /// Gets the number of zoom levels.
+        uint32_t zoom_levels() const;
+
+        /// Gets the number of pixels per sector at a zoom level.
+        /// @param zoom The zoom level.
+        float pixels_per_sector(uint32_t zoom) const;
+
+        /// Gets the size of the whole map in sectors.
+        /// @param width Set to the width in sectors.
+        /// @param height Set to the height in sectors.
+        void size(int32_t& width, int32_t& height) const;
+
+        /// Convert a world sector position to a position on the map, in sectors. North is at the top of the map.
+        /// @param x The world x position in sectors.
+        /// @param z The world z position in sectors.
+        /// @param map_x Set to the x position on the map.
+        /// @param map_y Set to the y position on the map.
+        void to_map(float x, float z, float& map_x, float& map_y) const;
+
+        /// Get the tiles that are needed to show part of the map.
+        /// @param zoom The zoom level.
+        /// @param left The left of the area in pixels.
+        /// @param top The top of the area in pixels.
+        /// @param width The width of the area in pixels.
+        /// @param height The height of the area in pixels.
+        /// @returns The tiles that overlap the area.
+        std::vector<TileKey> tiles_in_area(uint32_t zoom, float left, float top, float width, float height) const;
+
+        /// Get the visible rooms that overlap a tile, in drawing order.
+        /// @param tile The tile to test.
+        /// @returns The rooms that overlap the tile.
+        std::vector<const RoomArea*> rooms_in_tile(const TileKey& tile) const;
+
+        /// Gets the visible room on top at a position on the map.
+        /// @param map_x The x position on the map in sectors.
+        /// @param map_y The y position on the map in sectors.
+        /// @returns The room number, if there is a room at the position.
+        std::optional<uint32_t> room_at(float map_x, float map_y) const;
+
+        /// Gets whether the tile needs to be drawn again.
+        /// @param tile The tile to test.
+        bool is_dirty(const TileKey& tile) const;
+
+        /// Record that the tile has been drawn with the current rooms.
+        /// @param tile The tile that was drawn.
+        void mark_clean(const TileKey& tile);
+
+        /// Gets the number of times that set_rooms or a room change has changed the map.
+        uint64_t version() const;
+    private:
+        const RoomArea* find_room(uint32_t number) const;
+        bool overlaps(const RoomArea& room, const TileKey& tile) const;
+
+        std::vector<float> _zoom_levels;
+        std::vector<RoomArea> _rooms;
+        std::vector<int32_t> _room_index; // Index into _rooms for each room number, or -1.
+        std::vector<bool> _visible;       // Whether each room number is visible.
+        std::unordered_set<TileKey, TileKeyHash> _clean;
+        int32_t _min_x{ 0 };
+        int32_t _min_z{ 0 };
+        int32_t _max_x{ 0 };
+        int32_t _max_z{ 0 };
+        uint64_t _version{ 0u };
+    };
+}
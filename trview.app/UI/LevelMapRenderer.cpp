@@ -0,0 +1,402 @@
+#define NOMINMAX
+#include "LevelMapRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <trview.app/Elements/Room.h>
+#include <trview.common/Colour.h>
+#include <trview.graphics/RenderTargetStore.h>
+#include <trview.graphics/ViewportStore.h>
+#include <trview.ui.render/MapColours.h>
+
+using namespace DirectX::SimpleMath;
+using namespace Microsoft::WRL;
+
+namespace trview
+{
+    namespace
+    {
+        const float Panel_Margin = 60.0f;
+        const uint32_t Max_Cached_Tiles = 160;
+        const uint32_t Tiles_Per_Frame = 4;
+        const Color Background_Colour(0.0f, 0.0f, 0.0f, 0.75f);
+        const Color Selection_Colour(1.0f, 1.0f, 0.0f, 1.0f);
+    }
+
+    LevelMapRenderer::LevelMapRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const Size& window_size)
+        : _device(device), _batch(device, shader_storage), _texture(graphics::create_texture(device, Colour::White)), _window_size(window_size)
+    {
+        D3D11_DEPTH_STENCIL_DESC depth_stencil_desc;
+        memset(&depth_stencil_desc, 0, sizeof(depth_stencil_desc));
+        device.device()->CreateDepthStencilState(&depth_stencil_desc, &_depth_stencil_state);
+    }
+
+    void LevelMapRenderer::load(const std::vector<Room*>& rooms)
+    {
+        _rooms.clear();
+        std::vector<LevelMap::RoomArea> areas;
+        for (const auto& room : rooms)
+        {
+            const auto info = room->info();
+            const auto number = room->number();
+            areas.push_back({ number, info.x / 1024, info.z / 1024, room->num_x_sectors(), room->num_z_sectors(), info.yBottom });
+            if (number >= _rooms.size())
+            {
+                _rooms.resize(number + 1, nullptr);
+            }
+            _rooms[number] = room;
+        }
+
+        _map.set_rooms(areas);
+        _tiles.clear();
+        _tile_order.clear();
+        _selected_room.reset();
+        _hover_room.reset();
+        _loaded = true;
+        _needs_update = true;
+        fit_to_panel();
+    }
+
+    void LevelMapRenderer::set_room_visible(uint32_t room, bool visible)
+    {
+        if (_map.room_visible(room) != visible)
+        {
+            _map.set_room_visible(room, visible);
+            _needs_update = true;
+        }
+    }
+
+    void LevelMapRenderer::set_selected_room(uint32_t room)
+    {
+        _selected_room = room;
+        _needs_update = true;
+
+        const auto& rooms = _map.rooms();
+        auto found = std::find_if(rooms.begin(), rooms.end(), [&](const auto& area) { return area.number == room; });
+        if (found == rooms.end())
+        {
+            return;
+        }
+
+        // Only move the map if the room isn't already entirely in view.
+        float left = 0;
+        float top = 0;
+        _map.to_map(static_cast<float>(found->x), static_cast<float>(found->z + found->rows), left, top);
+        const float scale = _map.pixels_per_sector(_zoom);
+        const auto size = panel_size();
+        if (left * scale < _view_x || top * scale < _view_y ||
+            (left + found->columns) * scale > _view_x + size.width ||
+            (top + found->rows) * scale > _view_y + size.height)
+        {
+            centre_on(left + found->columns * 0.5f, top + found->rows * 0.5f);
+        }
+    }
+
+    void LevelMapRenderer::render(const ComPtr<ID3D11DeviceContext>& context)
+    {
+        if (!_visible || !_loaded)
+        {
+            return;
+        }
+
+        context->OMSetDepthStencilState(_depth_stencil_state.Get(), 1);
+
+        const auto position = panel_position();
+        const auto size = panel_size();
+        const auto tiles = _map.tiles_in_area(_zoom, _view_x, _view_y, size.width, size.height);
+
+        // Draw any tiles that are missing or out of date, up to the limit for each frame. Tiles that are out
+        // of date are still shown until they have been drawn again.
+        uint32_t built = 0;
+        bool remaining = false;
+        for (const auto& key : tiles)
+        {
+            auto tile = find_tile(key);
+            if (tile && !_map.is_dirty(key))
+            {
+                continue;
+            }
+
+            if (built == Tiles_Per_Frame)
+            {
+                remaining = true;
+                break;
+            }
+
+            auto& target = tile ? *tile->target : *create_tile(key).target;
+            build_tile(context, key, target);
+            ++built;
+        }
+        _needs_update = remaining;
+
+        _batch.begin(_window_size);
+        _batch.draw(_texture, position.x, position.y, size.width, size.height, Background_Colour);
+        for (const auto& key : tiles)
+        {
+            if (auto tile = find_tile(key))
+            {
+                draw_clipped(tile->target->texture(),
+                    position.x + key.x * static_cast<float>(LevelMap::Tile_Size) - _view_x,
+                    position.y + key.y * static_cast<float>(LevelMap::Tile_Size) - _view_y,
+                    static_cast<float>(LevelMap::Tile_Size), static_cast<float>(LevelMap::Tile_Size), Colour::White);
+            }
+        }
+        draw_selection();
+        _batch.end(context);
+    }
+
+    void LevelMapRenderer::set_cursor_position(const Point& cursor)
+    {
+        _cursor = cursor;
+        if (!_visible)
+        {
+            return;
+        }
+
+        const auto room = room_at_cursor();
+        if (room != _hover_room)
+        {
+            _hover_room = room;
+            on_room_hover(room);
+        }
+    }
+
+    bool LevelMapRenderer::cursor_is_over_control() const
+    {
+        return _visible && _loaded && _cursor.is_between(panel_position(), panel_position() + Point(panel_size().width, panel_size().height));
+    }
+
+    std::optional<uint32_t> LevelMapRenderer::room_at_cursor() const
+    {
+        if (!cursor_is_over_control())
+        {
+            return {};
+        }
+        return room_at(_cursor);
+    }
+
+    void LevelMapRenderer::zoom(int16_t delta)
+    {
+        const uint32_t zoom = delta > 0 ? std::min(_zoom + 1, _map.zoom_levels() - 1) : (_zoom > 0 ? _zoom - 1 : 0);
+        if (zoom == _zoom)
+        {
+            return;
+        }
+
+        // Keep the part of the map under the cursor in the same place on the screen.
+        const auto offset = _cursor - panel_position();
+        const float old_scale = _map.pixels_per_sector(_zoom);
+        const float new_scale = _map.pixels_per_sector(zoom);
+        const float map_x = (_view_x + offset.x) / old_scale;
+        const float map_y = (_view_y + offset.y) / old_scale;
+        _zoom = zoom;
+        _view_x = map_x * new_scale - offset.x;
+        _view_y = map_y * new_scale - offset.y;
+        _needs_update = true;
+    }
+
+    void LevelMapRenderer::set_window_size(const Size& size)
+    {
+        _window_size = size;
+        _needs_update = true;
+    }
+
+    void LevelMapRenderer::set_visible(bool value)
+    {
+        _visible = value;
+        _needs_update = true;
+        if (!_visible && _hover_room)
+        {
+            _hover_room.reset();
+            on_room_hover(_hover_room);
+        }
+    }
+
+    bool LevelMapRenderer::visible() const
+    {
+        return _visible;
+    }
+
+    bool LevelMapRenderer::needs_update() const
+    {
+        return _visible && _needs_update;
+    }
+
+    LevelMapRenderer::CachedTile* LevelMapRenderer::find_tile(const LevelMap::TileKey& key)
+    {
+        auto found = _tiles.find(key);
+        if (found == _tiles.end())
+        {
+            return nullptr;
+        }
+        _tile_order.splice(_tile_order.begin(), _tile_order, found->second.order);
+        return &found->second;
+    }
+
+    LevelMapRenderer::CachedTile& LevelMapRenderer::create_tile(const LevelMap::TileKey& key)
+    {
+        // Reuse the render target of the least recently used tile if the cache is full.
+        std::unique_ptr<graphics::RenderTarget> target;
+        if (_tiles.size() >= Max_Cached_Tiles)
+        {
+            auto oldest = _tiles.find(_tile_order.back());
+            target = std::move(oldest->second.target);
+            _tiles.erase(oldest);
+            _tile_order.pop_back();
+        }
+        else
+        {
+            target = std::make_unique<graphics::RenderTarget>(_device, LevelMap::Tile_Size, LevelMap::Tile_Size);
+        }
+
+        _tile_order.push_front(key);
+        auto& tile = _tiles[key];
+        tile.target = std::move(target);
+        tile.order = _tile_order.begin();
+        return tile;
+    }
+
+    void LevelMapRenderer::build_tile(const ComPtr<ID3D11DeviceContext>& context, const LevelMap::TileKey& key, graphics::RenderTarget& target)
+    {
+        graphics::RenderTargetStore rs_store(context);
+        graphics::ViewportStore vp_store(context);
+        target.clear(context, Color(0.0f, 0.0f, 0.0f, 0.0f));
+        target.apply(context);
+
+        const float scale = _map.pixels_per_sector(key.zoom);
+        const float tile_left = key.x * static_cast<float>(LevelMap::Tile_Size);
+        const float tile_top = key.y * static_cast<float>(LevelMap::Tile_Size);
+
+        // Leave a gap between sectors when they are big enough for it to be seen.
+        const float gap = scale >= 4.0f ? 1.0f : 0.0f;
+
+        _batch.begin(target.size());
+        for (const auto& area : _map.rooms_in_tile(key))
+        {
+            const auto room = area->number < _rooms.size() ? _rooms[area->number] : nullptr;
+            if (!room)
+            {
+                continue;
+            }
+
+            for (const auto& sector : room->sectors())
+            {
+                float map_x = 0;
+                float map_y = 0;
+                _map.to_map(static_cast<float>(area->x + sector->x()), static_cast<float>(area->z + sector->z() + 1), map_x, map_y);
+
+                const float x = map_x * scale - tile_left;
+                const float y = map_y * scale - tile_top;
+                if (x + scale < 0 || y + scale < 0 || x > LevelMap::Tile_Size || y > LevelMap::Tile_Size)
+                {
+                    continue;
+                }
+
+                _batch.draw(_texture, x, y, scale - gap, scale - gap, ui::render::sector_colour(*sector));
+                if (sector->flags & SectorFlag::RoomBelow)
+                {
+                    _batch.draw(_texture, x, y, scale - gap, scale - gap, Color(0.0f, 0.0f, 0.0f, 0.6f));
+                }
+            }
+        }
+        _batch.end(context);
+        _map.mark_clean(key);
+    }
+
+    void LevelMapRenderer::draw_clipped(const graphics::Texture& texture, float x, float y, float width, float height, const Color& colour)
+    {
+        const auto position = panel_position();
+        const auto size = panel_size();
+        const float left = std::max(x, position.x);
+        const float top = std::max(y, position.y);
+        const float right = std::min(x + width, position.x + size.width);
+        const float bottom = std::min(y + height, position.y + size.height);
+        if (right <= left || bottom <= top)
+        {
+            return;
+        }
+
+        const Vector2 uv_top_left((left - x) / width, (top - y) / height);
+        const Vector2 uv_bottom_right((right - x) / width, (bottom - y) / height);
+        _batch.draw(texture, left, top, right - left, bottom - top, uv_top_left, uv_bottom_right, colour);
+    }
+
+    void LevelMapRenderer::draw_selection()
+    {
+        if (!_selected_room.has_value() || !_map.room_visible(_selected_room.value()))
+        {
+            return;
+        }
+
+        const auto& rooms = _map.rooms();
+        auto found = std::find_if(rooms.begin(), rooms.end(), [&](const auto& area) { return area.number == _selected_room.value(); });
+        if (found == rooms.end())
+        {
+            return;
+        }
+
+        float map_x = 0;
+        float map_y = 0;
+        _map.to_map(static_cast<float>(found->x), static_cast<float>(found->z + found->rows), map_x, map_y);
+
+        const auto position = panel_position();
+        const float scale = _map.pixels_per_sector(_zoom);
+        const float x = position.x + map_x * scale - _view_x;
+        const float y = position.y + map_y * scale - _view_y;
+        const float width = found->columns * scale;
+        const float height = found->rows * scale;
+        const float thickness = 2.0f;
+
+        draw_clipped(_texture, x, y, width, thickness, Selection_Colour);
+        draw_clipped(_texture, x, y + height - thickness, width, thickness, Selection_Colour);
+        draw_clipped(_texture, x, y, thickness, height, Selection_Colour);
+        draw_clipped(_texture, x + width - thickness, y, thickness, height, Selection_Colour);
+    }
+
+    void LevelMapRenderer::fit_to_panel()
+    {
+        int32_t width = 0;
+        int32_t height = 0;
+        _map.size(width, height);
+
+        // Use the largest zoom level that shows the whole level.
+        const auto size = panel_size();
+        _zoom = 0;
+        for (uint32_t zoom = 0; zoom < _map.zoom_levels(); ++zoom)
+        {
+            const float scale = _map.pixels_per_sector(zoom);
+            if (width * scale <= size.width && height * scale <= size.height)
+            {
+                _zoom = zoom;
+            }
+        }
+        centre_on(width * 0.5f, height * 0.5f);
+    }
+
+    void LevelMapRenderer::centre_on(float map_x, float map_y)
+    {
+        const auto size = panel_size();
+        const float scale = _map.pixels_per_sector(_zoom);
+        _view_x = std::round(map_x * scale - size.width * 0.5f);
+        _view_y = std::round(map_y * scale - size.height * 0.5f);
+        _needs_update = true;
+    }
+
+    Point LevelMapRenderer::panel_position() const
+    {
+        return Point(Panel_Margin, Panel_Margin);
+    }
+
+    Size LevelMapRenderer::panel_size() const
+    {
+        return Size(std::max(_window_size.width - Panel_Margin * 2, 1.0f), std::max(_window_size.height - Panel_Margin * 2, 1.0f));
+    }
+
+    std::optional<uint32_t> LevelMapRenderer::room_at(const Point& position) const
+    {
+        const auto panel = panel_position();
+        const float scale = _map.pixels_per_sector(_zoom);
+        return _map.room_at((position.x - panel.x + _view_x) / scale, (position.y - panel.y + _view_y) / scale);
+    }
+}
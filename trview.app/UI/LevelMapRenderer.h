@@ -0,0 +1,132 @@
+/// @file LevelMapRenderer.h
+/// @brief Draws a top down map of every room in the level.
+///
+/// The map is drawn into fixed size tile textures that are kept between frames. Only tiles that
+/// are missing or that contain a room that has changed are drawn again, and only a few of those
+/// are drawn each frame so that opening the map on a large level doesn't stall.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <wrl/client.h>
+#include <d3d11.h>
+
+#include <trview.common/Event.h>
+#include <trview.common/Point.h>
+#include <trview.common/Size.h>
+#include <trview.graphics/Device.h>
+#include <trview.graphics/RenderTarget.h>
+#include <trview.graphics/SpriteBatch.h>
+#include <trview.graphics/Texture.h>
+#include "LevelMap.h"
+
+namespace trview
+{
+    class Room;
+
+    namespace graphics
+    {
+        struct IShaderStorage;
+    }
+
+    /// Draws a top down map of every room in the level.
+    class LevelMapRenderer final
+    {
+    public:
+        /// Create a new level map renderer.
+        /// @param device The device to create textures with.
+        /// @param shader_storage The shader storage for the sprite batch.
+        /// @param window_size The size of the host window.
+        LevelMapRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const Size& window_size);
+
+        /// Load the rooms in the level.
+        /// @param rooms The rooms in the level. These must stay alive until load is called again.
+        void load(const std::vector<Room*>& rooms);
+
+        /// Set whether a room is shown, for example when a flipmap is toggled.
+        /// @param room The room number.
+        /// @param visible Whether the room is shown.
+        void set_room_visible(uint32_t room, bool visible);
+
+        /// Set the selected room. The room is outlined and the map is moved so that it is in view.
+        /// @param room The room number.
+        void set_selected_room(uint32_t room);
+
+        /// Render the map.
+        /// @param context The device context.
+        void render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context);
+
+        /// Set the position of the cursor in the host window.
+        /// @param cursor The cursor position.
+        void set_cursor_position(const Point& cursor);
+
+        /// Gets whether the cursor is over the map.
+        bool cursor_is_over_control() const;
+
+        /// Gets the room under the cursor, if there is one.
+        std::optional<uint32_t> room_at_cursor() const;
+
+        /// Zoom in or out, keeping the point under the cursor in the same place.
+        /// @param delta The mouse wheel delta. Positive values zoom in.
+        void zoom(int16_t delta);
+
+        /// Set the size of the host window.
+        /// @param size The new size.
+        void set_window_size(const Size& size);
+
+        /// Set whether the map is visible.
+        /// @param value Whether the map is visible.
+        void set_visible(bool value);
+
+        /// Gets whether the map is visible.
+        bool visible() const;
+
+        /// Gets whether there are tiles that still need to be drawn. If this is true, render should
+        /// be called again even if nothing else has changed.
+        bool needs_update() const;
+
+        /// Event raised when the room under the cursor changes.
+        Event<std::optional<uint32_t>> on_room_hover;
+    private:
+        struct CachedTile
+        {
+            std::unique_ptr<graphics::RenderTarget> target;
+            std::list<LevelMap::TileKey>::iterator  order;
+        };
+
+        CachedTile* find_tile(const LevelMap::TileKey& key);
+        CachedTile& create_tile(const LevelMap::TileKey& key);
+        void build_tile(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const LevelMap::TileKey& key, graphics::RenderTarget& target);
+        void draw_clipped(const graphics::Texture& texture, float x, float y, float width, float height, const DirectX::SimpleMath::Color& colour);
+        void draw_selection();
+        void fit_to_panel();
+        void centre_on(float map_x, float map_y);
+        Point panel_position() const;
+        Size panel_size() const;
+        std::optional<uint32_t> room_at(const Point& position) const;
+
+        const graphics::Device&             _device;
+        graphics::SpriteBatch               _batch;
+        graphics::Texture                   _texture;
+        Microsoft::WRL::ComPtr<ID3D11DepthStencilState> _depth_stencil_state;
+        LevelMap                            _map;
+        std::vector<Room*>                  _rooms;
+        std::unordered_map<LevelMap::TileKey, CachedTile, LevelMap::TileKeyHash> _tiles;
+        std::list<LevelMap::TileKey>        _tile_order; // Most recently used first.
+        Size                                _window_size;
+        Point                               _cursor;
+        uint32_t                            _zoom{ 0u };
+        float                               _view_x{ 0.0f };
+        float                               _view_y{ 0.0f };
+        std::optional<uint32_t>             _selected_room;
+        std::optional<uint32_t>             _hover_room;
+        bool                                _visible{ false };
+        bool                                _loaded{ false };
+        bool                                _needs_update{ false };
+    };
+}
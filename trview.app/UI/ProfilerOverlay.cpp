@@ -0,0 +1,111 @@
+#include "ProfilerOverlay.h"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+#include <trview.ui/Control.h>
+#include <trview.ui/Label.h>
+#include <trview.common/Strings.h>
+
+namespace trview
+{
+    namespace
+    {
+        const Size Overlay_Size(260, 138);
+        const uint32_t Frames_To_Average = 60;
+        const float Update_Interval_Ms = 500.0f;
+        const char* const Sections[] = { "pick", "scene", "transparency", "ui", "windows", "present" };
+    }
+
+    ProfilerOverlay::ProfilerOverlay(ui::Control& parent)
+    {
+        using namespace ui;
+        auto text = std::make_unique<Label>(Point(parent.size().width - Overlay_Size.width - 10, 30), Overlay_Size, Colour(0.5f, 0.0f, 0.0f, 0.0f), L"", 8);
+        text->set_visible(false);
+        _text = parent.add_child(std::move(text));
+
+        _token_store += parent.on_size_changed += [&](const Size& size)
+        {
+            _text->set_position(Point(size.width - Overlay_Size.width - 10, 30));
+        };
+    }
+
+    void ProfilerOverlay::update(const Profiler& profiler, const FrameScheduler::Statistics& frames)
+    {
+        const auto& history = profiler.frames();
+        if (!visible() || history.empty() || history.back().start - _last_update < Update_Interval_Ms)
+        {
+            return;
+        }
+        _last_update = history.back().start;
+
+        const uint32_t count = std::min<uint32_t>(Frames_To_Average, static_cast<uint32_t>(history.size()));
+        float cpu = 0.0f;
+        float gpu = 0.0f;
+        uint32_t gpu_frames = 0;
+        std::array<float, sizeof(Sections) / sizeof(Sections[0])> sections{};
+        std::array<uint64_t, static_cast<uint32_t>(ProfileCounter::Count)> counters{};
+
+        for (auto iter = history.end() - count; iter != history.end(); ++iter)
+        {
+            cpu += iter->duration;
+            if (iter->gpu_duration >= 0)
+            {
+                gpu += iter->gpu_duration;
+                ++gpu_frames;
+            }
+            for (uint32_t i = 0; i < sections.size(); ++i)
+            {
+                sections[i] += iter->section_duration(Sections[i]);
+            }
+            for (uint32_t i = 0; i < counters.size(); ++i)
+            {
+                counters[i] += iter->counters[i];
+            }
+        }
+
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(2);
+        stream << "CPU " << cpu / count << " ms  GPU ";
+        if (gpu_frames)
+        {
+            stream << gpu / gpu_frames << " ms";
+        }
+        else
+        {
+            stream << "n/a";
+        }
+        stream << '\n';
+
+        for (uint32_t i = 0; i < sections.size(); ++i)
+        {
+            stream << Sections[i] << ' ' << sections[i] / count << ((i % 3 == 2) ? "\n" : "  ");
+        }
+
+        auto average = [&](ProfileCounter counter) { return counters[static_cast<uint32_t>(counter)] / count; };
+        stream << "Draws " << average(ProfileCounter::DrawCalls)
+            << "  Maps " << average(ProfileCounter::BufferMaps)
+            << "  RT " << average(ProfileCounter::RenderTargetSwitches)
+            << "  New RT " << average(ProfileCounter::RenderTargetCreations) << '\n'
+            << "Transparent triangles " << average(ProfileCounter::TransparentTriangles) << '\n'
+            << "UI redraws " << average(ProfileCounter::UiRedraws)
+            << "  skipped " << average(ProfileCounter::UiRedrawsSkipped) << '\n'
+            << "Frames " << frames.drawn << "  idle " << frames.idle << "  capped " << frames.capped << '\n'
+            << "F2: toggle  Ctrl+F2: export";
+
+        _text->set_text(to_utf16(stream.str()));
+    }
+
+    void ProfilerOverlay::set_visible(bool value)
+    {
+        _text->set_visible(value);
+        _last_update = 0.0;
+    }
+
+    bool ProfilerOverlay::visible() const
+    {
+        return _text->visible();
+    }
+}
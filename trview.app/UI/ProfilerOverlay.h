@@ -0,0 +1,43 @@
+/// @file ProfilerOverlay.h
+/// @brief Displays frame timings and rendering counters on the screen.
+
+#pragma once
+
+#include <trview.common/FrameScheduler.h>
+#include <trview.common/Profiler.h>
+#include <trview.common/TokenStore.h>
+
+namespace trview
+{
+    namespace ui
+    {
+        class Control;
+        class Label;
+    }
+
+    /// Displays frame timings and rendering counters on the screen. The values are averaged over recent
+    /// frames and the text is only updated a few times a second so that it can be read.
+    class ProfilerOverlay final
+    {
+    public:
+        /// Create a new profiler overlay. The overlay is hidden until set_visible is called.
+        /// @param parent The control to add the overlay to.
+        explicit ProfilerOverlay(ui::Control& parent);
+
+        /// Update the displayed values from the profiler.
+        /// @param profiler The profiler to read from.
+        /// @param frames The number of frames that have been drawn and skipped.
+        void update(const Profiler& profiler, const FrameScheduler::Statistics& frames);
+
+        /// Set whether the overlay is visible.
+        /// @param value Whether the overlay is visible.
+        void set_visible(bool value);
+
+        /// Gets whether the overlay is visible.
+        bool visible() const;
+    private:
+        TokenStore _token_store;
+        ui::Label* _text;
+        double _last_update{ 0.0 };
+    };
+}
@@ -19,7 +19,7 @@ namespace trview
     {
         using namespace ui;
 
-        auto rooms_groups = std::make_unique<GroupBox>(Size(150, 130), Colour::Transparent, Colour::Grey, L"View Options");
+        auto rooms_groups = std::make_unique<GroupBox>(Size(150, 155), Colour::Transparent, Colour::Grey, L"View Options");
         auto highlight = std::make_unique<Checkbox>(Point(12, 20), Colour::Transparent, L"Highlight");
         auto triggers = std::make_unique<Checkbox>(Point(86, 20), Colour::Transparent, L"Triggers");
         triggers->set_state(true);
@@ -32,6 +32,9 @@ namespace trview
         hidden_geometry->on_state_changed += on_show_hidden_geometry;
         water->on_state_changed += on_show_water;
 
+        auto animate = std::make_unique<Checkbox>(Point(12, 121), Colour::Transparent, L"Animate");
+        animate->on_state_changed += on_animate;
+
         auto enabled = std::make_unique<Checkbox>(Point(12, 70), Colour::Transparent, L"Depth");
         enabled->on_state_changed += on_depth_enabled;
 
@@ -46,6 +49,7 @@ namespace trview
         _triggers = rooms_groups->add_child(std::move(triggers));
         _hidden_geometry = rooms_groups->add_child(std::move(hidden_geometry));
         _water = rooms_groups->add_child(std::move(water));
+        _animate = rooms_groups->add_child(std::move(animate));
 
         // Shared panel size.
         const auto panel_size = Size(140, 20);
@@ -146,6 +150,11 @@ namespace trview
         _water->set_state(show);
     }
 
+    void ViewOptions::set_animate(bool animate)
+    {
+        _animate->set_state(animate);
+    }
+
     void ViewOptions::set_use_alternate_groups(bool value)
     {
         _tr1_3_panel->set_visible(!value);
@@ -165,5 +174,10 @@ namespace trview
     bool ViewOptions::show_water() const
     {
         return _water->state();
-    }    
+    }
+
+    bool ViewOptions::animate() const
+    {
+        return _animate->state();
+    }
 }
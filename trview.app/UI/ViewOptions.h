@@ -62,6 +62,11 @@ namespace trview
         /// @remarks This event is not raised by the set_show_water function.
         Event<bool> on_show_water;
 
+        /// Event raised when the user toggles animation. The boolean passed as a parameter when this event is raised
+        /// indicates whether entities are animated.
+        /// @remarks This event is not raised by the set_animate function.
+        Event<bool> on_animate;
+
         /// Set whether an alternate group is enabled. This will not raise the on_alternate_group event.
         /// @param value The group to change.
         /// @param enabled Whether the group is enabled.
@@ -103,6 +108,10 @@ namespace trview
         /// @param show Whether water is visible.
         void set_show_water(bool show);
 
+        /// Set whether entities are animated.
+        /// @param animate Whether entities are animated.
+        void set_animate(bool animate);
+
         /// Set whether to use alternate groups method of flipmaps.
         /// @param value Whether to use alternate groups or a single toggle.
         void set_use_alternate_groups(bool value);
@@ -118,6 +127,10 @@ namespace trview
         /// Get the current value of the show water checkbox.
         /// @returns The current value of the checkbox.
         bool show_water() const;
+
+        /// Get the current value of the animate checkbox.
+        /// @returns The current value of the checkbox.
+        bool animate() const;
     private:
         TokenStore _token_store;
         ui::Checkbox* _highlight;
@@ -125,6 +138,7 @@ namespace trview
         ui::Checkbox* _triggers;
         ui::Checkbox* _hidden_geometry;
         ui::Checkbox* _water;
+        ui::Checkbox* _animate;
         ui::Checkbox* _enabled;
         ui::NumericUpDown* _depth;
         ui::Window* _tr1_3_panel;
@@ -26,6 +26,7 @@ namespace trview
         _token_store += _mouse.mouse_move += [&](long, long)
         {
             _map_renderer->set_cursor_position(client_cursor_position(_window));
+            _level_map->set_cursor_position(client_cursor_position(_window));
             if (_map_tooltip && _map_tooltip->visible())
             {
                 _map_tooltip->set_position(client_cursor_position(_window));
@@ -148,6 +149,8 @@ namespace trview
         _camera_position = std::make_unique<CameraPosition>(*_control);
         _camera_position->on_position_changed += on_camera_position;
 
+        _profiler_overlay = std::make_unique<ProfilerOverlay>(*_control);
+
         // Create the renderer for the UI based on the controls created.
         _ui_renderer = std::make_unique<ui::render::Renderer>(device, shader_storage, font_factory, window.size());
         _ui_renderer->load(_control.get());
@@ -178,6 +181,29 @@ namespace trview
             _map_tooltip->set_position(client_cursor_position(_window));
             _map_tooltip->set_visible(!text.empty());
         };
+
+        _level_map = std::make_unique<LevelMapRenderer>(device, shader_storage, window.size());
+        _token_store += _level_map->on_room_hover += [this](std::optional<uint32_t> room)
+        {
+            on_ui_changed();
+            if (!room)
+            {
+                _map_tooltip->set_visible(false);
+                return;
+            }
+            _map_tooltip->set_text(L"Room " + std::to_wstring(room.value()));
+            _map_tooltip->set_position(client_cursor_position(_window));
+            _map_tooltip->set_visible(_show_tooltip);
+        };
+
+        _token_store += _mouse.mouse_wheel += [&](int16_t delta)
+        {
+            if (_level_map->cursor_is_over_control())
+            {
+                _level_map->zoom(delta);
+                on_ui_changed();
+            }
+        };
     }
 
     void ViewerUI::register_change_detection(Control* control)
@@ -203,6 +229,21 @@ namespace trview
         return _map_renderer->sector_at_cursor();
     }
 
+    std::optional<uint32_t> ViewerUI::current_level_map_room() const
+    {
+        return _level_map->room_at_cursor();
+    }
+
+    bool ViewerUI::is_cursor_over_level_map() const
+    {
+        return _level_map->cursor_is_over_control();
+    }
+
+    bool ViewerUI::level_map_needs_update() const
+    {
+        return _level_map->needs_update();
+    }
+
     bool ViewerUI::is_input_active() const
     {
         const auto focus = _ui_input->focus_control();
@@ -211,8 +252,9 @@ namespace trview
 
     bool ViewerUI::is_cursor_over() const
     {
-        return _control->is_mouse_over(client_cursor_position(_window))
-            || (_map_renderer->loaded() && _map_renderer->cursor_is_over_control());
+        return _ui_input->is_mouse_over(client_cursor_position(_window))
+            || (_map_renderer->loaded() && _map_renderer->cursor_is_over_control())
+            || _level_map->cursor_is_over_control();
     }
 
     void ViewerUI::generate_tool_window(const ITextureStorage& texture_storage)
@@ -226,6 +268,7 @@ namespace trview
         _view_options->on_show_triggers += on_show_triggers;
         _view_options->on_show_hidden_geometry += on_show_hidden_geometry;
         _view_options->on_show_water += on_show_water;
+        _view_options->on_animate += on_animate;
         _view_options->on_depth_changed += on_depth_level_changed;
         _view_options->on_depth_enabled += on_depth;
         _view_options->on_flip += on_flip;
@@ -250,6 +293,7 @@ namespace trview
     void ViewerUI::render(const graphics::Device& device)
     {
         _map_renderer->render(device.context());
+        _level_map->render(device.context());
         _ui_renderer->render(device.context());
     }
 
@@ -318,6 +362,7 @@ namespace trview
         _control->set_size(size);
         _ui_renderer->set_host_size(size);
         _map_renderer->set_window_size(size);
+        _level_map->set_window_size(size);
     }
 
     void ViewerUI::set_level(const std::string& name, trlevel::LevelVersion version)
@@ -386,6 +431,17 @@ namespace trview
         _room_navigator->set_selected_room(room->number());
         _room_navigator->set_room_info(room->info());
         _map_renderer->load(room);
+        _level_map->set_selected_room(room->number());
+    }
+
+    void ViewerUI::set_level_rooms(const std::vector<Room*>& rooms)
+    {
+        _level_map->load(rooms);
+    }
+
+    void ViewerUI::set_level_room_visible(uint32_t room, bool visible)
+    {
+        _level_map->set_room_visible(room, visible);
     }
 
     void ViewerUI::set_show_context_menu(bool value)
@@ -429,6 +485,11 @@ namespace trview
         _view_options->set_show_water(value);
     }
 
+    void ViewerUI::set_animate(bool value)
+    {
+        _view_options->set_animate(value);
+    }
+
     void ViewerUI::set_use_alternate_groups(bool value)
     {
         _view_options->set_use_alternate_groups(value);
@@ -454,8 +515,33 @@ namespace trview
         return _view_options->show_water();
     }
 
+    bool ViewerUI::animate() const
+    {
+        return _view_options->animate();
+    }
+
     void ViewerUI::toggle_settings_visibility()
     {
         _settings_window->toggle_visibility();
     }
+
+    void ViewerUI::toggle_profiler_visibility()
+    {
+        _profiler_overlay->set_visible(!_profiler_overlay->visible());
+    }
+
+    bool ViewerUI::profiler_visible() const
+    {
+        return _profiler_overlay->visible();
+    }
+
+    void ViewerUI::toggle_level_map()
+    {
+        _level_map->set_visible(!_level_map->visible());
+    }
+
+    void ViewerUI::set_profile(const Profiler& profiler, const FrameScheduler::Statistics& frames)
+    {
+        _profiler_overlay->update(profiler, frames);
+    }
 }
@@ -13,9 +13,11 @@
 #include <trview.app/UI/LevelInfo.h>
 #include <trview.app/UI/RoomNavigator.h>
 #include <trview.app/UI/GoTo.h>
+#include <trview.app/UI/LevelMapRenderer.h>
 #include <trview.app/UI/SettingsWindow.h>
 #include <trview.app/UI/CameraControls.h>
 #include <trview.app/UI/CameraPosition.h>
+#include <trview.app/UI/ProfilerOverlay.h>
 #include <trview.app/Geometry/PickInfo.h>
 #include <trview.app/Geometry/PickResult.h>
 #include <trview.app/UI/ContextMenu.h>
@@ -52,6 +54,15 @@ namespace trview
         /// Get the currently hovered minimap sector, if any.
         std::shared_ptr<Sector> current_minimap_sector() const;
 
+        /// Get the room under the cursor on the level map, if any.
+        std::optional<uint32_t> current_level_map_room() const;
+
+        /// Determines if the cursor is over the level map.
+        bool is_cursor_over_level_map() const;
+
+        /// Gets whether the level map still has tiles to draw and should be rendered again.
+        bool level_map_needs_update() const;
+
         /// Get whether there is any text input currently active.
         bool is_input_active() const;
 
@@ -119,6 +130,9 @@ namespace trview
         /// Event raised when the show water setting is changed.
         Event<bool> on_show_water;
 
+        /// Event raised when the animate setting is changed.
+        Event<bool> on_animate;
+
         /// Event raised when a tool is selected.
         Event<Tool> on_tool_selected;
 
@@ -215,6 +229,15 @@ namespace trview
         /// "param value Whether the button is enabled.
         void set_remove_waypoint_enabled(bool value);
 
+        /// Set the rooms to show on the level map.
+        /// @param rooms The rooms in the level.
+        void set_level_rooms(const std::vector<Room*>& rooms);
+
+        /// Set whether a room is shown on the level map.
+        /// @param room The room number.
+        /// @param visible Whether the room is shown.
+        void set_level_room_visible(uint32_t room, bool visible);
+
         /// Set the selected room.
         /// @param room The selected room.
         void set_selected_room(Room* room);
@@ -251,6 +274,10 @@ namespace trview
         /// @param value Whether water is visible.
         void set_show_water(bool value);
 
+        /// Set whether entities are animated.
+        /// @param value Whether entities are animated.
+        void set_animate(bool value);
+
         /// Set whether the level uses alternate groups.
         /// @param value Whether alternate groups are used.
         void set_use_alternate_groups(bool value);
@@ -268,8 +295,25 @@ namespace trview
         /// Get whether water is visible.
         bool show_water() const;
 
+        /// Get whether entities are animated.
+        bool animate() const;
+
         /// Toggle the visibility of the settings window.
         void toggle_settings_visibility();
+
+        /// Toggle the visibility of the profiler overlay.
+        void toggle_profiler_visibility();
+
+        /// Get whether the profiler overlay is visible.
+        bool profiler_visible() const;
+
+        /// Toggle the visibility of the level map.
+        void toggle_level_map();
+
+        /// Update the profiler overlay with the latest frame timings.
+        /// @param profiler The profiler to read from.
+        /// @param frames The number of frames that have been drawn and skipped.
+        void set_profile(const Profiler& profiler, const FrameScheduler::Statistics& frames);
     private:
         void generate_tool_window(const ITextureStorage& texture_storage);
         void initialise_camera_controls(ui::Control& parent);
@@ -292,7 +336,9 @@ namespace trview
         std::unique_ptr<SettingsWindow> _settings_window;
         std::unique_ptr<CameraControls> _camera_controls;
         std::unique_ptr<CameraPosition> _camera_position;
+        std::unique_ptr<ProfilerOverlay> _profiler_overlay;
         std::unique_ptr<ui::render::MapRenderer> _map_renderer;
+        std::unique_ptr<LevelMapRenderer> _level_map;
         std::unique_ptr<Tooltip> _map_tooltip;
         std::unique_ptr<Tooltip> _tooltip;
         ui::Label* _measure;
@@ -130,6 +130,11 @@ namespace trview
         _ui_changed = false;
     }
 
+    bool CollapsiblePanel::needs_render() const
+    {
+        return _ui_changed;
+    }
+
     void CollapsiblePanel::set_panels(std::unique_ptr<ui::Control> left_panel, std::unique_ptr<ui::Control> right_panel)
     {
         auto panel = std::make_unique<StackPanel>(window().size(), Colour(1.0f, 0.5f, 0.5f, 0.5f), Size(0, 0), StackPanel::Direction::Horizontal, SizeMode::Manual);
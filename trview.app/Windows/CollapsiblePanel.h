@@ -64,6 +64,9 @@ namespace trview
         /// @param vsync Whether to use vsync or not.
         void render(const graphics::Device& device, bool vsync);
 
+        /// Gets whether anything in the window has changed since it was last rendered.
+        bool needs_render() const;
+
         /// Event raised when the window is closed.
         Event<> on_window_closed;
     protected:
@@ -50,6 +50,9 @@ namespace trview
         /// @param vsync Whether to use vsync.
         void render(graphics::Device& device, bool vsync);
 
+        /// Gets whether any of the item windows need to be rendered or closed.
+        bool needs_render() const;
+
         /// Set the items to use in the windows.
         /// @param items The items in the level.
         void set_items(const std::vector<Item>& items);
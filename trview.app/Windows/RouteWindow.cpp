@@ -1,5 +1,6 @@
 #include "RouteWindow.h"
 #include <trview.app/Routing/Route.h>
+#include <trview.app/Routing/Pathfinder.h>
 #include <trview.ui/GroupBox.h>
 #include <trview.ui/Button.h>
 #include <trview.common/Strings.h>
@@ -21,6 +22,22 @@ namespace trview
         {
             return Listbox::Item{ { { L"Name", name }, { L"Value", value } } };
         };
+
+        /// Get the length of a path in level units, the same units as the positions.
+        std::wstring path_to_string(const std::vector<DirectX::SimpleMath::Vector3>& path)
+        {
+            if (path.empty())
+            {
+                return L"No path";
+            }
+
+            float length = 0;
+            for (std::size_t i = 1; i < path.size(); ++i)
+            {
+                length += (path[i] - path[i - 1]).Length();
+            }
+            return std::to_wstring(static_cast<int>(length * 1024));
+        }
     }
 
     namespace Colours
@@ -219,7 +236,7 @@ namespace trview
         {
             if (_route && _selected_index < _route->waypoints())
             {
-                _route->waypoint(_selected_index).set_notes(text);
+                _route->set_waypoint_notes(_selected_index, text);
             }
         };
 
@@ -295,6 +312,12 @@ namespace trview
             }
         }
 
+        // The walking distance is only worked out for the selected waypoint as it involves a search.
+        if (_pathfinder && index + 1 < _route->waypoints())
+        {
+            stats.push_back(make_item(L"Walk to Next", path_to_string(_route->find_path(*_pathfinder, index, index + 1))));
+        }
+
         _stats->set_items(stats);
 
         _notes_area->set_text(waypoint.notes());
@@ -329,4 +352,13 @@ namespace trview
     {
         _all_triggers = triggers;
     }
+
+    void RouteWindow::set_pathfinder(const Pathfinder* pathfinder)
+    {
+        _pathfinder = pathfinder;
+        if (_route)
+        {
+            load_waypoint_details(_selected_index);
+        }
+    }
 }
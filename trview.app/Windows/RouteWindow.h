@@ -12,6 +12,7 @@
 namespace trview
 {
     class Route;
+    class Pathfinder;
 
     class RouteWindow final : public CollapsiblePanel
     {
@@ -62,6 +63,10 @@ namespace trview
         /// Set the triggers in the level.
         /// @param triggers The triggers.
         void set_triggers(const std::vector<Trigger*>& triggers);
+
+        /// Set the pathfinder used to show the walking distance between waypoints.
+        /// @param pathfinder The pathfinder for the level, or null if there is no level.
+        void set_pathfinder(const Pathfinder* pathfinder);
     private:
         void load_waypoint_details(uint32_t index);
         std::unique_ptr<ui::Control> create_left_panel();
@@ -75,6 +80,7 @@ namespace trview
         Route* _route{ nullptr };
         std::vector<Item> _all_items;
         std::vector<Trigger*> _all_triggers;
+        const Pathfinder* _pathfinder{ nullptr };
         Waypoint::Type _selected_type{ Waypoint::Type::Position };
         uint32_t       _selected_index{ 0u };
     };
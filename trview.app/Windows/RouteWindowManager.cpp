@@ -40,6 +40,7 @@ namespace trview
 
         _route_window->set_items(_all_items);
         _route_window->set_triggers(_all_triggers);
+        _route_window->set_pathfinder(_pathfinder);
         if (_route)
         {
             _route_window->set_route(_route);
@@ -61,6 +62,11 @@ namespace trview
         }
     }
 
+    bool RouteWindowManager::needs_render() const
+    {
+        return _closing || (_route_window && _route_window->needs_render());
+    }
+
     void RouteWindowManager::set_route(Route* route)
     {
         _route = route;
@@ -92,6 +98,16 @@ namespace trview
         }
     }
 
+    void RouteWindowManager::set_pathfinder(const Pathfinder* pathfinder)
+    {
+        _pathfinder = pathfinder;
+
+        if (_route_window)
+        {
+            _route_window->set_pathfinder(pathfinder);
+        }
+    }
+
     void RouteWindowManager::select_waypoint(uint32_t index)
     {
         _selected_waypoint = index;
@@ -28,6 +28,9 @@ namespace trview
         /// @param vsync Whether to use vsync.
         void render(graphics::Device& device, bool vsync);
 
+        /// Gets whether the route window needs to be rendered or closed.
+        bool needs_render() const;
+
         /// Load the waypoints from the route.
         /// @param route The route to load from.
         void set_route(Route* route);
@@ -43,6 +46,10 @@ namespace trview
         /// @param triggers The triggers.
         void set_triggers(const std::vector<Trigger*>& triggers);
 
+        /// Set the pathfinder used to show the walking distance between waypoints.
+        /// @param pathfinder The pathfinder for the level, or null if there is no level.
+        void set_pathfinder(const Pathfinder* pathfinder);
+
         void select_waypoint(uint32_t index);
 
         /// Event raised when the route colour has changed.
@@ -75,6 +82,7 @@ namespace trview
         Route* _route{ nullptr };
         std::vector<Item> _all_items;
         std::vector<Trigger*> _all_triggers;
+        const Pathfinder* _pathfinder{ nullptr };
         uint32_t _selected_waypoint{ 0u };
     };
 }
@@ -2,6 +2,7 @@
 #include <trview.app/Windows/WindowIDs.h>
 #include <trview.ui.render/Renderer.h>
 #include <trview.graphics/DeviceWindow.h>
+#include <algorithm>
 
 namespace trview
 {
@@ -35,6 +36,12 @@ namespace trview
         }
     }
 
+    bool TriggersWindowManager::needs_render() const
+    {
+        return !_closing_windows.empty() ||
+            std::any_of(_windows.begin(), _windows.end(), [](const auto& window) { return window->needs_render(); });
+    }
+
     void TriggersWindowManager::create_window()
     {
         auto triggers_window = std::make_unique<TriggersWindow>(_device, _shader_storage, _font_factory, window());
@@ -0,0 +1,175 @@
+// Measures the performance of the level tools against real levels.
+//
+// Usage:
+//   trview.benchmark --pathfinding <level>...   Measure how many walkable paths per second can be found
+//                                               between random pairs of boxes in each level.
+//   trview.benchmark --search <folder> [--entity <type>] [--trigger <command>] [--static <mesh>]
+//                                               Index the levels in a folder and the folders in it, then list
+//                                               the levels that have everything that was asked for.
+#define NOMINMAX
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <trlevel/trlevel.h>
+#include <trlevel/LevelLoadException.h>
+#include <trview.app/Library/LevelIndexer.h>
+#include <trview.app/Routing/Pathfinder.h>
+
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    /// The number of queries to run against each level. The same seed is used every time so that
+    /// results can be compared between runs.
+    const uint32_t Pathfinding_Queries = 10000;
+    const uint32_t Pathfinding_Seed = 1234;
+
+    int pathfinding(const std::vector<std::string>& level_filenames)
+    {
+        using namespace std::chrono;
+
+        for (const auto& filename : level_filenames)
+        {
+            auto level = trlevel::load_level(filename);
+
+            const auto build_start = high_resolution_clock::now();
+            trview::Pathfinder pathfinder(*level);
+            const auto build_time = high_resolution_clock::now() - build_start;
+            if (pathfinder.num_boxes() < 2)
+            {
+                std::cout << filename << ": no boxes\n";
+                continue;
+            }
+
+            std::vector<Vector3> centres;
+            for (uint32_t i = 0; i < level->num_boxes(); ++i)
+            {
+                const auto box = level->get_box(i);
+                centres.emplace_back((box.Xmin + box.Xmax) * 0.5f, box.TrueFloor / 1024.0f, (box.Zmin + box.Zmax) * 0.5f);
+            }
+
+            std::mt19937 random(Pathfinding_Seed);
+            std::uniform_int_distribution<uint32_t> distribution(0, pathfinder.num_boxes() - 1);
+            std::vector<std::pair<uint32_t, uint32_t>> queries;
+            for (uint32_t i = 0; i < Pathfinding_Queries; ++i)
+            {
+                queries.emplace_back(distribution(random), distribution(random));
+            }
+
+            uint64_t found = 0;
+            uint64_t points = 0;
+            auto slowest = high_resolution_clock::duration::zero();
+            const auto start = high_resolution_clock::now();
+            for (const auto& query : queries)
+            {
+                const auto query_start = high_resolution_clock::now();
+                const auto path = pathfinder.find_path(centres[query.first], centres[query.second]);
+                slowest = std::max(slowest, high_resolution_clock::now() - query_start);
+                if (!path.empty())
+                {
+                    ++found;
+                    points += path.size();
+                }
+            }
+            const auto elapsed = high_resolution_clock::now() - start;
+
+            const double seconds_taken = duration_cast<duration<double>>(elapsed).count();
+            std::cout << filename << ": " << pathfinder.num_boxes() << " boxes, "
+                << pathfinder.num_connections() << " connections, built in "
+                << duration_cast<microseconds>(build_time).count() << "us, "
+                << static_cast<uint64_t>(queries.size() / seconds_taken) << " queries/s, slowest "
+                << duration_cast<microseconds>(slowest).count() << "us ("
+                << found << " paths, " << (found ? points / found : 0) << " points on average)\n";
+        }
+        return 0;
+    }
+
+    bool parse_filter(const std::vector<std::string>& args, trview::LevelFilter& filter)
+    {
+        for (std::size_t i = 0; i + 1 < args.size(); i += 2)
+        {
+            const auto value = std::stoi(args[i + 1]);
+            if (args[i] == "--entity")
+            {
+                filter.entity_type = static_cast<int16_t>(value);
+            }
+            else if (args[i] == "--trigger")
+            {
+                filter.trigger_command = static_cast<uint16_t>(value);
+            }
+            else if (args[i] == "--static")
+            {
+                filter.static_mesh = static_cast<uint16_t>(value);
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return args.size() % 2 == 0;
+    }
+
+    int search(const std::string& folder, const trview::LevelFilter& filter)
+    {
+        using namespace std::chrono;
+
+        // The index isn't loaded or saved, so the viewer's index isn't changed and every level is summarised.
+        trview::LevelIndexer indexer{ std::wstring() };
+        const auto index_start = high_resolution_clock::now();
+        indexer.scan(folder, true);
+        indexer.wait();
+        const auto index_time = high_resolution_clock::now() - index_start;
+
+        const auto search_start = high_resolution_clock::now();
+        const auto levels = indexer.find(filter);
+        const auto search_time = high_resolution_clock::now() - search_start;
+
+        for (const auto& level : levels)
+        {
+            std::cout << level.file.path << '\n';
+        }
+        std::cout << levels.size() << " levels, indexed in "
+            << duration_cast<milliseconds>(index_time).count() << "ms, searched in "
+            << duration_cast<microseconds>(search_time).count() << "us\n";
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const std::vector<std::string> args(argv + 1, argv + argc);
+
+    try
+    {
+        if (args.size() > 1 && args[0] == "--pathfinding")
+        {
+            return pathfinding({ args.begin() + 1, args.end() });
+        }
+
+        trview::LevelFilter filter;
+        if (args.size() > 1 && args[0] == "--search" && parse_filter({ args.begin() + 2, args.end() }, filter))
+        {
+            return search(args[1], filter);
+        }
+    }
+    catch (const trlevel::LevelLoadException&)
+    {
+        std::cout << "Failed to load level\n";
+        return 1;
+    }
+    catch (const std::logic_error&)
+    {
+        // A value that isn't a number, so show the usage.
+    }
+
+    std::cout << "Usage: trview.benchmark --pathfinding <level>...\n"
+        << "       trview.benchmark --search <folder> [--entity <type>] [--trigger <command>] [--static <mesh>]\n";
+    return 1;
+}
@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+#include <trview.common/ContentKey.h>
+
+using namespace trview;
+
+/// Tests that the same values produce the same key.
+TEST(ContentKey, SameValuesSameKey)
+{
+    ContentKey first;
+    first.add(1.5f).add(std::wstring(L"Room 12")).add(3u);
+    ContentKey second;
+    second.add(1.5f).add(std::wstring(L"Room 12")).add(3u);
+    ASSERT_EQ(first.value(), second.value());
+}
+
+/// Tests that changing any value changes the key.
+TEST(ContentKey, DifferentValuesDifferentKey)
+{
+    ContentKey first;
+    first.add(1.5f).add(std::wstring(L"Room 12"));
+    ContentKey second;
+    second.add(1.5f).add(std::wstring(L"Room 13"));
+    ContentKey third;
+    third.add(2.5f).add(std::wstring(L"Room 12"));
+    ASSERT_NE(first.value(), second.value());
+    ASSERT_NE(first.value(), third.value());
+}
+
+/// Tests that moving characters between strings changes the key.
+TEST(ContentKey, StringBoundariesIncluded)
+{
+    ContentKey first;
+    first.add(std::wstring(L"ab")).add(std::wstring(L"c"));
+    ContentKey second;
+    second.add(std::wstring(L"a")).add(std::wstring(L"bc"));
+    ASSERT_NE(first.value(), second.value());
+}
@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+#include <trview.common/FrameScheduler.h>
+
+using namespace trview;
+
+/// Tests that nothing is drawn when there is nothing to do and that the message loop can wait for input.
+TEST(FrameScheduler, IdleWaitsForInput)
+{
+    double time = 0.0;
+    FrameScheduler scheduler([&]() { return time; });
+
+    ASSERT_FALSE(scheduler.begin_frame(false));
+    ASSERT_TRUE(scheduler.idle());
+    ASSERT_EQ(FrameScheduler::Wait_For_Input, scheduler.wait_time());
+    ASSERT_EQ(1u, scheduler.statistics().idle);
+
+    ASSERT_TRUE(scheduler.begin_frame(true));
+    ASSERT_FALSE(scheduler.idle());
+    ASSERT_EQ(0u, scheduler.wait_time());
+    ASSERT_EQ(1u, scheduler.statistics().drawn);
+}
+
+/// Tests that frames are not drawn more often than the frame cap allows.
+TEST(FrameScheduler, FrameCapLimitsFrames)
+{
+    double time = 0.0;
+    FrameScheduler scheduler([&]() { return time; }, 50);
+
+    ASSERT_TRUE(scheduler.begin_frame(true));
+    ASSERT_EQ(20u, scheduler.wait_time());
+
+    time = 0.015;
+    ASSERT_FALSE(scheduler.begin_frame(true));
+    ASSERT_EQ(5u, scheduler.wait_time());
+    ASSERT_EQ(1u, scheduler.statistics().capped);
+
+    time = 0.02;
+    ASSERT_TRUE(scheduler.begin_frame(true));
+    ASSERT_EQ(2u, scheduler.statistics().drawn);
+}
+
+/// Tests that without a frame cap every frame with work is drawn.
+TEST(FrameScheduler, NoFrameCap)
+{
+    double time = 0.0;
+    FrameScheduler scheduler([&]() { return time; });
+
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(scheduler.begin_frame(true));
+        ASSERT_EQ(0u, scheduler.wait_time());
+    }
+    ASSERT_EQ(5u, scheduler.statistics().drawn);
+    ASSERT_EQ(0u, scheduler.statistics().capped);
+}
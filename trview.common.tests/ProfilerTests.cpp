@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+#include <trview.common/Profiler.h>
+
+using namespace trview;
+
+namespace
+{
+    // Time source that returns a time that the test controls, in seconds.
+    struct TimeSource
+    {
+        double time{ 0.0 };
+
+        operator std::function<double()>()
+        {
+            return [this]() { return time; };
+        }
+    };
+}
+
+/// Tests that a frame records its duration and is added to the history.
+TEST(Profiler, FrameDuration)
+{
+    TimeSource source;
+    Profiler profiler(source);
+
+    profiler.begin_frame();
+    source.time = 0.016;
+    profiler.end_frame();
+
+    ASSERT_EQ(1u, profiler.frames().size());
+    ASSERT_EQ(0u, profiler.frames().back().number);
+    ASSERT_NEAR(16.0f, profiler.frames().back().duration, 0.01f);
+}
+
+/// Tests that sections record their duration and nesting depth.
+TEST(Profiler, Sections)
+{
+    TimeSource source;
+    Profiler profiler(source);
+
+    profiler.begin_frame();
+    {
+        ProfileScope outer(profiler, "outer");
+        source.time = 0.001;
+        {
+            ProfileScope inner(profiler, "inner");
+            source.time = 0.003;
+        }
+    }
+    profiler.end_frame();
+
+    const auto& frame = profiler.frames().back();
+    ASSERT_EQ(2u, frame.sections.size());
+    ASSERT_EQ(0u, frame.sections[0].depth);
+    ASSERT_EQ(1u, frame.sections[1].depth);
+    ASSERT_NEAR(3.0f, frame.section_duration("outer"), 0.01f);
+    ASSERT_NEAR(2.0f, frame.section_duration("inner"), 0.01f);
+    ASSERT_EQ(0.0f, frame.section_duration("missing"));
+}
+
+/// Tests that counters are captured by the frame that they were counted in and then reset.
+TEST(Profiler, CountersResetEachFrame)
+{
+    TimeSource source;
+    Profiler profiler(source);
+
+    profiler.begin_frame();
+    profile_count(ProfileCounter::DrawCalls, 3);
+    profile_count(ProfileCounter::DrawCalls);
+    profiler.end_frame();
+
+    profiler.begin_frame();
+    profiler.end_frame();
+
+    ASSERT_EQ(4u, profiler.frames()[0].counter(ProfileCounter::DrawCalls));
+    ASSERT_EQ(0u, profiler.frames()[1].counter(ProfileCounter::DrawCalls));
+}
+
+/// Tests that the history is limited to the requested number of frames.
+TEST(Profiler, HistoryLimit)
+{
+    TimeSource source;
+    Profiler profiler(source, 2);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        profiler.begin_frame();
+        profiler.end_frame();
+    }
+
+    ASSERT_EQ(2u, profiler.frames().size());
+    ASSERT_EQ(3u, profiler.frames().front().number);
+}
+
+/// Tests that a GPU duration is assigned to the frame with the given number.
+TEST(Profiler, GpuDuration)
+{
+    TimeSource source;
+    Profiler profiler(source);
+
+    std::vector<uint64_t> numbers;
+    for (int i = 0; i < 3; ++i)
+    {
+        profiler.begin_frame();
+        numbers.push_back(profiler.frame_number());
+        profiler.end_frame();
+    }
+    profiler.set_gpu_duration(numbers[1], 5.0f);
+    profiler.set_gpu_duration(numbers[2] + 10, 5.0f);
+
+    ASSERT_LT(profiler.frames()[0].gpu_duration, 0.0f);
+    ASSERT_EQ(5.0f, profiler.frames()[1].gpu_duration);
+    ASSERT_LT(profiler.frames()[2].gpu_duration, 0.0f);
+}
+
+/// Tests that a GPU duration lands on the right frame when the history has dropped older frames.
+TEST(Profiler, GpuDurationAfterHistoryDropped)
+{
+    TimeSource source;
+    Profiler profiler(source, 2);
+
+    uint64_t first = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        profiler.begin_frame();
+        if (i == 2)
+        {
+            first = profiler.frame_number();
+        }
+        profiler.end_frame();
+    }
+    profiler.set_gpu_duration(first, 5.0f);
+    profiler.set_gpu_duration(first - 1, 7.0f);
+
+    ASSERT_EQ(5.0f, profiler.frames()[0].gpu_duration);
+    ASSERT_LT(profiler.frames()[1].gpu_duration, 0.0f);
+}
+
+/// Tests that short durations are still measured accurately after the application has been running for a long time.
+TEST(Profiler, DurationAfterLongRunningTime)
+{
+    TimeSource source;
+    source.time = 1000.0;
+    Profiler profiler(source);
+
+    source.time = 36000.0;
+    profiler.begin_frame();
+    profiler.begin_section("section");
+    source.time += 0.0001;
+    profiler.end_section();
+    profiler.end_frame();
+
+    ASSERT_EQ(1u, profiler.frames().size());
+    ASSERT_NEAR(0.1f, profiler.frames()[0].duration, 0.001f);
+    ASSERT_NEAR(0.1f, profiler.frames()[0].sections[0].duration, 0.001f);
+    ASSERT_NEAR(35000000.0, profiler.frames()[0].start, 0.001);
+}
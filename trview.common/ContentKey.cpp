@@ -0,0 +1,28 @@
+#include "ContentKey.h"
+
+namespace trview
+{
+    ContentKey& ContentKey::add(const std::wstring& value)
+    {
+        // Add the length as well so that adjacent strings can't produce the same key by moving characters between them.
+        add(value.size());
+        return add_bytes(value.data(), value.size() * sizeof(wchar_t));
+    }
+
+    uint64_t ContentKey::value() const
+    {
+        return _value;
+    }
+
+    ContentKey& ContentKey::add_bytes(const void* data, std::size_t size)
+    {
+        // FNV-1a.
+        const auto bytes = static_cast<const uint8_t*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            _value ^= bytes[i];
+            _value *= 1099511628211ull;
+        }
+        return *this;
+    }
+}
@@ -0,0 +1,41 @@
+/// @file ContentKey.h
+/// @brief Builds a hash of the values that something depends on.
+///
+/// Used to tell whether anything that affects how something looks has actually changed since it was
+/// last drawn, so that the drawing can be skipped when an update turns out to change nothing.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace trview
+{
+    /// Builds a hash of the values that something depends on.
+    class ContentKey final
+    {
+    public:
+        /// Add the bytes of a value to the key. The value must not contain any padding.
+        /// @param value The value to add.
+        /// @returns This key.
+        template <typename T>
+        ContentKey& add(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be added to a content key");
+            return add_bytes(&value, sizeof(value));
+        }
+
+        /// Add a string to the key.
+        /// @param value The string to add.
+        /// @returns This key.
+        ContentKey& add(const std::wstring& value);
+
+        /// Get the hash of the values added so far.
+        uint64_t value() const;
+    private:
+        ContentKey& add_bytes(const void* data, std::size_t size);
+
+        uint64_t _value{ 14695981039346656037ull };
+    };
+}
@@ -0,0 +1,73 @@
+#define NOMINMAX
+#include "FrameScheduler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace trview
+{
+    FrameScheduler::FrameScheduler(const std::function<double()>& time_source, uint32_t frame_cap)
+        : _time_source(time_source), _frame_cap(frame_cap)
+    {
+    }
+
+    void FrameScheduler::set_frame_cap(uint32_t frame_cap)
+    {
+        _frame_cap = frame_cap;
+    }
+
+    uint32_t FrameScheduler::frame_cap() const
+    {
+        return _frame_cap;
+    }
+
+    bool FrameScheduler::begin_frame(bool has_work)
+    {
+        if (!has_work)
+        {
+            _idle = true;
+            ++_statistics.idle;
+            return false;
+        }
+
+        _idle = false;
+
+        const double now = _time_source();
+        if (_has_drawn && _frame_cap && now - _last_frame < 1.0 / _frame_cap)
+        {
+            ++_statistics.capped;
+            return false;
+        }
+
+        _has_drawn = true;
+        _last_frame = now;
+        ++_statistics.drawn;
+        return true;
+    }
+
+    uint32_t FrameScheduler::wait_time() const
+    {
+        if (_idle)
+        {
+            return Wait_For_Input;
+        }
+
+        if (!_frame_cap || !_has_drawn)
+        {
+            return 0u;
+        }
+
+        // Round to the nearest microsecond first so that rounding error in the time doesn't add a millisecond.
+        const double remaining = std::round((_last_frame + 1.0 / _frame_cap - _time_source()) * 1000000.0) / 1000.0;
+        return static_cast<uint32_t>(std::max(0.0, std::ceil(remaining)));
+    }
+
+    bool FrameScheduler::idle() const
+    {
+        return _idle;
+    }
+
+    const FrameScheduler::Statistics& FrameScheduler::statistics() const
+    {
+        return _statistics;
+    }
+}
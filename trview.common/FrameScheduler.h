@@ -0,0 +1,69 @@
+/// @file FrameScheduler.h
+/// @brief Decides when a frame should be drawn and how long to wait before the next one.
+///
+/// Frames are only drawn when something needs to be drawn, and never more often than the frame cap
+/// allows. When there is nothing to draw the message loop can wait for input instead of polling, so
+/// the viewer doesn't use any CPU while it is left open and idle.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace trview
+{
+    /// Decides when a frame should be drawn and how long to wait before the next one.
+    class FrameScheduler final
+    {
+    public:
+        /// Returned by wait_time when there is nothing to do until something changes. This has the same value
+        /// as INFINITE, so it can be passed straight to the Windows wait functions.
+        static const uint32_t Wait_For_Input = 0xFFFFFFFF;
+
+        /// The number of frames that have been drawn and skipped.
+        struct Statistics
+        {
+            /// Frames that were drawn.
+            uint64_t drawn{ 0u };
+            /// Frames that were skipped because nothing needed to be drawn.
+            uint64_t idle{ 0u };
+            /// Frames that were skipped because the previous frame was too recent.
+            uint64_t capped{ 0u };
+        };
+
+        /// Create a new frame scheduler.
+        /// @param time_source The function to call to get the current time in seconds.
+        /// @param frame_cap The maximum number of frames per second, or 0 for no limit.
+        explicit FrameScheduler(const std::function<double()>& time_source, uint32_t frame_cap = 0u);
+
+        /// Set the maximum number of frames per second.
+        /// @param frame_cap The maximum number of frames per second, or 0 for no limit.
+        void set_frame_cap(uint32_t frame_cap);
+
+        /// Get the maximum number of frames per second, or 0 if there is no limit.
+        uint32_t frame_cap() const;
+
+        /// Decide whether to draw a frame now.
+        /// @param has_work Whether anything needs to be drawn or updated.
+        /// @returns True if a frame should be drawn.
+        bool begin_frame(bool has_work);
+
+        /// Get how long the message loop can wait for input before begin_frame should be called again.
+        /// @returns The time in milliseconds, or Wait_For_Input if there is nothing to do.
+        uint32_t wait_time() const;
+
+        /// Gets whether the last call to begin_frame had nothing to do. The time since then has been spent waiting
+        /// for input and shouldn't be counted as time that anything was animating for.
+        bool idle() const;
+
+        /// Get the number of frames that have been drawn and skipped.
+        const Statistics& statistics() const;
+    private:
+        std::function<double()> _time_source;
+        uint32_t _frame_cap;
+        double _last_frame{ 0.0 };
+        bool _has_drawn{ false };
+        bool _idle{ false };
+        Statistics _statistics;
+    };
+}
@@ -0,0 +1,272 @@
+#include "Profiler.h"
+
+#include <atomic>
+#include <fstream>
+#include <map>
+
+namespace trview
+{
+    namespace
+    {
+        std::array<std::atomic<uint32_t>, static_cast<uint32_t>(ProfileCounter::Count)> counters{};
+
+        /// Escape a string for use in a JSON string literal.
+        std::string escape(const std::string& value)
+        {
+            std::string result;
+            for (auto c : value)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    result += '\\';
+                }
+                result += c;
+            }
+            return result;
+        }
+    }
+
+    void profile_count(ProfileCounter counter, uint32_t amount)
+    {
+        counters[static_cast<uint32_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    std::string profile_counter_name(ProfileCounter counter)
+    {
+        switch (counter)
+        {
+        case ProfileCounter::DrawCalls:
+            return "draw_calls";
+        case ProfileCounter::BufferMaps:
+            return "buffer_maps";
+        case ProfileCounter::RenderTargetSwitches:
+            return "render_target_switches";
+        case ProfileCounter::RenderTargetCreations:
+            return "render_target_creations";
+        case ProfileCounter::TransparentTriangles:
+            return "transparent_triangles";
+        case ProfileCounter::UiRedraws:
+            return "ui_redraws";
+        case ProfileCounter::UiRedrawsSkipped:
+            return "ui_redraws_skipped";
+        }
+        return "unknown";
+    }
+
+    uint32_t Profiler::Frame::counter(ProfileCounter counter) const
+    {
+        return counters[static_cast<uint32_t>(counter)];
+    }
+
+    float Profiler::Frame::section_duration(const std::string& name) const
+    {
+        float total = 0.0f;
+        for (const auto& section : sections)
+        {
+            if (section.name == name)
+            {
+                total += section.duration;
+            }
+        }
+        return total;
+    }
+
+    Profiler::Profiler(const std::function<double()>& time_source, std::size_t history)
+        : _time_source(time_source), _start_time(time_source()), _history(history)
+    {
+    }
+
+    void Profiler::begin_frame()
+    {
+        if (_in_frame)
+        {
+            end_frame();
+        }
+
+        _current = Frame();
+        _current.number = _frame_number++;
+        _current.start = now();
+        _open_sections.clear();
+        _in_frame = true;
+    }
+
+    void Profiler::end_frame()
+    {
+        if (!_in_frame)
+        {
+            return;
+        }
+
+        while (!_open_sections.empty())
+        {
+            end_section();
+        }
+
+        _current.duration = static_cast<float>(now() - _current.start);
+        for (uint32_t i = 0; i < counters.size(); ++i)
+        {
+            _current.counters[i] = counters[i].exchange(0u, std::memory_order_relaxed);
+        }
+
+        _frames.push_back(std::move(_current));
+        while (_frames.size() > _history)
+        {
+            _frames.pop_front();
+        }
+        _in_frame = false;
+    }
+
+    void Profiler::begin_section(const std::string& name)
+    {
+        if (!_in_frame)
+        {
+            return;
+        }
+
+        _open_sections.push_back(_current.sections.size());
+        _current.sections.push_back({ name, static_cast<float>(now() - _current.start), 0.0f, static_cast<uint32_t>(_open_sections.size() - 1) });
+    }
+
+    void Profiler::end_section()
+    {
+        if (!_in_frame || _open_sections.empty())
+        {
+            return;
+        }
+
+        auto& section = _current.sections[_open_sections.back()];
+        section.duration = static_cast<float>(now() - _current.start - section.start);
+        _open_sections.pop_back();
+    }
+
+    uint64_t Profiler::frame_number() const
+    {
+        return _in_frame ? _current.number : _frame_number;
+    }
+
+    void Profiler::set_gpu_duration(uint64_t frame_number, float duration)
+    {
+        // The frames in the history have consecutive numbers.
+        if (!_frames.empty() && frame_number >= _frames.front().number && frame_number <= _frames.back().number)
+        {
+            _frames[static_cast<std::size_t>(frame_number - _frames.front().number)].gpu_duration = duration;
+        }
+    }
+
+    const std::deque<Profiler::Frame>& Profiler::frames() const
+    {
+        return _frames;
+    }
+
+    bool Profiler::write_csv(const std::string& filename) const
+    {
+        std::ofstream file(filename);
+        if (!file)
+        {
+            return false;
+        }
+
+        // Every section name that appears in the history becomes a column.
+        std::map<std::string, std::size_t> section_names;
+        for (const auto& frame : _frames)
+        {
+            for (const auto& section : frame.sections)
+            {
+                section_names.insert({ section.name, section_names.size() });
+            }
+        }
+
+        file << "frame,start_ms,cpu_ms,gpu_ms";
+        for (uint32_t i = 0; i < static_cast<uint32_t>(ProfileCounter::Count); ++i)
+        {
+            file << ',' << profile_counter_name(static_cast<ProfileCounter>(i));
+        }
+        for (const auto& name : section_names)
+        {
+            file << ',' << name.first << "_ms";
+        }
+        file << '\n';
+
+        for (const auto& frame : _frames)
+        {
+            file << frame.number << ',' << frame.start << ',' << frame.duration << ',';
+            if (frame.gpu_duration >= 0)
+            {
+                file << frame.gpu_duration;
+            }
+            for (auto value : frame.counters)
+            {
+                file << ',' << value;
+            }
+            for (const auto& name : section_names)
+            {
+                file << ',' << frame.section_duration(name.first);
+            }
+            file << '\n';
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    bool Profiler::write_trace(const std::string& filename) const
+    {
+        std::ofstream file(filename);
+        if (!file)
+        {
+            return false;
+        }
+
+        // Times in the trace format are in microseconds.
+        bool first = true;
+        auto write_event = [&](const std::string& event)
+        {
+            file << (first ? "\n" : ",\n") << event;
+            first = false;
+        };
+
+        file << "{\"traceEvents\":[";
+        for (const auto& frame : _frames)
+        {
+            write_event("{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" + std::to_string(frame.start * 1000.0) +
+                ",\"dur\":" + std::to_string(frame.duration * 1000.0f) + ",\"args\":{\"frame\":" + std::to_string(frame.number) + "}}");
+
+            for (const auto& section : frame.sections)
+            {
+                write_event("{\"name\":\"" + escape(section.name) + "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" +
+                    std::to_string((frame.start + section.start) * 1000.0) + ",\"dur\":" + std::to_string(section.duration * 1000.0f) + "}");
+            }
+
+            std::string args;
+            for (uint32_t i = 0; i < frame.counters.size(); ++i)
+            {
+                args += (i ? "," : "") + std::string("\"") + profile_counter_name(static_cast<ProfileCounter>(i)) + "\":" + std::to_string(frame.counters[i]);
+            }
+            write_event("{\"name\":\"counters\",\"ph\":\"C\",\"pid\":1,\"ts\":" + std::to_string(frame.start * 1000.0) + ",\"args\":{" + args + "}}");
+
+            if (frame.gpu_duration >= 0)
+            {
+                write_event("{\"name\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":" + std::to_string(frame.start * 1000.0) +
+                    ",\"dur\":" + std::to_string(frame.gpu_duration * 1000.0f) + "}");
+            }
+        }
+        file << "\n]}\n";
+
+        return static_cast<bool>(file);
+    }
+
+    double Profiler::now() const
+    {
+        return (_time_source() - _start_time) * 1000.0;
+    }
+
+    ProfileScope::ProfileScope(Profiler& profiler, const std::string& name)
+        : _profiler(profiler)
+    {
+        _profiler.begin_section(name);
+    }
+
+    ProfileScope::~ProfileScope()
+    {
+        _profiler.end_section();
+    }
+}
@@ -0,0 +1,152 @@
+/// @file Profiler.h
+/// @brief Records CPU timings and rendering counters for each frame.
+///
+/// The profiler keeps a history of recent frames. Each frame has the time taken by named sections of
+/// the frame and the values of the rendering counters, and the history can be exported to a CSV file or
+/// to a trace file that can be loaded into chrome://tracing.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace trview
+{
+    /// Counters for work submitted to the GPU.
+    enum class ProfileCounter : uint32_t
+    {
+        DrawCalls,
+        BufferMaps,
+        RenderTargetSwitches,
+        /// Render targets created by the render target pool.
+        RenderTargetCreations,
+        TransparentTriangles,
+        /// UI nodes that were drawn again.
+        UiRedraws,
+        /// UI nodes that were invalidated but skipped because nothing they show had changed.
+        UiRedrawsSkipped,
+        Count
+    };
+
+    /// Add to a counter for the current frame. Counters are global so that low level rendering code can
+    /// record work without needing access to the profiler.
+    /// @param counter The counter to add to.
+    /// @param amount The amount to add.
+    void profile_count(ProfileCounter counter, uint32_t amount = 1);
+
+    /// Get the name of a counter, as used in exported files.
+    /// @param counter The counter.
+    /// @returns The counter name.
+    std::string profile_counter_name(ProfileCounter counter);
+
+    /// Records CPU timings and rendering counters for each frame.
+    class Profiler final
+    {
+    public:
+        /// A timed section of a frame.
+        struct Section
+        {
+            std::string name;
+            /// The time in milliseconds from the start of the frame to the start of the section.
+            float start;
+            /// The time in milliseconds that the section took.
+            float duration;
+            /// How many sections this section is nested in.
+            uint32_t depth;
+        };
+
+        /// The measurements for a single frame.
+        struct Frame
+        {
+            uint64_t number{ 0u };
+            /// The time in milliseconds from the start of profiling to the start of the frame.
+            double start{ 0.0 };
+            /// The CPU time in milliseconds that the frame took.
+            float duration{ 0.0f };
+            /// The GPU time in milliseconds that the frame took or a negative value if this is not known.
+            float gpu_duration{ -1.0f };
+            std::vector<Section> sections;
+            std::array<uint32_t, static_cast<uint32_t>(ProfileCounter::Count)> counters{};
+
+            /// Get the value of a counter for this frame.
+            uint32_t counter(ProfileCounter counter) const;
+
+            /// Get the total time of all sections with the specified name.
+            float section_duration(const std::string& name) const;
+        };
+
+        /// Create a new profiler.
+        /// @param time_source The source of time in seconds. This should be a double precision source such as
+        /// precise_time_source, as a float loses sub-millisecond precision after the application has been running for an hour.
+        /// @param history The number of frames to keep.
+        explicit Profiler(const std::function<double()>& time_source, std::size_t history = 600);
+
+        /// Start recording a new frame.
+        void begin_frame();
+
+        /// Finish recording the current frame and add it to the history. The global counters are reset.
+        void end_frame();
+
+        /// Start a named section of the current frame. Sections can be nested.
+        /// @param name The name of the section.
+        void begin_section(const std::string& name);
+
+        /// End the most recently started section.
+        void end_section();
+
+        /// Gets the number of the frame that is being recorded, or of the next frame if no frame is being recorded.
+        uint64_t frame_number() const;
+
+        /// Set the GPU time for a frame that has already finished. GPU timings are only available some frames later.
+        /// @param frame_number The number of the frame that the timing is for, from frame_number when it was recorded.
+        /// @param duration The time in milliseconds.
+        void set_gpu_duration(uint64_t frame_number, float duration);
+
+        /// Get the recorded frames, oldest first.
+        const std::deque<Frame>& frames() const;
+
+        /// Write the recorded frames to a CSV file. There is one row for each frame with the frame times,
+        /// the counters and the total time for each section name.
+        /// @param filename The file to write.
+        /// @returns True if the file was written.
+        bool write_csv(const std::string& filename) const;
+
+        /// Write the recorded frames to a trace file in the Trace Event format used by chrome://tracing.
+        /// @param filename The file to write.
+        /// @returns True if the file was written.
+        bool write_trace(const std::string& filename) const;
+    private:
+        double now() const;
+
+        std::function<double()> _time_source;
+        double _start_time;
+        std::size_t _history;
+        std::deque<Frame> _frames;
+        Frame _current;
+        std::vector<std::size_t> _open_sections;
+        uint64_t _frame_number{ 0u };
+        bool _in_frame{ false };
+    };
+
+    /// Times a section of the frame for as long as the object exists.
+    class ProfileScope final
+    {
+    public:
+        /// Start timing a section.
+        /// @param profiler The profiler to record the section in.
+        /// @param name The name of the section.
+        ProfileScope(Profiler& profiler, const std::string& name);
+
+        /// End the section.
+        ~ProfileScope();
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    private:
+        Profiler& _profiler;
+    };
+}
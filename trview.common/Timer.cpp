@@ -48,4 +48,20 @@ namespace trview
             return static_cast<float>(tick.QuadPart - start.QuadPart) / static_cast<float>(frequency.QuadPart);
         };
     }
+
+    std::function<double()> precise_time_source()
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+
+        LARGE_INTEGER start;
+        QueryPerformanceCounter(&start);
+
+        return [frequency, start]()
+        {
+            LARGE_INTEGER tick;
+            QueryPerformanceCounter(&tick);
+            return static_cast<double>(tick.QuadPart - start.QuadPart) / static_cast<double>(frequency.QuadPart);
+        };
+    }
 }
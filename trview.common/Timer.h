@@ -46,4 +46,9 @@ namespace trview
     /// Creates a time source that uses the Windows high performance counter to measure the passage of time.
     /// @returns The time source function to call.
     std::function<float()> default_time_source();
+
+    /// Creates a time source that uses the Windows high performance counter and keeps its precision however
+    /// long the application has been running. Use this for measuring short intervals, such as profiling.
+    /// @returns The time source function to call, which returns the time in seconds.
+    std::function<double()> precise_time_source();
 }
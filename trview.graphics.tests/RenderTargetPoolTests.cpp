@@ -0,0 +1,39 @@
+#include "gtest/gtest.h"
+#include <trview.graphics/RenderTargetPool.h>
+
+using namespace trview::graphics;
+
+/// Tests that small sizes are rounded up to the minimum bucket size.
+TEST(RenderTargetPool, SmallSizesUseMinimumBucket)
+{
+    ASSERT_EQ(32u, RenderTargetPool::bucket(0));
+    ASSERT_EQ(32u, RenderTargetPool::bucket(1));
+    ASSERT_EQ(32u, RenderTargetPool::bucket(32));
+    ASSERT_EQ(64u, RenderTargetPool::bucket(33));
+}
+
+/// Tests that large sizes are rounded up to an eighth of the power of two below them.
+TEST(RenderTargetPool, LargeSizesRoundedToEighth)
+{
+    ASSERT_EQ(1024u, RenderTargetPool::bucket(1000));
+    ASSERT_EQ(1024u, RenderTargetPool::bucket(1024));
+    ASSERT_EQ(1152u, RenderTargetPool::bucket(1025));
+    ASSERT_EQ(1920u, RenderTargetPool::bucket(1920));
+    ASSERT_EQ(1152u, RenderTargetPool::bucket(1080));
+}
+
+/// Tests that sizes that are close together share a bucket so that resizing doesn't need a new texture.
+TEST(RenderTargetPool, NearbySizesShareBucket)
+{
+    for (uint32_t size = 1793; size <= 1920; ++size)
+    {
+        ASSERT_EQ(1920u, RenderTargetPool::bucket(size));
+    }
+}
+
+/// Tests that a render target with a depth stencil counts the memory for both textures.
+TEST(RenderTargetPool, SizeInBytes)
+{
+    ASSERT_EQ(4u * 1920 * 1152, RenderTargetPool::size_in_bytes(1920, 1152, RenderTarget::DepthStencilMode::Disabled));
+    ASSERT_EQ(8u * 1920 * 1152, RenderTargetPool::size_in_bytes(1920, 1152, RenderTarget::DepthStencilMode::Enabled));
+}
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include <trview.graphics/TextLayoutCache.h>
+
+using namespace trview;
+using namespace trview::graphics;
+using namespace DirectX;
+
+namespace
+{
+    /// Create a sprite font without a sprite sheet. Each glyph is 4x8 with 1 pixel between glyphs.
+    std::shared_ptr<SpriteFont> create_font()
+    {
+        const SpriteFont::Glyph glyphs[] =
+        {
+            { L' ', { 0, 0, 1, 1 }, 0, 0, 3 },
+            { L'?', { 0, 0, 4, 8 }, 0, 1, 1 },
+            { L'a', { 4, 0, 8, 8 }, 0, 1, 1 },
+            { L'b', { 8, 0, 12, 8 }, 0, 1, 1 }
+        };
+        return std::make_shared<SpriteFont>(nullptr, glyphs, sizeof(glyphs) / sizeof(glyphs[0]), 10.0f);
+    }
+}
+
+/// Tests that the layout matches what the sprite font measures for the same text.
+TEST(TextLayoutCache, LayoutMatchesSpriteFont)
+{
+    auto font = create_font();
+    TextLayoutCache cache(font);
+
+    for (const auto& text : { std::wstring(L"a"), std::wstring(L"ab ba"), std::wstring(L"b  ") })
+    {
+        XMFLOAT2 expected;
+        XMStoreFloat2(&expected, font->MeasureString(text.c_str()));
+        const auto size = cache.layout(text).size();
+        ASSERT_EQ(expected.x, size.width);
+        ASSERT_EQ(expected.y, size.height);
+    }
+}
+
+/// Tests that glyphs are positioned one after the other and whitespace is not drawn.
+TEST(TextLayoutCache, GlyphPositions)
+{
+    TextLayoutCache cache(create_font());
+    const auto& layout = cache.layout(L"a b");
+    ASSERT_EQ(2u, layout.glyphs.size());
+    ASSERT_EQ(0.0f, layout.glyphs[0].x);
+    ASSERT_EQ(1.0f, layout.glyphs[0].y);
+    ASSERT_EQ(4, layout.glyphs[0].source.left);
+    ASSERT_EQ(9.0f, layout.glyphs[1].x);
+    ASSERT_EQ(8, layout.glyphs[1].source.left);
+}
+
+/// Tests that characters that are not in the font are replaced.
+TEST(TextLayoutCache, InvalidCharactersReplaced)
+{
+    TextLayoutCache cache(create_font());
+    ASSERT_EQ(std::wstring(L"a?b"), cache.layout(L"azb").text);
+}
+
+/// Tests that the same text is only laid out once.
+TEST(TextLayoutCache, RepeatedTextIsCached)
+{
+    TextLayoutCache cache(create_font());
+    cache.layout(L"ab");
+    cache.layout(L"ab");
+    cache.layout(L"ba");
+    ASSERT_EQ(1u, cache.hits());
+    ASSERT_EQ(2u, cache.misses());
+    ASSERT_EQ(2u, cache.size());
+}
+
+/// Tests that the least recently used layout is removed when the cache is full.
+TEST(TextLayoutCache, LeastRecentlyUsedIsEvicted)
+{
+    TextLayoutCache cache(create_font(), 2);
+    cache.layout(L"a");
+    cache.layout(L"b");
+    cache.layout(L"a");
+    cache.layout(L"ab");
+    ASSERT_EQ(2u, cache.size());
+
+    cache.layout(L"a");
+    ASSERT_EQ(2u, cache.hits());
+    cache.layout(L"b");
+    ASSERT_EQ(4u, cache.misses());
+}
+
+/// Tests that measuring with an added character gives the same size as measuring the combined text.
+TEST(TextLayoutCache, MeasureAppendMatchesLayout)
+{
+    TextLayoutCache cache(create_font());
+    for (const auto character : { L'a', L' ', L'\n', L'z' })
+    {
+        const auto appended = cache.measure_append(L"ab", character);
+        const auto expected = cache.layout(std::wstring(L"ab") + character).size();
+        ASSERT_EQ(expected.width, appended.width);
+        ASSERT_EQ(expected.height, appended.height);
+    }
+}
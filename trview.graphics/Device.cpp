@@ -1,5 +1,6 @@
 #include "Device.h"
 #include "RenderTarget.h"
+#include "RenderTargetPool.h"
 #include "DeviceWindow.h"
 
 using namespace Microsoft::WRL;
@@ -43,6 +44,8 @@ namespace trview
             depthStencilDesc.BackFace.StencilFunc = D3D11_COMPARISON_ALWAYS;
 
             _device->CreateDepthStencilState(&depthStencilDesc, &_depth_stencil_state);
+
+            _render_target_pool = std::make_unique<RenderTargetPool>(*this);
         }
 
         Device::~Device()
@@ -69,5 +72,10 @@ namespace trview
         {
             return std::make_unique<DeviceWindow>(*this, window);
         }
+
+        RenderTargetPool& Device::render_target_pool() const
+        {
+            return *_render_target_pool;
+        }
     }
 }
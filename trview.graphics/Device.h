@@ -17,6 +17,7 @@ namespace trview
     namespace graphics
     {
         class RenderTarget;
+        class RenderTargetPool;
         class DeviceWindow;
 
         /// Wraps the D3D device and manages common D3D operations.
@@ -44,11 +45,16 @@ namespace trview
             /// @param window The window to render to.
             /// @returns The device window object.
             std::unique_ptr<DeviceWindow> create_for_window(const Window& window);
+
+            /// Gets the pool that render targets that change size should be taken from.
+            /// @returns The render target pool.
+            RenderTargetPool& render_target_pool() const;
         private:
             Microsoft::WRL::ComPtr<ID3D11Device>        _device;
             Microsoft::WRL::ComPtr<ID3D11DeviceContext> _context;
             Microsoft::WRL::ComPtr<ID3D11BlendState>    _blend_state;
             Microsoft::WRL::ComPtr<ID3D11DepthStencilState> _depth_stencil_state;
+            std::unique_ptr<RenderTargetPool> _render_target_pool;
         };
     }
 }
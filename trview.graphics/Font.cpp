@@ -2,8 +2,7 @@
 #include "Texture.h"
 #include <trview.common/Size.h>
 #include <trview.common/Colour.h>
-#include <algorithm>
-#include <iterator>
+#include <trview.common/Profiler.h>
 
 using namespace Microsoft::WRL;
 using namespace DirectX;
@@ -12,27 +11,10 @@ namespace trview
 {
     namespace graphics
     {
-        namespace
-        {
-            /// Convert any characters that aren't in the sprite sheet to a safe character.
-            /// @param text The text to convert.
-            /// @result The santised string.
-            std::wstring sanitise(const SpriteFont& font, const std::wstring& text)
-            {
-                std::wstring converted;
-                std::transform(text.begin(), text.end(), std::back_inserter(converted),
-                    [&](auto character)
-                {
-                    return font.ContainsCharacter(character) ? character : L'?';
-                });
-                return converted;
-            }
-        }
-
-
-        Font::Font(const std::shared_ptr<SpriteFont>& font, TextAlignment text_alignment, ParagraphAlignment paragraph_alignment)
-            : _font(font), _text_alignment(text_alignment), _paragraph_alignment(paragraph_alignment)
+        Font::Font(const std::shared_ptr<SpriteFont>& font, const std::shared_ptr<TextLayoutCache>& layouts, TextAlignment text_alignment, ParagraphAlignment paragraph_alignment)
+            : _font(font), _layouts(layouts ? layouts : std::make_shared<TextLayoutCache>(font)), _text_alignment(text_alignment), _paragraph_alignment(paragraph_alignment)
         {
+            _font->GetSpriteSheet(&_sprite_sheet);
         }
 
         void Font::render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::wstring& text, float width, float height, const Colour& colour)
@@ -42,17 +24,15 @@ namespace trview
 
         void Font::render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::wstring& text, float x, float y, float width, float height, const Colour& colour)
         {
-            if (!_batch)
+            const bool in_batch = _in_batch;
+            if (!in_batch)
             {
-                _batch = std::make_unique<SpriteBatch>(context.Get());
+                begin(context);
             }
 
-            // Make sure the sprite batch uses our blend state instead of setting its own.
-            ComPtr<ID3D11BlendState> blend_state;
-            context->OMGetBlendState(&blend_state, nullptr, nullptr);
-
             // Calculate the position at which to render the text based on the alignment settings.
-            const auto size = measure(text);
+            const auto& layout = _layouts->layout(text);
+            const auto size = layout.size();
 
             if (_text_alignment == TextAlignment::Centre)
             {
@@ -64,9 +44,46 @@ namespace trview
                 y += height * 0.5f - size.height * 0.5f;
             }
 
+            // Draw the glyphs that were laid out when the text was first seen instead of laying out the string again.
+            x = round(x);
+            y = round(y);
+            const auto draw_colour = XMVectorSet(colour.r, colour.g, colour.b, colour.a);
+            for (const auto& glyph : layout.glyphs)
+            {
+                _batch->Draw(_sprite_sheet.Get(), XMFLOAT2(x + glyph.x, y + glyph.y), &glyph.source, draw_colour);
+            }
+
+            if (!in_batch)
+            {
+                end();
+            }
+        }
+
+        void Font::begin(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context)
+        {
+            if (!_batch)
+            {
+                _batch = std::make_unique<DirectX::SpriteBatch>(context.Get());
+            }
+
+            // Make sure the sprite batch uses our blend state instead of setting its own.
+            ComPtr<ID3D11BlendState> blend_state;
+            context->OMGetBlendState(&blend_state, nullptr, nullptr);
+
             _batch->Begin(SpriteSortMode_Deferred, blend_state.Get());
-            _font->DrawString(_batch.get(), sanitise(*_font, text).c_str(), XMVectorSet(round(x), round(y), 0, 0), XMVectorSet(colour.r, colour.g, colour.b, colour.a), 0, XMVectorZero(), XMVectorSet(1, 1, 1, 1));
+            _in_batch = true;
+        }
+
+        void Font::end()
+        {
+            if (!_in_batch)
+            {
+                return;
+            }
+
             _batch->End();
+            _in_batch = false;
+            profile_count(ProfileCounter::DrawCalls);
         }
 
         // Determines the size in pixels that the text specified will be when rendered.
@@ -74,9 +91,12 @@ namespace trview
         // Returns: The size in pixels required.
         Size Font::measure(const std::wstring& text) const
         {
-            XMFLOAT2 size;
-            XMStoreFloat2(&size, _font->MeasureString(sanitise(*_font, text).c_str()));
-            return Size(size.x, size.y);
+            return _layouts->layout(text).size();
+        }
+
+        Size Font::measure_append(const std::wstring& text, wchar_t character) const
+        {
+            return _layouts->measure_append(text, character);
         }
 
         bool Font::is_valid_character(wchar_t character) const
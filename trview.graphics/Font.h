@@ -14,6 +14,7 @@
 
 #include "TextAlignment.h"
 #include "ParagraphAlignment.h"
+#include "TextLayoutCache.h"
 
 namespace trview
 {
@@ -30,9 +31,10 @@ namespace trview
         public:
             /// Create a new font.
             /// @param font The font face to use to render.
+            /// @param layouts The layout cache for the font face. If this is null the font creates its own.
             /// @param text_alignment Text alignment for the font.
             /// @param paragraph_alignment Paragraph alignment for the font.
-            explicit Font(const std::shared_ptr<DirectX::SpriteFont>& font, TextAlignment text_alignment, ParagraphAlignment paragraph_alignment);
+            explicit Font(const std::shared_ptr<DirectX::SpriteFont>& font, const std::shared_ptr<TextLayoutCache>& layouts, TextAlignment text_alignment, ParagraphAlignment paragraph_alignment);
 
             /// Renders the text to the specified font texture.
             /// @param text The text to render on to the font texture.
@@ -50,20 +52,38 @@ namespace trview
             /// @param colour The colour to render the text.
             void render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::wstring& text, float x, float y, float width, float height, const Colour& colour);
 
+            /// Start drawing a batch of text. Calls to render until end is called are drawn together
+            /// instead of each being drawn separately.
+            /// @param context The device context.
+            void begin(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context);
+
+            /// Draw all of the text that has been rendered since begin was called.
+            void end();
+
             /// Determines the size in pixels that the text specified will be when rendered.
             /// @param text The text to measure.
             /// @returns The size in pixels required to render the specified text.
             Size measure(const std::wstring& text) const;
 
+            /// Determines the size in pixels that the text will be when a character is added to the end of it.
+            /// This is cheaper than measuring the combined text as the existing text is usually in the cache.
+            /// @param text The existing text.
+            /// @param character The character to add.
+            /// @returns The size in pixels required to render the combined text.
+            Size measure_append(const std::wstring& text, wchar_t character) const;
+
             /// Determines whether the character is in the image set.
             /// @param character The character to test.
             /// @returns True if the character is in the image set.
             bool is_valid_character(wchar_t character) const;
         private:
             std::shared_ptr<DirectX::SpriteFont> _font;
+            std::shared_ptr<TextLayoutCache>     _layouts;
+            Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> _sprite_sheet;
             std::unique_ptr<DirectX::SpriteBatch> _batch;
             TextAlignment                        _text_alignment;
             ParagraphAlignment                   _paragraph_alignment;
+            bool                                 _in_batch{ false };
         };
     }
 }
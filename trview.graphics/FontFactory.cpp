@@ -1,5 +1,6 @@
 #include "FontFactory.h"
 #include "Font.h"
+#include "TextLayoutCache.h"
 #include <external/DirectXTK/Inc/SpriteFont.h>
 
 using namespace Microsoft::WRL;
@@ -20,6 +21,7 @@ namespace trview
         void FontFactory::store(const std::string& key, const std::shared_ptr<DirectX::SpriteFont>& font)
         {
             _cache.insert({ key, font });
+            _layouts.insert({ key, std::make_shared<TextLayoutCache>(font) });
         }
 
         std::unique_ptr<Font> FontFactory::create_font(const std::string& font_face, int size, TextAlignment text_alignment, ParagraphAlignment paragraph_alignment) const
@@ -33,7 +35,7 @@ namespace trview
             }
 
             // Create the font holder.
-            return std::make_unique<Font>(found->second, text_alignment, paragraph_alignment);
+            return std::make_unique<Font>(found->second, _layouts[key], text_alignment, paragraph_alignment);
         }
     }
 }
@@ -20,6 +20,7 @@ namespace trview
     namespace graphics
     {
         class Font;
+        class TextLayoutCache;
 
         /// Creates fonts that can be used to render text to textures.
         class FontFactory
@@ -45,6 +46,8 @@ namespace trview
             std::unique_ptr<Font> create_font(const std::string& font_face, int size, TextAlignment text_alignment = TextAlignment::Left, ParagraphAlignment paragraph_alignment = ParagraphAlignment::Near) const;
         private:
             mutable std::unordered_map<std::string, std::shared_ptr<DirectX::SpriteFont>> _cache;
+            /// Text layouts for each font, shared between all fonts created with the same key.
+            mutable std::unordered_map<std::string, std::shared_ptr<TextLayoutCache>> _layouts;
         };
     }
 }
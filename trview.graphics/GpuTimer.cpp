@@ -0,0 +1,86 @@
+#include "GpuTimer.h"
+
+namespace trview
+{
+    namespace graphics
+    {
+        GpuTimer::GpuTimer(const Device& device)
+        {
+            for (auto& queries : _queries)
+            {
+                D3D11_QUERY_DESC desc;
+                memset(&desc, 0, sizeof(desc));
+                desc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+                if (FAILED(device.device()->CreateQuery(&desc, &queries.disjoint)))
+                {
+                    _available = false;
+                    return;
+                }
+
+                desc.Query = D3D11_QUERY_TIMESTAMP;
+                if (FAILED(device.device()->CreateQuery(&desc, &queries.start)) ||
+                    FAILED(device.device()->CreateQuery(&desc, &queries.end)))
+                {
+                    _available = false;
+                    return;
+                }
+            }
+        }
+
+        void GpuTimer::begin(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, uint64_t frame)
+        {
+            if (!_available || _in_frame)
+            {
+                return;
+            }
+
+            // If the results for this set of queries never arrived they are abandoned.
+            auto& queries = _queries[_current];
+            queries.pending = false;
+            queries.frame = frame;
+
+            context->Begin(queries.disjoint.Get());
+            context->End(queries.start.Get());
+            _in_frame = true;
+        }
+
+        void GpuTimer::end(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::function<void(uint64_t, float)>& on_result)
+        {
+            if (!_available || !_in_frame)
+            {
+                return;
+            }
+
+            auto& current = _queries[_current];
+            context->End(current.end.Get());
+            context->End(current.disjoint.Get());
+            current.pending = true;
+            _current = (_current + 1) % Frames_In_Flight;
+            _in_frame = false;
+
+            for (auto& queries : _queries)
+            {
+                if (!queries.pending)
+                {
+                    continue;
+                }
+
+                D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+                UINT64 start = 0;
+                UINT64 end = 0;
+                if (context->GetData(queries.disjoint.Get(), &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+                    context->GetData(queries.start.Get(), &start, sizeof(start), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+                    context->GetData(queries.end.Get(), &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+                {
+                    continue;
+                }
+
+                queries.pending = false;
+                if (!disjoint.Disjoint && disjoint.Frequency)
+                {
+                    on_result(queries.frame, static_cast<float>(end - start) * 1000.0f / disjoint.Frequency);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/// @file GpuTimer.h
+/// @brief Measures the GPU time taken by frames using timestamp queries.
+///
+/// Timestamp results are only available some frames after they were issued, so the timer
+/// keeps several sets of queries in flight and reports results when they are ready.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <wrl/client.h>
+#include <d3d11.h>
+
+#include "Device.h"
+
+namespace trview
+{
+    namespace graphics
+    {
+        /// Measures the GPU time taken by frames using timestamp queries.
+        class GpuTimer final
+        {
+        public:
+            /// Create a new GPU timer. If the device can't create timestamp queries the timer will
+            /// never report any results.
+            /// @param device The device to create the queries with.
+            explicit GpuTimer(const Device& device);
+
+            /// Start timing a frame. Not every frame has to be timed.
+            /// @param context The device context.
+            /// @param frame The number of the frame, which is passed back with the result.
+            void begin(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, uint64_t frame);
+
+            /// Stop timing the current frame and collect any finished results.
+            /// @param context The device context.
+            /// @param on_result Called with the number of the frame that the result is for and the time in milliseconds.
+            void end(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::function<void(uint64_t, float)>& on_result);
+        private:
+            struct Queries
+            {
+                Microsoft::WRL::ComPtr<ID3D11Query> disjoint;
+                Microsoft::WRL::ComPtr<ID3D11Query> start;
+                Microsoft::WRL::ComPtr<ID3D11Query> end;
+                bool pending{ false };
+                uint64_t frame{ 0u };
+            };
+
+            static const uint32_t Frames_In_Flight = 4;
+
+            std::array<Queries, Frames_In_Flight> _queries;
+            uint32_t _current{ 0u };
+            bool _available{ true };
+            bool _in_frame{ false };
+        };
+    }
+}
@@ -1,5 +1,8 @@
+#define NOMINMAX
 #include "RenderTarget.h"
 #include "DepthStencil.h"
+#include <trview.common/Profiler.h>
+#include <algorithm>
 
 using namespace Microsoft::WRL;
 using namespace DirectX::SimpleMath;
@@ -27,7 +30,7 @@ namespace trview
         // height: The height of the new render target.
         // depth_mode: Whether a depth stencil should be created.
         RenderTarget::RenderTarget(const graphics::Device& device, uint32_t width, uint32_t height, DepthStencilMode depth_mode)
-            : _width(width), _height(height), 
+            : _width(width), _height(height), _texture_width(width), _texture_height(height),
             _texture(device, width, height, Texture::Bind::RenderTarget)
         {
             if (depth_mode == DepthStencilMode::Enabled)
@@ -48,8 +51,8 @@ namespace trview
             // Initialise properties from the existing texture.
             D3D11_TEXTURE2D_DESC desc;
             texture->GetDesc(&desc);
-            _width = desc.Width;
-            _height = desc.Height;
+            _width = _texture_width = desc.Width;
+            _height = _texture_height = desc.Height;
 
             if (depth_mode == DepthStencilMode::Enabled)
             {
@@ -89,6 +92,7 @@ namespace trview
             viewport.TopLeftY = 0;
             context->RSSetViewports(1, &viewport);
             context->OMSetRenderTargets(1, _view.GetAddressOf(), get_depth_stencil(_depth_stencil));
+            profile_count(ProfileCounter::RenderTargetSwitches);
         }
 
         // Get the texture for the render target.
@@ -123,5 +127,31 @@ namespace trview
         {
             return Size(static_cast<float>(_width), static_cast<float>(_height));
         }
+
+        void RenderTarget::set_active_area(uint32_t width, uint32_t height)
+        {
+            _width = std::min(width, _texture_width);
+            _height = std::min(height, _texture_height);
+        }
+
+        Vector2 RenderTarget::active_uv() const
+        {
+            return Vector2(static_cast<float>(_width) / _texture_width, static_cast<float>(_height) / _texture_height);
+        }
+
+        uint32_t RenderTarget::texture_width() const
+        {
+            return _texture_width;
+        }
+
+        uint32_t RenderTarget::texture_height() const
+        {
+            return _texture_height;
+        }
+
+        RenderTarget::DepthStencilMode RenderTarget::depth_stencil_mode() const
+        {
+            return _depth_stencil ? DepthStencilMode::Enabled : DepthStencilMode::Disabled;
+        }
     }
 }
\ No newline at end of file
@@ -72,12 +72,37 @@ namespace trview
             // Get the size of the render target in pixels.
             // Returns: The size of the render target.
             Size size() const;
+
+            // Set the area of the texture that is used, starting at the top left. apply uses this area as the
+            // viewport and width, height and size return it. By default the whole texture is used.
+            // width: The width of the area. This must not be larger than the texture width.
+            // height: The height of the area. This must not be larger than the texture height.
+            void set_active_area(uint32_t width, uint32_t height);
+
+            // Get the texture coordinates of the bottom right corner of the active area, for drawing only the
+            // part of the texture that is used.
+            // Returns: The texture coordinates.
+            DirectX::SimpleMath::Vector2 active_uv() const;
+
+            // Get the width of the texture in pixels.
+            // Returns: The texture width.
+            uint32_t texture_width() const;
+
+            // Get the height of the texture in pixels.
+            // Returns: The texture height.
+            uint32_t texture_height() const;
+
+            // Get whether the render target has a depth stencil.
+            // Returns: The depth stencil mode.
+            DepthStencilMode depth_stencil_mode() const;
         private:
             Texture _texture;
             Microsoft::WRL::ComPtr<ID3D11RenderTargetView>   _view;
             std::unique_ptr<DepthStencil> _depth_stencil;
             uint32_t _width;
             uint32_t _height;
+            uint32_t _texture_width;
+            uint32_t _texture_height;
         };
     }
 }
@@ -0,0 +1,128 @@
+#define NOMINMAX
+#include "RenderTargetPool.h"
+#include "Device.h"
+#include <trview.common/Profiler.h>
+#include <algorithm>
+
+namespace trview
+{
+    namespace graphics
+    {
+        namespace
+        {
+            const uint32_t Min_Granularity = 32;
+            // Colour textures are R8G8B8A8 and depth stencils are D24S8.
+            const uint64_t Bytes_Per_Pixel = 4;
+
+            bool matches(const RenderTarget& target, uint32_t width, uint32_t height, RenderTarget::DepthStencilMode depth_mode)
+            {
+                return target.texture_width() == RenderTargetPool::bucket(width) &&
+                    target.texture_height() == RenderTargetPool::bucket(height) &&
+                    target.depth_stencil_mode() == depth_mode;
+            }
+        }
+
+        RenderTargetPool::RenderTargetPool(const Device& device, uint64_t max_bytes)
+            : _device(device), _max_bytes(max_bytes)
+        {
+        }
+
+        std::unique_ptr<RenderTarget> RenderTargetPool::acquire(uint32_t width, uint32_t height, RenderTarget::DepthStencilMode depth_mode)
+        {
+            width = std::max(width, 1u);
+            height = std::max(height, 1u);
+
+            for (auto iter = _available.begin(); iter != _available.end(); ++iter)
+            {
+                if (matches(**iter, width, height, depth_mode))
+                {
+                    auto target = std::move(*iter);
+                    _available.erase(iter);
+                    _available_bytes -= size_in_bytes(*target);
+                    target->set_active_area(width, height);
+                    ++_statistics.reused;
+                    return target;
+                }
+            }
+
+            auto target = std::make_unique<RenderTarget>(_device, bucket(width), bucket(height), depth_mode);
+            target->set_active_area(width, height);
+            ++_statistics.created;
+            profile_count(ProfileCounter::RenderTargetCreations);
+            return target;
+        }
+
+        void RenderTargetPool::resize(std::unique_ptr<RenderTarget>& target, uint32_t width, uint32_t height, RenderTarget::DepthStencilMode depth_mode)
+        {
+            width = std::max(width, 1u);
+            height = std::max(height, 1u);
+
+            if (target && matches(*target, width, height, depth_mode))
+            {
+                target->set_active_area(width, height);
+                ++_statistics.resized;
+                return;
+            }
+
+            release(std::move(target));
+            target = acquire(width, height, depth_mode);
+        }
+
+        void RenderTargetPool::release(std::unique_ptr<RenderTarget>&& target)
+        {
+            if (!target)
+            {
+                return;
+            }
+
+            _available_bytes += size_in_bytes(*target);
+            _available.push_front(std::move(target));
+            ++_statistics.released;
+
+            while (_available_bytes > _max_bytes)
+            {
+                _available_bytes -= size_in_bytes(*_available.back());
+                _available.pop_back();
+                ++_statistics.evicted;
+            }
+        }
+
+        void RenderTargetPool::clear()
+        {
+            _available.clear();
+            _available_bytes = 0u;
+        }
+
+        RenderTargetPool::Statistics RenderTargetPool::statistics() const
+        {
+            auto statistics = _statistics;
+            statistics.available = static_cast<uint32_t>(_available.size());
+            statistics.available_bytes = _available_bytes;
+            return statistics;
+        }
+
+        uint32_t RenderTargetPool::bucket(uint32_t size)
+        {
+            // The largest power of two that isn't larger than the size.
+            uint32_t power = 1;
+            while (power <= size / 2)
+            {
+                power <<= 1;
+            }
+
+            const uint32_t granularity = std::max(Min_Granularity, power / 8);
+            return std::max(1u, (size + granularity - 1) / granularity) * granularity;
+        }
+
+        uint64_t RenderTargetPool::size_in_bytes(uint32_t texture_width, uint32_t texture_height, RenderTarget::DepthStencilMode depth_mode)
+        {
+            const uint64_t colour = static_cast<uint64_t>(texture_width) * texture_height * Bytes_Per_Pixel;
+            return depth_mode == RenderTarget::DepthStencilMode::Enabled ? colour * 2 : colour;
+        }
+
+        uint64_t RenderTargetPool::size_in_bytes(const RenderTarget& target)
+        {
+            return size_in_bytes(target.texture_width(), target.texture_height(), target.depth_stencil_mode());
+        }
+    }
+}
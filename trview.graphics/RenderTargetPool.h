@@ -0,0 +1,104 @@
+/// @file RenderTargetPool.h
+/// @brief Keeps render targets that are no longer needed so that they can be used again.
+///
+/// Render targets are created with their sizes rounded up to a bucket size, and only the requested
+/// area of the texture is used. A render target that changes size within its bucket is kept as it
+/// is, and one that moves to another bucket is swapped for a free one of the right size if there is
+/// one. Resizing a window or switching rooms then reuses a small set of textures instead of creating
+/// new ones every time.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+
+#include "RenderTarget.h"
+
+namespace trview
+{
+    namespace graphics
+    {
+        class Device;
+
+        /// Keeps render targets that are no longer needed so that they can be used again.
+        class RenderTargetPool final
+        {
+        public:
+            /// Counts of the work that the pool has done since it was created.
+            struct Statistics
+            {
+                /// The number of render targets that have been created.
+                uint32_t created{ 0u };
+                /// The number of times that a free render target was given out instead of creating one.
+                uint32_t reused{ 0u };
+                /// The number of times that a render target changed size without changing texture.
+                uint32_t resized{ 0u };
+                /// The number of render targets that were returned to the pool.
+                uint32_t released{ 0u };
+                /// The number of free render targets that were destroyed to keep the pool within its limit.
+                uint32_t evicted{ 0u };
+                /// The number of free render targets in the pool.
+                uint32_t available{ 0u };
+                /// The video memory in bytes used by the free render targets in the pool.
+                uint64_t available_bytes{ 0u };
+            };
+
+            /// The default amount of video memory that free render targets can use.
+            static const uint64_t Default_Max_Bytes = 128ull * 1024 * 1024;
+
+            /// Create a new render target pool.
+            /// @param device The device to create render targets with.
+            /// @param max_bytes The video memory in bytes that free render targets can use. The least recently
+            /// released render targets are destroyed when the pool goes over this.
+            explicit RenderTargetPool(const Device& device, uint64_t max_bytes = Default_Max_Bytes);
+
+            /// Get a render target. A free render target from the same bucket is used if there is one.
+            /// @param width The width that will be used.
+            /// @param height The height that will be used.
+            /// @param depth_mode Whether the render target needs a depth stencil.
+            /// @returns The render target, with its active area set to the requested size.
+            std::unique_ptr<RenderTarget> acquire(uint32_t width, uint32_t height, RenderTarget::DepthStencilMode depth_mode = RenderTarget::DepthStencilMode::Disabled);
+
+            /// Change the size of a render target. The render target is kept if the new size is in the same bucket,
+            /// otherwise it is returned to the pool and replaced. If the render target is null a new one is acquired.
+            /// The contents of the render target are undefined afterwards.
+            /// @param target The render target to resize.
+            /// @param width The width that will be used.
+            /// @param height The height that will be used.
+            /// @param depth_mode Whether the render target needs a depth stencil.
+            void resize(std::unique_ptr<RenderTarget>& target, uint32_t width, uint32_t height, RenderTarget::DepthStencilMode depth_mode = RenderTarget::DepthStencilMode::Disabled);
+
+            /// Return a render target to the pool so that it can be used again.
+            /// @param target The render target. Null render targets are ignored.
+            void release(std::unique_ptr<RenderTarget>&& target);
+
+            /// Destroy all of the free render targets.
+            void clear();
+
+            /// Get the statistics for the pool.
+            Statistics statistics() const;
+
+            /// Round a width or height up to the size of the texture that will be created for it. Sizes are
+            /// rounded to an eighth of the power of two below them, so no more than an eighth of the texture is wasted.
+            /// @param size The requested size.
+            /// @returns The texture size.
+            static uint32_t bucket(uint32_t size);
+
+            /// Get the video memory used by a render target with the specified texture size.
+            /// @param texture_width The width of the texture.
+            /// @param texture_height The height of the texture.
+            /// @param depth_mode Whether the render target has a depth stencil.
+            /// @returns The size in bytes.
+            static uint64_t size_in_bytes(uint32_t texture_width, uint32_t texture_height, RenderTarget::DepthStencilMode depth_mode);
+        private:
+            static uint64_t size_in_bytes(const RenderTarget& target);
+
+            const Device& _device;
+            uint64_t _max_bytes;
+            uint64_t _available_bytes{ 0u };
+            std::list<std::unique_ptr<RenderTarget>> _available; // Most recently released first.
+            Statistics _statistics;
+        };
+    }
+}
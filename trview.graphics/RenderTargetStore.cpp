@@ -1,4 +1,5 @@
 #include "RenderTargetStore.h"
+#include <trview.common/Profiler.h>
 
 namespace trview
 {
@@ -13,6 +14,7 @@ namespace trview
         RenderTargetStore::~RenderTargetStore()
         {
             _context->OMSetRenderTargets(1, _render_target.GetAddressOf(), _depth_stencil.Get());
+            profile_count(ProfileCounter::RenderTargetSwitches);
         }
     }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <cmath>
 
 #include <trview.common/FileLoader.h>
+#include <trview.common/Profiler.h>
 #include "IShaderStorage.h"
 #include "IShader.h"
 #include "Texture.h"
@@ -107,6 +108,7 @@ namespace trview
             context->VSSetConstantBuffers(0, 1, _matrix_buffer.GetAddressOf());
             context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
             context->DrawIndexed(4, 0, 0);
+            profile_count(ProfileCounter::DrawCalls);
         }
 
         void Sprite::create_matrix(const graphics::Device& device)
@@ -141,6 +143,7 @@ namespace trview
             MeshData data{ scaling * translation, colour, Vector4::Zero };
 
             context->Map(_matrix_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+            profile_count(ProfileCounter::BufferMaps);
             memcpy(mapped_resource.pData, &data, sizeof(data));
             context->Unmap(_matrix_buffer.Get(), 0);
         }
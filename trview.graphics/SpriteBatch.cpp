@@ -0,0 +1,171 @@
+#define NOMINMAX
+#include "SpriteBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <trview.common/Profiler.h>
+#include "IShaderStorage.h"
+#include "IShader.h"
+#include "Texture.h"
+
+using namespace Microsoft::WRL;
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace graphics
+    {
+        namespace
+        {
+            const uint32_t Initial_Capacity = 256;
+        }
+
+        SpriteBatch::SpriteBatch(const graphics::Device& device, const graphics::IShaderStorage& shader_storage)
+            : _device(device)
+        {
+            _vertex_shader = shader_storage.get("ui_batch_vertex_shader");
+            _pixel_shader = shader_storage.get("ui_pixel_shader");
+
+            D3D11_SAMPLER_DESC desc;
+            memset(&desc, 0, sizeof(desc));
+            desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+            desc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+            desc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+            desc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+            desc.MaxAnisotropy = 1;
+            desc.ComparisonFunc = D3D11_COMPARISON_ALWAYS;
+            desc.MaxLOD = D3D11_FLOAT32_MAX;
+            device.device()->CreateSamplerState(&desc, &_sampler_state);
+
+            reserve(Initial_Capacity);
+        }
+
+        void SpriteBatch::begin(const Size& target_size)
+        {
+            _target_size = target_size;
+            _vertices.clear();
+            _runs.clear();
+        }
+
+        void SpriteBatch::draw(const Texture& texture, float x, float y, float width, float height, const Color& colour)
+        {
+            draw(texture, x, y, width, height, Vector2::Zero, Vector2::One, colour);
+        }
+
+        void SpriteBatch::draw(const Texture& texture, float x, float y, float width, float height, const Vector2& uv_top_left, const Vector2& uv_bottom_right, const Color& colour)
+        {
+            // Convert from pixels on the target to clip space, rounding in the same way as Sprite.
+            const float left = std::round(x) / _target_size.width * 2.0f - 1.0f;
+            const float right = (std::round(x) + std::round(width)) / _target_size.width * 2.0f - 1.0f;
+            const float top = 1.0f - std::round(y) / _target_size.height * 2.0f;
+            const float bottom = 1.0f - (std::round(y) + std::round(height)) / _target_size.height * 2.0f;
+
+            _vertices.push_back({ Vector3(left, top, 0), uv_top_left, colour });
+            _vertices.push_back({ Vector3(right, top, 0), Vector2(uv_bottom_right.x, uv_top_left.y), colour });
+            _vertices.push_back({ Vector3(left, bottom, 0), Vector2(uv_top_left.x, uv_bottom_right.y), colour });
+            _vertices.push_back({ Vector3(right, bottom, 0), uv_bottom_right, colour });
+
+            const auto& view = texture.view();
+            if (!_runs.empty() && _runs.back().texture == view)
+            {
+                ++_runs.back().count;
+            }
+            else
+            {
+                const uint32_t start = static_cast<uint32_t>(_vertices.size() / 4 - 1);
+                _runs.push_back({ view, start, 1 });
+            }
+        }
+
+        void SpriteBatch::end(const ComPtr<ID3D11DeviceContext>& context)
+        {
+            _draw_calls = 0;
+            if (_vertices.empty())
+            {
+                return;
+            }
+
+            const uint32_t quads = static_cast<uint32_t>(_vertices.size() / 4);
+            reserve(quads);
+
+            D3D11_MAPPED_SUBRESOURCE mapped_resource;
+            memset(&mapped_resource, 0, sizeof(mapped_resource));
+            context->Map(_vertex_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
+            profile_count(ProfileCounter::BufferMaps);
+            memcpy(mapped_resource.pData, &_vertices[0], sizeof(Vertex) * _vertices.size());
+            context->Unmap(_vertex_buffer.Get(), 0);
+
+            _vertex_shader->apply(context);
+            _pixel_shader->apply(context);
+            context->PSSetSamplers(0, 1, _sampler_state.GetAddressOf());
+            UINT stride = sizeof(Vertex);
+            UINT offset = 0;
+            context->IASetVertexBuffers(0, 1, _vertex_buffer.GetAddressOf(), &stride, &offset);
+            context->IASetIndexBuffer(_index_buffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+            context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+            for (const auto& run : _runs)
+            {
+                context->PSSetShaderResources(0, 1, run.texture.GetAddressOf());
+                context->DrawIndexed(run.count * 6, run.start * 6, 0);
+                ++_draw_calls;
+            }
+            profile_count(ProfileCounter::DrawCalls, _draw_calls);
+
+            _vertices.clear();
+            _runs.clear();
+        }
+
+        uint32_t SpriteBatch::draw_calls() const
+        {
+            return _draw_calls;
+        }
+
+        void SpriteBatch::reserve(uint32_t quads)
+        {
+            if (quads <= _capacity)
+            {
+                return;
+            }
+
+            uint32_t capacity = std::max(_capacity, Initial_Capacity);
+            while (capacity < quads)
+            {
+                capacity *= 2;
+            }
+
+            D3D11_BUFFER_DESC vertex_desc;
+            memset(&vertex_desc, 0, sizeof(vertex_desc));
+            vertex_desc.Usage = D3D11_USAGE_DYNAMIC;
+            vertex_desc.ByteWidth = sizeof(Vertex) * 4 * capacity;
+            vertex_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+            vertex_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+            _vertex_buffer.Reset();
+            _device.device()->CreateBuffer(&vertex_desc, nullptr, &_vertex_buffer);
+
+            // The index buffer never changes as every quad is made of the same two triangles.
+            std::vector<uint32_t> indices;
+            indices.reserve(capacity * 6);
+            for (uint32_t i = 0; i < capacity; ++i)
+            {
+                const uint32_t base = i * 4;
+                indices.insert(indices.end(), { base, base + 1, base + 2, base + 2, base + 1, base + 3 });
+            }
+
+            D3D11_BUFFER_DESC index_desc;
+            memset(&index_desc, 0, sizeof(index_desc));
+            index_desc.Usage = D3D11_USAGE_IMMUTABLE;
+            index_desc.ByteWidth = sizeof(uint32_t) * static_cast<uint32_t>(indices.size());
+            index_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+            D3D11_SUBRESOURCE_DATA index_data;
+            memset(&index_data, 0, sizeof(index_data));
+            index_data.pSysMem = &indices[0];
+
+            _index_buffer.Reset();
+            _device.device()->CreateBuffer(&index_desc, &index_data, &_index_buffer);
+            _capacity = capacity;
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/// @file SpriteBatch.h
+/// @brief Collects textured quads and draws them with as few draw calls as possible.
+///
+/// Quads are stored with per-vertex colour and texture coordinates in a single dynamic vertex
+/// buffer. When the batch is ended, consecutive quads that use the same texture are drawn with
+/// one draw call, so the order that quads were added in is kept.
+
+#pragma once
+
+#include <wrl/client.h>
+#include <d3d11.h>
+#include <cstdint>
+#include <vector>
+#include <SimpleMath.h>
+
+#include <trview.common/Size.h>
+#include "Device.h"
+
+namespace trview
+{
+    namespace graphics
+    {
+        struct IShader;
+        struct IShaderStorage;
+        class Texture;
+
+        /// Collects textured quads and draws them with as few draw calls as possible.
+        class SpriteBatch final
+        {
+        public:
+            /// Create a new sprite batch.
+            /// @param device The device to create buffers with.
+            /// @param shader_storage The shader storage to get the batch shaders from.
+            SpriteBatch(const graphics::Device& device, const graphics::IShaderStorage& shader_storage);
+
+            SpriteBatch(const SpriteBatch&) = delete;
+            SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+            /// Start collecting quads. Any quads that were not drawn are discarded.
+            /// @param target_size The size of the render target that the quads will be drawn on.
+            void begin(const Size& target_size);
+
+            /// Add a quad that shows the whole texture.
+            /// @param texture The texture to use. This must stay alive until end is called.
+            /// @param x The x position of the quad in pixels.
+            /// @param y The y position of the quad in pixels.
+            /// @param width The width of the quad in pixels.
+            /// @param height The height of the quad in pixels.
+            /// @param colour The colour to multiply the texture by.
+            void draw(const Texture& texture, float x, float y, float width, float height, const DirectX::SimpleMath::Color& colour = { 1, 1, 1, 1 });
+
+            /// Add a quad that shows part of the texture.
+            /// @param texture The texture to use. This must stay alive until end is called.
+            /// @param x The x position of the quad in pixels.
+            /// @param y The y position of the quad in pixels.
+            /// @param width The width of the quad in pixels.
+            /// @param height The height of the quad in pixels.
+            /// @param uv_top_left The texture coordinates of the top left corner of the quad.
+            /// @param uv_bottom_right The texture coordinates of the bottom right corner of the quad.
+            /// @param colour The colour to multiply the texture by.
+            void draw(const Texture& texture, float x, float y, float width, float height,
+                const DirectX::SimpleMath::Vector2& uv_top_left, const DirectX::SimpleMath::Vector2& uv_bottom_right, const DirectX::SimpleMath::Color& colour);
+
+            /// Draw all of the quads that have been added since begin was called.
+            /// @param context The device context.
+            void end(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context);
+
+            /// Gets the number of draw calls made by the last call to end.
+            uint32_t draw_calls() const;
+        private:
+            struct Vertex
+            {
+                DirectX::SimpleMath::Vector3 position;
+                DirectX::SimpleMath::Vector2 uv;
+                DirectX::SimpleMath::Color colour;
+            };
+
+            /// A sequence of quads that use the same texture.
+            struct Run
+            {
+                Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> texture;
+                uint32_t start;
+                uint32_t count;
+            };
+
+            void reserve(uint32_t quads);
+
+            const graphics::Device&                    _device;
+            Microsoft::WRL::ComPtr<ID3D11Buffer>       _vertex_buffer;
+            Microsoft::WRL::ComPtr<ID3D11Buffer>       _index_buffer;
+            Microsoft::WRL::ComPtr<ID3D11SamplerState> _sampler_state;
+            graphics::IShader*                         _vertex_shader;
+            graphics::IShader*                         _pixel_shader;
+            std::vector<Vertex>                        _vertices;
+            std::vector<Run>                           _runs;
+            uint32_t                                   _capacity{ 0u };
+            uint32_t                                   _draw_calls{ 0u };
+            Size                                       _target_size;
+        };
+    }
+}
@@ -0,0 +1,133 @@
+#define NOMINMAX
+#include "TextLayoutCache.h"
+
+#include <algorithm>
+#include <cwctype>
+
+namespace trview
+{
+    namespace graphics
+    {
+        Size TextLayout::size() const
+        {
+            return Size(width, height);
+        }
+
+        TextLayoutCache::TextLayoutCache(const std::shared_ptr<DirectX::SpriteFont>& font, std::size_t capacity)
+            : _font(font), _line_spacing(font->GetLineSpacing()), _capacity(std::max<std::size_t>(capacity, 1u))
+        {
+        }
+
+        const TextLayout& TextLayoutCache::layout(const std::wstring& text)
+        {
+            auto found = _lookup.find(text);
+            if (found != _lookup.end())
+            {
+                ++_hits;
+                _entries.splice(_entries.begin(), _entries, found->second);
+                return found->second->second;
+            }
+
+            ++_misses;
+            TextLayout result;
+            result.text.reserve(text.size());
+            result.glyphs.reserve(text.size());
+            for (const auto character : text)
+            {
+                append(result, character, true);
+            }
+
+            if (_entries.size() >= _capacity)
+            {
+                _lookup.erase(_entries.back().first);
+                _entries.pop_back();
+            }
+
+            _entries.emplace_front(text, std::move(result));
+            _lookup.insert({ text, _entries.begin() });
+            return _entries.front().second;
+        }
+
+        Size TextLayoutCache::measure_append(const std::wstring& text, wchar_t character)
+        {
+            // Copy only the parts of the layout that are needed for measuring.
+            const auto& existing = layout(text);
+            TextLayout extended;
+            extended.x = existing.x;
+            extended.y = existing.y;
+            extended.width = existing.width;
+            extended.height = existing.height;
+            append(extended, character, false);
+            return extended.size();
+        }
+
+        void TextLayoutCache::clear()
+        {
+            _entries.clear();
+            _lookup.clear();
+        }
+
+        std::size_t TextLayoutCache::size() const
+        {
+            return _entries.size();
+        }
+
+        uint64_t TextLayoutCache::hits() const
+        {
+            return _hits;
+        }
+
+        uint64_t TextLayoutCache::misses() const
+        {
+            return _misses;
+        }
+
+        // Follows the same rules as SpriteFont::DrawString and SpriteFont::MeasureString so that
+        // the results match what DirectXTK would produce for the whole string.
+        void TextLayoutCache::append(TextLayout& layout, wchar_t character, bool store_glyph) const
+        {
+            // Line breaks are handled before checking the font, as fonts don't have glyphs for them.
+            if (character == L'\r' || character == L'\n')
+            {
+                if (store_glyph)
+                {
+                    layout.text += character;
+                }
+
+                if (character == L'\n')
+                {
+                    layout.x = 0;
+                    layout.y += _line_spacing;
+                }
+                return;
+            }
+
+            if (!_font->ContainsCharacter(character))
+            {
+                character = L'?';
+            }
+
+            if (store_glyph)
+            {
+                layout.text += character;
+            }
+
+            const auto glyph = _font->FindGlyph(character);
+            const float x = std::max(layout.x + glyph->XOffset, 0.0f);
+            const float glyph_width = static_cast<float>(glyph->Subrect.right - glyph->Subrect.left);
+            const float glyph_height = static_cast<float>(glyph->Subrect.bottom - glyph->Subrect.top);
+            const bool whitespace = std::iswspace(character) != 0;
+
+            if (store_glyph && (!whitespace || glyph_width > 1 || glyph_height > 1))
+            {
+                layout.glyphs.push_back({ glyph->Subrect, x, layout.y + glyph->YOffset });
+            }
+
+            const float height = std::max(glyph_height + (whitespace ? 0 : glyph->YOffset), _line_spacing);
+            const float right = x + glyph_width + (whitespace ? glyph->XAdvance : 0);
+            layout.width = std::max(layout.width, right);
+            layout.height = std::max(layout.height, layout.y + height);
+            layout.x = x + glyph_width + glyph->XAdvance;
+        }
+    }
+}
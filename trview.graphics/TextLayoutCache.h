@@ -0,0 +1,100 @@
+/// @file TextLayoutCache.h
+/// @brief Stores the sanitised text, size and glyph positions of recently used strings for a font.
+///
+/// Laying out text means looking up every character in the sprite font. The same strings are
+/// measured and drawn every time a window is redrawn, so the results are kept in a bounded
+/// least recently used cache shared by every Font that uses the same sprite font.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <external/DirectXTK/Inc/SpriteFont.h>
+#include <trview.common/Size.h>
+
+namespace trview
+{
+    namespace graphics
+    {
+        /// The result of laying out a string with a sprite font.
+        struct TextLayout
+        {
+            /// A glyph to draw from the sprite sheet.
+            struct Glyph
+            {
+                RECT  source;
+                float x;
+                float y;
+            };
+
+            /// The text with any characters that are not in the font replaced.
+            std::wstring text;
+            /// The glyphs to draw, relative to the top left of the text.
+            std::vector<Glyph> glyphs;
+            /// The position that the next character would be placed at.
+            float x{ 0 };
+            float y{ 0 };
+            /// The size of the text in pixels.
+            float width{ 0 };
+            float height{ 0 };
+
+            /// Gets the size of the text.
+            Size size() const;
+        };
+
+        /// Lays out text using a sprite font and keeps the most recently used layouts.
+        class TextLayoutCache final
+        {
+        public:
+            /// Create a new cache.
+            /// @param font The sprite font to lay out text with.
+            /// @param capacity The maximum number of layouts to keep.
+            explicit TextLayoutCache(const std::shared_ptr<DirectX::SpriteFont>& font, std::size_t capacity = 512);
+
+            TextLayoutCache(const TextLayoutCache&) = delete;
+            TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+
+            /// Get the layout of the text, laying it out if it is not in the cache.
+            /// @param text The text to lay out.
+            /// @returns The layout. This is valid until the next call to layout.
+            const TextLayout& layout(const std::wstring& text);
+
+            /// Get the size of the text with a character added to the end of it. Only the new
+            /// character is laid out - the rest of the text comes from the cache.
+            /// @param text The existing text.
+            /// @param character The character to add.
+            /// @returns The size of the combined text.
+            Size measure_append(const std::wstring& text, wchar_t character);
+
+            /// Remove all layouts from the cache.
+            void clear();
+
+            /// Gets the number of layouts in the cache.
+            std::size_t size() const;
+
+            /// Gets the number of calls to layout that were found in the cache.
+            uint64_t hits() const;
+
+            /// Gets the number of calls to layout that had to lay out the text.
+            uint64_t misses() const;
+        private:
+            using Entry = std::pair<std::wstring, TextLayout>;
+
+            /// Add a character to the end of the layout.
+            void append(TextLayout& layout, wchar_t character, bool store_glyph) const;
+
+            std::shared_ptr<DirectX::SpriteFont> _font;
+            float _line_spacing;
+            std::size_t _capacity;
+            std::list<Entry> _entries;
+            std::unordered_map<std::wstring, std::list<Entry>::iterator> _lookup;
+            uint64_t _hits{ 0u };
+            uint64_t _misses{ 0u };
+        };
+    }
+}
@@ -74,6 +74,25 @@ namespace trview
             }
         }
 
+        Texture::Texture(const graphics::Device& device, uint32_t width, uint32_t height, DXGI_FORMAT format, const std::vector<D3D11_SUBRESOURCE_DATA>& levels)
+        {
+            D3D11_TEXTURE2D_DESC desc;
+            memset(&desc, 0, sizeof(desc));
+            desc.Width = width;
+            desc.Height = height;
+            desc.MipLevels = static_cast<UINT>(levels.size());
+            desc.ArraySize = 1;
+            desc.Format = format;
+            desc.SampleDesc.Count = 1;
+            desc.Usage = D3D11_USAGE_IMMUTABLE;
+            desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+            desc.CPUAccessFlags = 0;
+            desc.MiscFlags = 0;
+
+            device.device()->CreateTexture2D(&desc, &levels[0], &_texture);
+            device.device()->CreateShaderResourceView(_texture.Get(), nullptr, &_view);
+        }
+
         bool Texture::has_content() const
         {
             return _texture;
@@ -64,6 +64,15 @@ namespace trview
             /// @see Bind
             Texture(const graphics::Device& device, uint32_t width, uint32_t height, const std::vector<uint32_t>& pixels, Bind bind = Bind::Texture);
 
+            /// Create a texture with a mip chain from data that is already in the format of the texture, such as
+            /// block compressed data. The texture can only be used as a regular texture.
+            /// @param device The D3D device to use to create this texture.
+            /// @param width The width in pixels of the largest level.
+            /// @param height The height in pixels of the largest level.
+            /// @param format The format of the data.
+            /// @param levels The data for each level of the mip chain, starting with the largest.
+            Texture(const graphics::Device& device, uint32_t width, uint32_t height, DXGI_FORMAT format, const std::vector<D3D11_SUBRESOURCE_DATA>& levels);
+
             /// Indicates whether this texture has any texture content.
             /// @returns True if the texture has content.
             bool has_content() const;
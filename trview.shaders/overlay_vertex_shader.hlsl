@@ -0,0 +1,43 @@
+cbuffer cb : register (b0)
+{
+    matrix view_projection;
+}
+
+struct VertexInput
+{
+    float4 position : POSITION;
+    float3 normal : NORMAL;
+    float2 uv : TEXCOORD0;
+    float4 colour : TEXCOORD1;
+    // Per instance.
+    float4 world0 : TEXCOORD2;
+    float4 world1 : TEXCOORD3;
+    float4 world2 : TEXCOORD4;
+    float4 world3 : TEXCOORD5;
+    float4 instance_colour : TEXCOORD6;
+    float4 light_dir : TEXCOORD7;
+};
+
+struct VertexOutput
+{
+    float4 position : SV_POSITION;
+    float2 uv : TEXCOORD0;
+    float4 colour : TEXCOORD1;
+};
+
+VertexOutput main(VertexInput input)
+{
+    VertexOutput output;
+    float4x4 world = float4x4(input.world0, input.world1, input.world2, input.world3);
+    output.position = mul(view_projection, mul(float4(input.position.xyz, 1), world));
+    output.uv = input.uv;
+    output.colour = input.colour * input.instance_colour;
+
+    if (input.light_dir.w != 0)
+    {
+        output.colour *= max(0.2f, dot(float4(input.light_dir.xyz, 1), normalize(float4(input.normal, 1))));
+        output.colour.a = 1.0f;
+    }
+
+    return output;
+}
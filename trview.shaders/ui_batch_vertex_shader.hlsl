@@ -0,0 +1,23 @@
+struct VertexInput
+{
+    float4 position : POSITION;
+    float2 uv : TEXCOORD0;
+    float4 colour : TEXCOORD1;
+};
+
+struct VertexOutput
+{
+    float4 position : SV_POSITION;
+    float2 uv : TEXCOORD0;
+    float4 colour : TEXCOORD1;
+};
+
+// Vertices for batched sprites are already in clip space.
+VertexOutput main( VertexInput input )
+{
+    VertexOutput output;
+    output.position = input.position;
+    output.uv = input.uv;
+    output.colour = input.colour;
+    return output;
+}
\ No newline at end of file
@@ -40,6 +40,12 @@ namespace trview
                 sprite.render(context, _blank, thickness, thickness, _button->size().width - 2.0f * thickness, _button->size().height - 2.0f * thickness,
                     _button->background_colour());
             }
+
+            void ButtonNode::add_content(ContentKey& key) const
+            {
+                RenderNode::add_content(key);
+                key.add(_button->background_colour()).add(_button->border_thickness());
+            }
         }
     }
 }
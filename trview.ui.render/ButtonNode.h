@@ -31,6 +31,10 @@ namespace trview
                 /// @param context The D3D context to use to render.
                 /// @param sprite The sprite to use to render.
                 virtual void render_self(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite) override;
+
+                /// Add the button colours to the content key.
+                /// @param key The key to add to.
+                virtual void add_content(ContentKey& key) const override;
             private:
                 graphics::Texture _blank;
                 Button*           _button;
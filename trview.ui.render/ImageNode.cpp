@@ -35,6 +35,12 @@ namespace trview
                     sprite.render(context, texture, 0, 0, size.width, size.height);
                 }
             }
+
+            void ImageNode::add_content(ContentKey& key) const
+            {
+                WindowNode::add_content(key);
+                key.add(_image->texture().view().Get());
+            }
         }
     }
 }
\ No newline at end of file
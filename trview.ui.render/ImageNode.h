@@ -17,6 +17,7 @@ namespace trview
                 virtual ~ImageNode();
             protected:
                 virtual void render_self(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite) override;
+                virtual void add_content(ContentKey& key) const override;
             private:
                 Image * _image;
             };
@@ -35,6 +35,11 @@ namespace trview
                 return _font->measure(text);
             }
 
+            Size LabelNode::measure_append(const std::wstring& text, wchar_t character) const
+            {
+                return _font->measure_append(text, character);
+            }
+
             bool LabelNode::is_valid_character(wchar_t character) const
             {
                 return _font->is_valid_character(character);
@@ -47,6 +52,12 @@ namespace trview
                 _font->render(context, _label->text(), size.width, size.height, _label->text_colour());
             }
 
+            void LabelNode::add_content(ContentKey& key) const
+            {
+                WindowNode::add_content(key);
+                key.add(_label->text()).add(_label->text_colour());
+            }
+
             // Generate the font texture and other textures required to render the label. This will also
             // resize the label if the label has been set to auto size mode.
             void LabelNode::generate_font_texture()
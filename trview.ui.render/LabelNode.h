@@ -23,9 +23,11 @@ namespace trview
                 LabelNode(const graphics::Device& device, Label* label, const graphics::FontFactory& font_factory);
                 virtual ~LabelNode();
                 virtual Size measure(const std::wstring& text) const override;
+                virtual Size measure_append(const std::wstring& text, wchar_t character) const override;
                 virtual bool is_valid_character(wchar_t character) const override;
             protected:
                 virtual void render_self(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite) override;
+                virtual void add_content(ContentKey& key) const override;
             private:
                 // Generate the font texture and other textures required to render the label. This will also
                 // resize the label if the label has been set to auto size mode.
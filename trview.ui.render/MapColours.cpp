@@ -0,0 +1,60 @@
+#include "MapColours.h"
+#include <trview.app/Elements/Types.h>
+#include <map>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace ui
+    {
+        namespace render
+        {
+            namespace
+            {
+                const std::map<uint16_t, Color> default_colours = {
+                    { SectorFlag::Portal, { 0.0f, 0.0f, 0.0f } },
+                    { SectorFlag::Wall, { 0.4f, 0.4f, 0.4f } },
+                    { SectorFlag::Trigger, { 1.0f, 0.3f, 0.7f } },
+                    { SectorFlag::Death, { 0.9f, 0.1f, 0.1f } },
+                    { SectorFlag::MinecartLeft, { 0.0f, 0.9f, 0.9f } },
+                    { SectorFlag::MinecartRight, { 0.0f, 0.9f, 0.9f } },
+                    { SectorFlag::MonkeySwing, { 0.9f, 0.9f, 0.4f } },
+                    { SectorFlag::ClimbableUp, { 0.0f, 0.9f, 0.0f, 0.6f } },
+                    { SectorFlag::ClimbableDown, { 0.0f, 0.9f, 0.0f, 0.6f } },
+                    { SectorFlag::ClimbableRight, { 0.0f, 0.9f, 0.0f, 0.6f } },
+                    { SectorFlag::ClimbableLeft, { 0.0f, 0.9f, 0.0f, 0.6f } },
+                };
+            }
+
+            Color sector_colour(const Sector& sector)
+            {
+                // To determine the base colour we order the floor functions by the *minimum* enabled flag (ranked by order asc)
+                if (!(sector.flags & SectorFlag::Portal) && (sector.flags & SectorFlag::Wall && sector.flags & SectorFlag::FloorSlant)) // is it no-space?
+                {
+                    return { 0.2f, 0.2f, 0.9f };
+                }
+
+                int minimum_flag_enabled = -1;
+                Color draw_color = Color(0.0f, 0.7f, 0.7f); // fallback 
+                for (const auto& color : default_colours)
+                {
+                    if ((color.first & sector.flags)
+                        && (color.first < minimum_flag_enabled || minimum_flag_enabled == -1)
+                        && (color.first < SectorFlag::ClimbableUp || color.first > SectorFlag::ClimbableLeft)) // climbable flag handled separately
+                    {
+                        minimum_flag_enabled = color.first;
+                        draw_color = color.second;
+                    }
+                }
+                return draw_color;
+            }
+
+            Color flag_colour(uint16_t flag)
+            {
+                const auto found = default_colours.find(flag);
+                return found == default_colours.end() ? Color(0.0f, 0.0f, 0.0f) : found->second;
+            }
+        }
+    }
+}
@@ -0,0 +1,27 @@
+/// @file MapColours.h
+/// @brief The colours used to draw sectors on the maps.
+
+#pragma once
+
+#include <cstdint>
+#include <SimpleMath.h>
+#include <trview.app/Elements/Sector.h>
+
+namespace trview
+{
+    namespace ui
+    {
+        namespace render
+        {
+            /// Get the base colour for a sector, based on the most important flag that it has.
+            /// @param sector The sector.
+            /// @returns The colour to draw the sector.
+            DirectX::SimpleMath::Color sector_colour(const Sector& sector);
+
+            /// Get the colour used for a single sector flag.
+            /// @param flag The flag.
+            /// @returns The colour for the flag.
+            DirectX::SimpleMath::Color flag_colour(uint16_t flag);
+        }
+    }
+}
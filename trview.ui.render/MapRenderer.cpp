@@ -1,8 +1,10 @@
 #include "MapRenderer.h"
+#include "MapColours.h"
+#include <trview.graphics/RenderTargetPool.h>
 #include <trview.graphics/RenderTargetStore.h>
 #include <trview.graphics/ViewportStore.h>
-#include <trview.graphics/SpriteSizeStore.h>
 #include <trview.common/Colour.h>
+#include <cmath>
 
 using namespace DirectX::SimpleMath;
 using namespace Microsoft::WRL;
@@ -11,30 +13,13 @@ namespace trview
 {
     namespace ui
     {
-        namespace
-        {
-            std::map<uint16_t, DirectX::SimpleMath::Color> default_colours = {
-                { SectorFlag::Portal, { 0.0f, 0.0f, 0.0f } },
-                { SectorFlag::Wall, { 0.4f, 0.4f, 0.4f } },
-                { SectorFlag::Trigger, { 1.0f, 0.3f, 0.7f } },
-                { SectorFlag::Death, { 0.9f, 0.1f, 0.1f } },
-                { SectorFlag::MinecartLeft, { 0.0f, 0.9f, 0.9f } },
-                { SectorFlag::MinecartRight, { 0.0f, 0.9f, 0.9f } },
-                { SectorFlag::MonkeySwing, { 0.9f, 0.9f, 0.4f } },
-                { SectorFlag::ClimbableUp, { 0.0f, 0.9f, 0.0f, 0.6f } },
-                { SectorFlag::ClimbableDown, { 0.0f, 0.9f, 0.0f, 0.6f } },
-                { SectorFlag::ClimbableRight, { 0.0f, 0.9f, 0.0f, 0.6f } },
-                { SectorFlag::ClimbableLeft, { 0.0f, 0.9f, 0.0f, 0.6f } },
-            };
-        }
-
         namespace render
         {
             MapRenderer::MapRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const graphics::FontFactory& font_factory, const Size& window_size)
                 : _device(device),
                 _window_width(static_cast<int>(window_size.width)),
                 _window_height(static_cast<int>(window_size.height)),
-                _sprite(device, shader_storage, window_size),
+                _batch(device, shader_storage),
                 _font(font_factory.create_font("Arial", 7, graphics::TextAlignment::Centre, graphics::ParagraphAlignment::Centre)),
                 _texture(create_texture(device, Colour::White))
             {
@@ -43,6 +28,11 @@ namespace trview
                 device.device()->CreateDepthStencilState(&ui_depth_stencil_desc, &_depth_stencil_state);
             }
 
+            MapRenderer::~MapRenderer()
+            {
+                _device.render_target_pool().release(std::move(_render_target));
+            }
+
             void
             MapRenderer::render(const ComPtr<ID3D11DeviceContext>& context)
             {
@@ -53,15 +43,14 @@ namespace trview
 
                 context->OMSetDepthStencilState(_depth_stencil_state.Get(), 1);
 
-                if (needs_redraw())
+                // The map texture only has to be redrawn when the room changes.
+                if (_force_redraw)
                 {
                     // Clear the render target to be transparent (as it may not be using the entire area).
                     _render_target->clear(context, Color(1, 1, 1, 1));
 
                     graphics::RenderTargetStore rs_store(context);
                     graphics::ViewportStore vp_store(context);
-                    // Set the host size to match the render target as we will have adjusted the viewport.
-                    graphics::SpriteSizeStore s_store(_sprite, _render_target->size());
  
                     _render_target->apply(context);
                     render_internal(context);
@@ -70,92 +59,177 @@ namespace trview
 
                 // Now render the render target in the correct position.
                 auto p = Point(_first.x - 1, _first.y - 1);
-                _sprite.render(context, _render_target->texture(), p.x, p.y, static_cast<float>(_render_target->width()), static_cast<float>(_render_target->height()));
+                _batch.begin(Size(static_cast<float>(_window_width), static_cast<float>(_window_height)));
+                _batch.draw(_render_target->texture(), p.x, p.y, static_cast<float>(_render_target->width()), static_cast<float>(_render_target->height()),
+                    Vector2::Zero, _render_target->active_uv(), Color(1, 1, 1, 1));
+                _batch.end(context);
+
+                render_highlights(context);
             }
 
             void
             MapRenderer::render_internal(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context)
             {
+                // All of the squares are collected and drawn together, then the portal labels are drawn on top. Tiles
+                // don't overlap so drawing the labels afterwards looks the same as drawing them tile by tile.
+                _batch.begin(_render_target->size());
+                std::vector<const Tile*> labels;
+
                 // Draw base square, this is the backdrop for the map 
-                draw(context, Point(), Size(static_cast<float>(_render_target->width()), static_cast<float>(_render_target->height())), Color(0.0f, 0.0f, 0.0f));
+                draw(Point(), Size(static_cast<float>(_render_target->width()), static_cast<float>(_render_target->height())), Color(0.0f, 0.0f, 0.0f));
 
-                std::for_each(_tiles.begin(), _tiles.end(), [&](const Tile &tile)
+                for (const auto& tile : _tiles)
                 {
-                    // Firstly get the colour for the tile 
-                    // To determine the base colour we order the floor functions by the *minimum* enabled flag (ranked by order asc)
-                    int minimum_flag_enabled = -1;
-                    Color draw_color = Color(0.0f, 0.7f, 0.7f); // fallback 
-                    Color text_color = Colour::White;
-
-                    if (!(tile.sector->flags & SectorFlag::Portal) && (tile.sector->flags & SectorFlag::Wall && tile.sector->flags & SectorFlag::FloorSlant)) // is it no-space?
+                    draw_tile(tile, Point(), false);
+                    if (tile.sector->flags & SectorFlag::Portal)
                     {
-                        draw_color = { 0.2f, 0.2f, 0.9f };
+                        labels.push_back(&tile);
                     }
-                    else
+                }
+
+                _batch.end(context);
+                draw_labels(context, labels, Point(), false);
+            }
+
+            void
+            MapRenderer::render_highlights(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context)
+            {
+                std::vector<const Tile*> tiles;
+                if (const auto hovered = tile_at(_cursor))
+                {
+                    tiles.push_back(hovered);
+                }
+
+                if (_selected_sector.has_value())
+                {
+                    const auto selected = tile_at(_selected_sector.value().first, _selected_sector.value().second);
+                    if (selected && std::find(tiles.begin(), tiles.end(), selected) == tiles.end())
                     {
-                        for (const auto& color : default_colours)
-                        {
-                            if ((color.first & tile.sector->flags)
-                                && (color.first < minimum_flag_enabled || minimum_flag_enabled == -1)
-                                && (color.first < SectorFlag::ClimbableUp || color.first > SectorFlag::ClimbableLeft)) // climbable flag handled separately
-                            {
-                                minimum_flag_enabled = color.first;
-                                draw_color = color.second;
-                            }
-                        }
+                        tiles.push_back(selected);
                     }
+                }
+
+                if (tiles.empty())
+                {
+                    return;
+                }
 
-                    // If the cursor is over the tile, then negate colour 
-                    Point first = tile.position, last = Point(tile.size.width, tile.size.height) + tile.position;
-                    if (_cursor.is_between(first, last) ||
-                        (_selected_sector.has_value() &&
-                         _selected_sector.value().first == tile.sector->x() &&
-                         _selected_sector.value().second == tile.sector->z()))
+                // Highlighted tiles are drawn over the top of the map texture in screen space.
+                const Point offset(_first.x - 1, _first.y - 1);
+                _batch.begin(Size(static_cast<float>(_window_width), static_cast<float>(_window_height)));
+                std::vector<const Tile*> labels;
+                for (const auto& tile : tiles)
+                {
+                    draw_tile(*tile, offset, true);
+                    if (tile->sector->flags & SectorFlag::Portal)
                     {
-                        draw_color.Negate();
-                        text_color.Negate();
+                        labels.push_back(tile);
                     }
+                }
+                _batch.end(context);
+                draw_labels(context, labels, offset, true);
+            }
 
-                    // Draw the base tile 
-                    draw(context, tile.position, tile.size, draw_color);
+            void
+            MapRenderer::draw_tile(const Tile& tile, const Point& offset, bool highlighted)
+            {
+                const auto position = tile.position + offset;
 
-                    // Draw climbable walls. This draws 4 separate lines - one per climbable edge. 
-                    // In the future I'd like to just draw a hollow square instead.
-                    const float thickness = _DRAW_SCALE / 4;
+                // If the cursor is over the tile, then negate colour 
+                Color draw_color = tile.colour;
+                if (highlighted)
+                {
+                    draw_color.Negate();
+                }
 
-                    if (tile.sector->flags & SectorFlag::ClimbableUp)
-                        draw(context, tile.position, Size(tile.size.width, thickness), default_colours[SectorFlag::ClimbableUp]);
-                    if (tile.sector->flags & SectorFlag::ClimbableRight)
-                        draw(context, Point(tile.position.x + _DRAW_SCALE - thickness, tile.position.y), Size(thickness, tile.size.height), default_colours[SectorFlag::ClimbableRight]);
-                    if (tile.sector->flags & SectorFlag::ClimbableDown)
-                        draw(context, Point(tile.position.x, tile.position.y + _DRAW_SCALE - thickness), Size(tile.size.width, thickness), default_colours[SectorFlag::ClimbableDown]);
-                    if (tile.sector->flags & SectorFlag::ClimbableLeft)
-                        draw(context, tile.position, Size(thickness, tile.size.height), default_colours[SectorFlag::ClimbableLeft]);
+                // Draw the base tile 
+                draw(position, tile.size, draw_color);
 
-                    // If sector is a down portal, draw a transparent black square over it 
-                    if (tile.sector->flags & SectorFlag::RoomBelow)
-                        draw(context, tile.position, tile.size, Color(0.0f, 0.0f, 0.0f, 0.6f));
+                // Draw climbable walls. This draws 4 separate lines - one per climbable edge. 
+                // In the future I'd like to just draw a hollow square instead.
+                const float thickness = _DRAW_SCALE / 4;
 
-                    // If sector is an up portal, draw a small corner square in the top left to signify this 
-                    if (tile.sector->flags & SectorFlag::RoomAbove)
-                        draw(context, tile.position, Size(tile.size.width / 4, tile.size.height / 4), Color(0.0f, 0.0f, 0.0f));
+                if (tile.sector->flags & SectorFlag::ClimbableUp)
+                    draw(position, Size(tile.size.width, thickness), flag_colour(SectorFlag::ClimbableUp));
+                if (tile.sector->flags & SectorFlag::ClimbableRight)
+                    draw(Point(position.x + _DRAW_SCALE - thickness, position.y), Size(thickness, tile.size.height), flag_colour(SectorFlag::ClimbableRight));
+                if (tile.sector->flags & SectorFlag::ClimbableDown)
+                    draw(Point(position.x, position.y + _DRAW_SCALE - thickness), Size(tile.size.width, thickness), flag_colour(SectorFlag::ClimbableDown));
+                if (tile.sector->flags & SectorFlag::ClimbableLeft)
+                    draw(position, Size(thickness, tile.size.height), flag_colour(SectorFlag::ClimbableLeft));
 
-                    if (tile.sector->flags & SectorFlag::Death && tile.sector->flags & SectorFlag::Trigger)
-                    {
-                        draw(context, tile.position + Point(tile.size.width * 0.75f, 0), tile.size / 4.0f, default_colours[SectorFlag::Death]);
-                    }
+                // If sector is a down portal, draw a transparent black square over it 
+                if (tile.sector->flags & SectorFlag::RoomBelow)
+                    draw(position, tile.size, Color(0.0f, 0.0f, 0.0f, 0.6f));
 
-                    if (tile.sector->flags & SectorFlag::Portal)
-                    {
-                        _font->render(context, std::to_wstring(tile.sector->portal()), tile.position.x - 1, tile.position.y, tile.size.width, tile.size.height, text_color);
-                    }
-                });
+                // If sector is an up portal, draw a small corner square in the top left to signify this 
+                if (tile.sector->flags & SectorFlag::RoomAbove)
+                    draw(position, Size(tile.size.width / 4, tile.size.height / 4), Color(0.0f, 0.0f, 0.0f));
+
+                if (tile.sector->flags & SectorFlag::Death && tile.sector->flags & SectorFlag::Trigger)
+                {
+                    draw(position + Point(tile.size.width * 0.75f, 0), tile.size / 4.0f, flag_colour(SectorFlag::Death));
+                }
+            }
+
+            void
+            MapRenderer::draw_labels(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::vector<const Tile*>& tiles, const Point& offset, bool highlighted)
+            {
+                if (tiles.empty())
+                {
+                    return;
+                }
+
+                Color text_color = Colour::White;
+                if (highlighted)
+                {
+                    text_color.Negate();
+                }
+
+                _font->begin(context);
+                for (const auto& tile : tiles)
+                {
+                    const auto position = tile->position + offset;
+                    _font->render(context, std::to_wstring(tile->sector->portal()), position.x - 1, position.y, tile->size.width, tile->size.height, text_color);
+                }
+                _font->end();
             }
 
             void 
-            MapRenderer::draw(const ComPtr<ID3D11DeviceContext>& context, Point p, Size s, Color c)
+            MapRenderer::draw(Point p, Size s, Color c)
+            {
+                _batch.draw(_texture, p.x, p.y, s.width, s.height, c); 
+            }
+
+            const Tile*
+            MapRenderer::tile_at(uint16_t x, uint16_t z) const
+            {
+                if (x >= _columns || z >= _rows)
+                {
+                    return nullptr;
+                }
+
+                const auto index = _tile_index[x * _rows + z];
+                return index == -1 ? nullptr : &_tiles[index];
+            }
+
+            const Tile*
+            MapRenderer::tile_at(const Point& p) const
             {
-                _sprite.render(context, _texture, p.x, p.y, s.width, s.height, c); 
+                // Work out which column and row the point is in, then check that it isn't in the gap between tiles.
+                const float column = std::floor((p.x - 1) / _DRAW_SCALE);
+                const float row = std::floor((p.y - 1) / _DRAW_SCALE);
+                if (column < 0 || row < 0 || column >= _columns || row >= _rows)
+                {
+                    return nullptr;
+                }
+
+                const auto tile = tile_at(static_cast<uint16_t>(column), static_cast<uint16_t>(_rows - 1 - row));
+                if (!tile || !p.is_between(tile->position, tile->position + Point(tile->size.width, tile->size.height)))
+                {
+                    return nullptr;
+                }
+                return tile;
             }
 
             void
@@ -170,13 +244,18 @@ namespace trview
 
                 // Load up sectors 
                 _tiles.clear(); 
+                _tile_index.assign(static_cast<std::size_t>(_columns) * _rows, -1);
 
                 const auto& sectors = room->sectors(); 
-                std::for_each(sectors.begin(), sectors.end(), 
-                    [&] (const auto& sector) 
+                _tiles.reserve(sectors.size());
+                for (const auto& sector : sectors)
                 {
-                    _tiles.emplace_back(sector, get_position(*sector), get_size());
-                });
+                    if (sector->x() < _columns && sector->z() < _rows)
+                    {
+                        _tile_index[sector->x() * _rows + sector->z()] = static_cast<int32_t>(_tiles.size());
+                    }
+                    _tiles.emplace_back(sector, get_position(*sector), get_size(), sector_colour(*sector));
+                }
 
                 _previous_sector.reset();
                 on_sector_hover(nullptr);
@@ -198,17 +277,8 @@ namespace trview
             std::shared_ptr<Sector> 
             MapRenderer::sector_at(const Point& p) const
             {
-                auto iter = std::find_if(_tiles.begin(), _tiles.end(), [&] (const Tile& tile) {
-                    // Get bottom-right point of the tile 
-                    Point last = Point(tile.size.width, tile.size.height) + tile.position; 
-                    // Check if point is between the origin, and the bottom-right corner 
-                    return p.is_between(tile.position, last); 
-                });
-                
-                if (iter == _tiles.end())
-                    return nullptr;
-                else
-                    return std::shared_ptr<Sector>(iter->sector);
+                const auto tile = tile_at(p);
+                return tile ? tile->sector : nullptr;
             }
 
             std::shared_ptr<Sector> 
@@ -240,7 +310,6 @@ namespace trview
             {
                 _window_width = static_cast<int>(size.width);
                 _window_height = static_cast<int>(size.height);
-                _sprite.set_host_size(size);
                 update_map_position();
             }
 
@@ -259,37 +328,11 @@ namespace trview
                 uint32_t width = static_cast<uint32_t>(_DRAW_SCALE * _columns + 1);
                 uint32_t height = static_cast<uint32_t>(_DRAW_SCALE * _rows + 1);
 
-                // Minor optimisation - don't recreate the render target if the room dimensions are the same.
-                if (!_render_target || (_render_target->width() != width || _render_target->height() != height))
-                {
-                    _render_target = std::make_unique<graphics::RenderTarget>(_device, width, height);
-                }
+                // Rooms of similar sizes share a texture from the pool, so switching rooms rarely creates a new one.
+                _device.render_target_pool().resize(_render_target, width, height);
                 _force_redraw = true;
             }
 
-            bool 
-            MapRenderer::needs_redraw()
-            {
-                if (_force_redraw)
-                {
-                    return true;
-                }
-
-                if (cursor_is_over_control())
-                {
-                    _cursor_was_over = true;
-                    return true;
-                }
-
-                if (_cursor_was_over)
-                {
-                    _cursor_was_over = false;
-                    return true;
-                }
-
-                return false;
-            }
-
             void MapRenderer::set_visible(bool visible)
             {
                 _visible = visible;
@@ -297,11 +340,7 @@ namespace trview
 
             void MapRenderer::clear_highlight()
             {
-                if (_selected_sector.has_value())
-                {
-                    _selected_sector.reset();
-                    _force_redraw = true;
-                }
+                _selected_sector.reset();
             }
 
             void MapRenderer::set_highlight(uint16_t x, uint16_t z)
@@ -313,7 +352,6 @@ namespace trview
                 }
 
                 _selected_sector = { x, z };
-                _force_redraw = true;
             }
         }
     }
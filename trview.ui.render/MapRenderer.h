@@ -9,7 +9,7 @@
 #include <algorithm>
 #include <map>
 
-#include <trview.graphics/Sprite.h>
+#include <trview.graphics/SpriteBatch.h>
 #include <trview.app/Elements/Types.h>
 #include <trview.graphics/Texture.h>
 #include <trview.common/Point.h>
@@ -36,12 +36,13 @@ namespace trview
                 struct Tile
                 {
                 public:
-                    Tile(const std::shared_ptr<Sector>& p_sector, Point p_position, Size p_size)
-                        : sector(p_sector), position(p_position), size(p_size) {}
+                    Tile(const std::shared_ptr<Sector>& p_sector, Point p_position, Size p_size, const DirectX::SimpleMath::Color& p_colour)
+                        : sector(p_sector), position(p_position), size(p_size), colour(p_colour) {}
 
                     std::shared_ptr<Sector> sector; 
                     Point position; 
                     Size size; 
+                    DirectX::SimpleMath::Color colour;
                 };
             }
 
@@ -50,6 +51,8 @@ namespace trview
             public:
                 MapRenderer(const graphics::Device& device, const graphics::IShaderStorage& shader_storage, const graphics::FontFactory& font_factory, const Size& window_size);
 
+                ~MapRenderer();
+
                 // Renders the map 
                 void render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context);
 
@@ -93,8 +96,24 @@ namespace trview
                 // Determines the size of a sector 
                 Size get_size() const;
 
-                // Draws a square at given position, size with given colour.
-                void draw(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, Point p, Size s, DirectX::SimpleMath::Color c);
+                // Adds a square at given position, size with given colour to the sprite batch.
+                void draw(Point p, Size s, DirectX::SimpleMath::Color c);
+
+                // Adds the squares for a tile to the sprite batch, offset by the given amount.
+                void draw_tile(const Tile& tile, const Point& offset, bool highlighted);
+
+                // Draw the portal labels for the tiles, offset by the given amount.
+                void draw_labels(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, const std::vector<const Tile*>& tiles, const Point& offset, bool highlighted);
+
+                // Render the tiles that are under the cursor or selected directly on to the current render target,
+                // on top of the map texture.
+                void render_highlights(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context);
+
+                // Gets the tile at the given column and row, or nullptr if there is no tile.
+                const Tile* tile_at(uint16_t x, uint16_t z) const;
+
+                // Gets the tile under the position, or nullptr if there is no tile.
+                const Tile* tile_at(const Point& p) const;
 
                 // Update the stored positions of the corners of the map.
                 void update_map_position();
@@ -103,26 +122,23 @@ namespace trview
                 // on the size of the room (based on columns and rows).
                 void update_map_render_target();
 
-                // Render the map squares and the background.
+                // Render the map squares and the background. Highlights are not included - they are drawn
+                // separately by render_highlights so that moving the cursor doesn't redraw the whole map.
                 void render_internal(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context);
 
-                // Determines if the minimap needs to be re-drawn.
-                bool needs_redraw();
-
                 const graphics::Device&                            _device;
                 bool                                               _visible = true;
                 int                                                _window_width, _window_height;
-                graphics::Sprite                                   _sprite; 
+                graphics::SpriteBatch                              _batch;
                 graphics::Texture                                  _texture;
                 std::vector<Tile>                                  _tiles; 
+                std::vector<int32_t>                               _tile_index; // Index into _tiles for each column and row, or -1.
                 std::unique_ptr<graphics::RenderTarget>            _render_target;
 
                 Point                               _first, _last; // top-left corner, bottom-right corner (of control) 
                 Point                               _cursor; // Position of the cursor relative to the top left of the control.
                 std::uint16_t                       _rows, _columns; 
                 bool                                _loaded = false;
-                
-                bool                                _cursor_was_over = false;
                 bool                                _force_redraw = true;
 
                 const float                         _DRAW_MARGIN = 30.0f; 
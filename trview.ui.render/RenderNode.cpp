@@ -4,10 +4,13 @@
 
 #include <trview.ui/Control.h>
 #include <trview.graphics/Sprite.h>
+#include <trview.graphics/SpriteBatch.h>
+#include <trview.graphics/RenderTargetPool.h>
 #include <trview.graphics/RenderTargetStore.h>
 #include <trview.graphics/ViewportStore.h>
 #include <trview.graphics/SpriteSizeStore.h>
 #include <trview.common/Size.h>
+#include <trview.common/Profiler.h>
 
 using namespace Microsoft::WRL;
 
@@ -27,6 +30,7 @@ namespace trview
 
             RenderNode::~RenderNode()
             {
+                _device.render_target_pool().release(std::move(_render_target));
             }
 
             const graphics::Texture& RenderNode::node_texture() const
@@ -34,22 +38,38 @@ namespace trview
                 return _render_target->texture();
             }
 
-            void RenderNode::render(const ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite)
+            DirectX::SimpleMath::Vector2 RenderNode::node_uv() const
+            {
+                return _render_target->active_uv();
+            }
+
+            bool RenderNode::render(const ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite, graphics::SpriteBatch& batch)
             {
                 if (!needs_redraw() && !needs_recompositing())
                 {
-                    return;
+                    return false;
                 }
 
                 if (!visible())
                 {
                     _needs_redraw = false;
-                    return;
+                    return false;
                 }
 
+                bool children_redrawn = false;
                 for (auto& child : _child_nodes)
                 {
-                    child->render(context, sprite);
+                    children_redrawn |= child->render(context, sprite, batch);
+                }
+
+                // Controls often invalidate without changing anything that is drawn, so only draw again if
+                // something has actually changed. The parent then doesn't need to recomposite either.
+                const uint64_t key = content_key();
+                if (!children_redrawn && _drawn_key == key)
+                {
+                    _needs_redraw = false;
+                    profile_count(ProfileCounter::UiRedrawsSkipped);
+                    return false;
                 }
 
                 graphics::RenderTargetStore render_target_store(context);
@@ -64,6 +84,7 @@ namespace trview
                     [](auto& child) { return child.get(); });
                 std::sort(children.begin(), children.end(), [](const auto& l, const auto& r) { return l->z() > r->z(); });
 
+                batch.begin(_render_target->size());
                 for (auto& child : children)
                 {
                     if (!child->visible())
@@ -74,10 +95,14 @@ namespace trview
                     // Render the child in the correct position on the render target.
                     auto pos = child->position();
                     auto size = child->size();
-                    sprite.render(context, child->node_texture(), pos.x, pos.y, size.width, size.height);
+                    batch.draw(child->node_texture(), pos.x, pos.y, size.width, size.height, DirectX::SimpleMath::Vector2::Zero, child->node_uv(), DirectX::SimpleMath::Color(1, 1, 1, 1));
                 }
+                batch.end(context);
 
                 _needs_redraw = false;
+                _drawn_key = key;
+                profile_count(ProfileCounter::UiRedraws);
+                return true;
             }
 
             void RenderNode::add_child(std::unique_ptr<RenderNode>&& child)
@@ -119,9 +144,34 @@ namespace trview
 
             void RenderNode::regenerate_texture()
             {
+                // Controls are resized often, for example when the window is resized, so render targets are
+                // taken from the pool rather than created each time.
                 auto size = _control->size();
-                size = Size(size.width == 0 ? 1 : size.width, size.height == 0 ? 1 : size.height);
-                _render_target = std::make_unique<graphics::RenderTarget>(_device, static_cast<uint32_t>(size.width), static_cast<uint32_t>(size.height));
+                _device.render_target_pool().resize(_render_target, static_cast<uint32_t>(size.width), static_cast<uint32_t>(size.height));
+                _drawn_key.reset();
+            }
+
+            void RenderNode::add_content(ContentKey& key) const
+            {
+                key.add(size());
+
+                // The layout of the visible children affects how they are composited on to this node.
+                key.add(_child_nodes.size());
+                for (const auto& child : _child_nodes)
+                {
+                    key.add(child.get()).add(child->visible());
+                    if (child->visible())
+                    {
+                        key.add(child->position()).add(child->size()).add(child->z());
+                    }
+                }
+            }
+
+            uint64_t RenderNode::content_key() const
+            {
+                ContentKey key;
+                add_content(key);
+                return key.value();
             }
 
             void RenderNode::set_hierarchy_changed(bool value)
@@ -5,8 +5,10 @@
 #include <cstdint>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
+#include <trview.common/ContentKey.h>
 #include <trview.common/TokenStore.h>
 #include <trview.common/Point.h>
 #include <trview.graphics/RenderTarget.h>
@@ -19,6 +21,7 @@ namespace trview
     namespace graphics
     {
         class Sprite;
+        class SpriteBatch;
     }
 
     namespace ui
@@ -41,7 +44,16 @@ namespace trview
 
                 const graphics::Texture& node_texture() const;
 
-                void render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite);
+                /// Gets the texture coordinates of the bottom right of the part of the node texture that is used.
+                DirectX::SimpleMath::Vector2 node_uv() const;
+
+                /// Render the node and its children, if they need to be rendered. A node that has been
+                /// invalidated is only drawn again if its content key or one of its children has changed.
+                /// @param context The device context.
+                /// @param sprite The sprite used by the nodes to draw themselves.
+                /// @param batch The sprite batch used to composite the child nodes on to this node.
+                /// @returns True if the texture for the node was drawn again.
+                bool render(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite, graphics::SpriteBatch& batch);
 
                 void add_child(std::unique_ptr<RenderNode>&& child);
 
@@ -63,6 +75,11 @@ namespace trview
             protected:
                 virtual void render_self(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite) = 0;
 
+                /// Add everything that affects how the node looks to the content key. Nodes that draw more
+                /// than the base node must add the values that they use and call the base implementation.
+                /// @param key The key to add to.
+                virtual void add_content(ContentKey& key) const;
+
                 TokenStore _token_store;
             public:
                 // Determines if the control itself needs to redraw.
@@ -74,12 +91,16 @@ namespace trview
 
                 void regenerate_texture();
 
+                // Calculate the content key for the current state of the control and its children.
+                uint64_t content_key() const;
+
                 const graphics::Device&                  _device;
                 std::unique_ptr<graphics::RenderTarget>  _render_target;
                 std::vector<std::unique_ptr<RenderNode>> _child_nodes;
                 Control*                                 _control;
                 bool                                     _needs_redraw{ true };
                 bool                                     _hierarchy_changed{ false };
+                std::optional<uint64_t>                  _drawn_key; // The content key when the texture was last drawn.
             };
         }
     }
@@ -10,6 +10,7 @@
 #include "ImageNode.h"
 #include "ButtonNode.h"
 #include <trview.graphics/Sprite.h>
+#include <trview.graphics/SpriteBatch.h>
 #include <trview.graphics/RenderTargetStore.h>
 
 namespace trview
@@ -22,6 +23,7 @@ namespace trview
                 : _device(device), 
                 _font_factory(font_factory),
                 _sprite(std::make_unique<graphics::Sprite>(device, shader_storage, host_size)),
+                _batch(std::make_unique<graphics::SpriteBatch>(device, shader_storage)),
                 _host_size(host_size)
             {
                 D3D11_DEPTH_STENCIL_DESC ui_depth_stencil_desc;
@@ -127,13 +129,15 @@ namespace trview
 
                         // The nodes will detect whether or not they need to actually re-render
                         // their content, based on changes to the control that they are watching.
-                        _root_node->render(context, *_sprite); 
+                        _root_node->render(context, *_sprite, *_batch); 
                     }
 
                     auto texture = _root_node->node_texture();
                     if (texture.can_use_as_resource())
                     {
-                        _sprite->render(context, texture, 0, 0, _host_size.width, _host_size.height);
+                        _batch->begin(_host_size);
+                        _batch->draw(texture, 0, 0, _host_size.width, _host_size.height, DirectX::SimpleMath::Vector2::Zero, _root_node->node_uv(), DirectX::SimpleMath::Color(1, 1, 1, 1));
+                        _batch->end(context);
                     }
                 }
             }
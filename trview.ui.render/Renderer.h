@@ -17,6 +17,7 @@ namespace trview
         struct IShaderStorage;
         class FontFactory;
         class Sprite;
+        class SpriteBatch;
     }
 
     namespace ui
@@ -49,6 +50,7 @@ namespace trview
 
                 std::unique_ptr<RenderNode>                     _root_node;
                 std::unique_ptr<graphics::Sprite>               _sprite;
+                std::unique_ptr<graphics::SpriteBatch>          _batch;
                 const graphics::Device&                         _device;
                 Microsoft::WRL::ComPtr<ID3D11DepthStencilState> _depth_stencil_state;
                 const graphics::FontFactory&                    _font_factory;
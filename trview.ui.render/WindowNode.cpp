@@ -20,6 +20,12 @@ namespace trview
             {
                 _render_target->clear(context, _window->background_colour());
             }
+
+            void WindowNode::add_content(ContentKey& key) const
+            {
+                RenderNode::add_content(key);
+                key.add(_window->background_colour());
+            }
         }
     }
 }
\ No newline at end of file
@@ -20,6 +20,7 @@ namespace trview
                 virtual ~WindowNode();
             protected:
                 virtual void render_self(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, graphics::Sprite& sprite) override;
+                virtual void add_content(ContentKey& key) const override;
             private:
                 Window* _window;
             };
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+#include <trview.ui/HitTestIndex.h>
+#include <trview.ui/Window.h>
+
+using namespace trview;
+using namespace trview::ui;
+
+namespace
+{
+    std::vector<Control*> controls(const std::vector<HitTestIndex::Hit>& hits)
+    {
+        std::vector<Control*> result;
+        for (const auto& hit : hits)
+        {
+            result.push_back(hit.control);
+        }
+        return result;
+    }
+}
+
+/// Tests that children are returned before their parent with positions relative to each control.
+TEST(HitTestIndex, ChildrenBeforeParent)
+{
+    Window root(Size(100, 100), Colour::Transparent);
+    auto child = root.add_child(std::make_unique<Window>(Point(10, 10), Size(50, 50), Colour::Transparent));
+    auto grandchild = child->add_child(std::make_unique<Window>(Point(5, 5), Size(10, 10), Colour::Transparent));
+
+    HitTestIndex index(root);
+    std::vector<HitTestIndex::Hit> hits;
+    index.query(Point(20, 20), hits);
+
+    ASSERT_EQ((std::vector<Control*>{ grandchild, child, &root }), controls(hits));
+    ASSERT_EQ(5, hits[0].position.x);
+    ASSERT_EQ(5, hits[0].position.y);
+    ASSERT_EQ(10, hits[1].position.x);
+    ASSERT_EQ(10, hits[1].position.y);
+    ASSERT_EQ(20, hits[2].position.x);
+    ASSERT_EQ(20, hits[2].position.y);
+}
+
+/// Tests that siblings are returned in z order and that controls outside the point are skipped.
+TEST(HitTestIndex, SiblingsInZOrder)
+{
+    Window root(Size(100, 100), Colour::Transparent);
+    auto first = root.add_child(std::make_unique<Window>(Point(0, 0), Size(50, 50), Colour::Transparent));
+    auto second = root.add_child(std::make_unique<Window>(Point(0, 0), Size(50, 50), Colour::Transparent));
+    root.add_child(std::make_unique<Window>(Point(60, 60), Size(10, 10), Colour::Transparent));
+    first->set_z(1);
+
+    HitTestIndex index(root);
+    std::vector<HitTestIndex::Hit> hits;
+    index.query(Point(25, 25), hits);
+
+    ASSERT_EQ((std::vector<Control*>{ second, first, &root }), controls(hits));
+}
+
+/// Tests that hidden controls and their children are not returned, without rebuilding the index.
+TEST(HitTestIndex, HiddenControlsSkipped)
+{
+    Window root(Size(100, 100), Colour::Transparent);
+    auto child = root.add_child(std::make_unique<Window>(Point(0, 0), Size(50, 50), Colour::Transparent));
+    child->add_child(std::make_unique<Window>(Point(0, 0), Size(50, 50), Colour::Transparent));
+
+    HitTestIndex index(root);
+    std::vector<HitTestIndex::Hit> hits;
+    index.query(Point(25, 25), hits);
+    ASSERT_EQ(3u, hits.size());
+
+    child->set_visible(false);
+    index.query(Point(25, 25), hits);
+    ASSERT_EQ((std::vector<Control*>{ &root }), controls(hits));
+    ASSERT_EQ(1u, index.builds());
+}
+
+/// Tests that the index is only rebuilt after it has been invalidated.
+TEST(HitTestIndex, RebuiltWhenInvalidated)
+{
+    Window root(Size(100, 100), Colour::Transparent);
+    auto child = root.add_child(std::make_unique<Window>(Point(0, 0), Size(50, 50), Colour::Transparent));
+
+    HitTestIndex index(root);
+    std::vector<HitTestIndex::Hit> hits;
+    index.query(Point(75, 75), hits);
+    index.query(Point(75, 75), hits);
+    ASSERT_EQ((std::vector<Control*>{ &root }), controls(hits));
+    ASSERT_EQ(1u, index.builds());
+
+    child->set_position(Point(50, 50));
+    index.invalidate();
+    index.query(Point(75, 75), hits);
+    ASSERT_EQ((std::vector<Control*>{ child, &root }), controls(hits));
+    ASSERT_EQ(2u, index.builds());
+}
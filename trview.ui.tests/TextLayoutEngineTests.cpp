@@ -0,0 +1,192 @@
+#include "gtest/gtest.h"
+#include <trview.ui/TextLayoutEngine.h>
+#include <algorithm>
+
+using namespace trview;
+using namespace trview::ui;
+
+namespace
+{
+    /// Every character is 10 pixels wide.
+    float fixed_advance(const std::wstring& text)
+    {
+        return 10.0f * text.size();
+    }
+
+    /// Measures like a sprite font: each glyph is 8 pixels wide and is followed by 2 pixels of space before
+    /// the next glyph, except that 'A' and 'V' are kerned 3 pixels closer together. The space after the last
+    /// glyph is not part of the width.
+    float font_measure(const std::wstring& text)
+    {
+        float width = 0.0f;
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            width += i ? 10.0f : 8.0f;
+            if (i && ((text[i - 1] == L'A' && text[i] == L'V') || (text[i - 1] == L'V' && text[i] == L'A')))
+            {
+                width -= 3.0f;
+            }
+        }
+        return width;
+    }
+
+    void expect_same_lines(const TextLayoutEngine& incremental, const std::wstring& text, float width)
+    {
+        TextLayoutEngine full(fixed_advance, width);
+        full.set_text(text);
+
+        const auto& expected = full.lines();
+        const auto& actual = incremental.lines();
+        ASSERT_EQ(expected.size(), actual.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            ASSERT_EQ(expected[i].start, actual[i].start);
+            ASSERT_EQ(expected[i].length, actual[i].length);
+            ASSERT_EQ(expected[i].width, actual[i].width);
+        }
+    }
+}
+
+/// Tests that lines that are too wide are wrapped at the last space.
+TEST(TextLayoutEngine, WrapsAtLastSpace)
+{
+    TextLayoutEngine layout(fixed_advance, 90);
+    layout.set_text(L"one two three four");
+
+    ASSERT_EQ(3u, layout.lines().size());
+    ASSERT_EQ(L"one two ", layout.line_text(0));
+    ASSERT_EQ(L"three ", layout.line_text(1));
+    ASSERT_EQ(L"four", layout.line_text(2));
+    ASSERT_TRUE(layout.is_wrapped(0));
+    ASSERT_EQ(L"one two \nthree \nfour", layout.display_text());
+
+    // The text itself doesn't change when it is wrapped.
+    ASSERT_EQ(L"one two three four", layout.text());
+}
+
+/// Tests that words that are wider than the line are split and line breaks start new lines.
+TEST(TextLayoutEngine, LongWordsAndLineBreaks)
+{
+    TextLayoutEngine layout(fixed_advance, 50);
+    layout.set_text(L"abcdefgh\nxy\n");
+
+    ASSERT_EQ(4u, layout.lines().size());
+    ASSERT_EQ(L"abcde", layout.line_text(0));
+    ASSERT_EQ(L"fgh", layout.line_text(1));
+    ASSERT_EQ(L"xy", layout.line_text(2));
+    ASSERT_EQ(L"", layout.line_text(3));
+    ASSERT_TRUE(layout.is_wrapped(0));
+    ASSERT_FALSE(layout.is_wrapped(1));
+
+    // A position at the start of a wrapped line is on that line.
+    ASSERT_EQ(1u, layout.line_of(5));
+    ASSERT_EQ(3u, layout.line_of(12));
+    ASSERT_EQ(20.0f, layout.x_of(7));
+}
+
+/// Tests that typing into a long piece of text only lays out the lines around the edit.
+TEST(TextLayoutEngine, InsertOnlyLaysOutChangedLines)
+{
+    std::wstring text;
+    for (int i = 0; i < 100; ++i)
+    {
+        text += L"line\n";
+    }
+
+    TextLayoutEngine layout(fixed_advance, 100);
+    layout.set_text(text);
+    ASSERT_EQ(101u, layout.lines_laid_out());
+
+    layout.insert(54, L"s");
+    text.insert(54, L"s");
+    ASSERT_LE(layout.lines_laid_out(), 2u);
+    ASSERT_EQ(L"lines", layout.line_text(10));
+    ASSERT_EQ(56u, layout.lines()[11].start);
+    expect_same_lines(layout, text, 100);
+}
+
+/// Tests that removing text lets words move back on to the previous line.
+TEST(TextLayoutEngine, EraseMovesWordsBack)
+{
+    TextLayoutEngine layout(fixed_advance, 100);
+    layout.set_text(L"aaaa bbbbbb cc dd");
+    ASSERT_EQ(L"aaaa ", layout.line_text(0));
+    ASSERT_EQ(L"bbbbbb cc ", layout.line_text(1));
+
+    layout.erase(5, 4);
+    ASSERT_EQ(L"aaaa bb cc ", layout.line_text(0));
+    expect_same_lines(layout, L"aaaa bb cc dd", 100);
+}
+
+/// Tests that a series of edits produces the same lines as laying out the text from the start.
+TEST(TextLayoutEngine, EditsMatchFullLayout)
+{
+    TextLayoutEngine layout(fixed_advance, 80);
+    std::wstring text = L"the quick brown fox\njumps over the lazy dog and keeps on running";
+    layout.set_text(text);
+
+    const std::vector<std::pair<std::size_t, std::wstring>> inserts
+    {
+        { 4, L"very " }, { 0, L"x" }, { 30, L"\n" }, { 45, L"averyveryverylongword " }, { text.size(), L" end" }
+    };
+
+    for (const auto& insert : inserts)
+    {
+        const auto position = std::min(insert.first, text.size());
+        layout.insert(position, insert.second);
+        text.insert(position, insert.second);
+        ASSERT_EQ(text, layout.text());
+        expect_same_lines(layout, text, 80);
+    }
+
+    for (std::size_t position : { 0u, 10u, 20u, 25u, 3u })
+    {
+        layout.erase(position, 4);
+        text.erase(position, 4);
+        ASSERT_EQ(text, layout.text());
+        expect_same_lines(layout, text, 80);
+    }
+}
+
+/// Tests that the position on a line closest to an x position is found.
+TEST(TextLayoutEngine, PositionAt)
+{
+    TextLayoutEngine layout(fixed_advance, 100);
+    layout.set_text(L"one two three\nab");
+
+    ASSERT_EQ(0u, layout.position_at(0, 0));
+    ASSERT_EQ(2u, layout.position_at(0, 16));
+    // The end of a wrapped line is the same position as the start of the next, so stop before it.
+    ASSERT_EQ(7u, layout.position_at(0, 1000));
+    ASSERT_EQ(16u, layout.position_at(2, 1000));
+}
+
+/// Tests that positions on a line match the width of the text before them, including the space between
+/// glyphs and kerning, which aren't part of the width of a glyph measured on its own.
+TEST(TextLayoutEngine, AdvancesIncludeSpacingAndKerning)
+{
+    const std::wstring text = L"AVAVxyz";
+    TextLayoutEngine layout(font_measure, 1000);
+    layout.set_text(text);
+
+    for (std::size_t i = 1; i <= text.size(); ++i)
+    {
+        ASSERT_EQ(font_measure(text.substr(0, i)), layout.x_of(i));
+    }
+    ASSERT_EQ(font_measure(text), layout.lines()[0].width);
+    ASSERT_EQ(font_measure(L"AVAVxxyz"), layout.width_with(4, L'x'));
+    ASSERT_EQ(font_measure(L"AVAAVxyz"), layout.width_with(2, L'A'));
+    ASSERT_EQ(2u, layout.position_at(0, font_measure(L"AV") + 1.0f));
+}
+
+/// Tests that lines are wrapped using the width of the text as the font would draw it.
+TEST(TextLayoutEngine, WrapsUsingMeasuredWidth)
+{
+    // Ten glyphs are 98 pixels wide, so eleven don't fit in 100 pixels even though 11 * 8 would.
+    TextLayoutEngine layout(font_measure, 100);
+    layout.set_text(L"abcdefghijk");
+
+    ASSERT_EQ(2u, layout.lines().size());
+    ASSERT_EQ(L"abcdefghij", layout.line_text(0));
+    ASSERT_EQ(font_measure(L"abcdefghij"), layout.lines()[0].width);
+}
@@ -64,6 +64,7 @@ namespace trview
         void Control::set_position(Point position)
         {
             _position = position;
+            on_layout_changed();
             on_invalidate();
         }
 
@@ -239,6 +240,7 @@ namespace trview
         void Control::set_z(int value)
         {
             _z = value;
+            on_layout_changed();
             on_invalidate();
         }
 
@@ -161,6 +161,9 @@ namespace trview
             /// Event raised when the control has changed and needs to be redrawn.
             Event<> on_invalidate;
 
+            /// Event raised when the position or z order of the control has changed.
+            Event<> on_layout_changed;
+
             /// Event raised when there has been a change to the children of this control.
             Event<> on_hierarchy_changed;
 
@@ -0,0 +1,93 @@
+#include "HitTestIndex.h"
+#include "Control.h"
+
+namespace trview
+{
+    namespace ui
+    {
+        namespace
+        {
+            bool in_bounds(const Point& position, const Size& size)
+            {
+                return position.x >= 0 && position.y >= 0 && position.x <= size.width && position.y <= size.height;
+            }
+        }
+
+        HitTestIndex::HitTestIndex(Control& root)
+            : _root(root)
+        {
+        }
+
+        void HitTestIndex::invalidate()
+        {
+            _valid = false;
+        }
+
+        void HitTestIndex::query(const Point& position, std::vector<Hit>& hits)
+        {
+            hits.clear();
+            if (!_valid)
+            {
+                build();
+            }
+
+            // Walk the entries in depth first order. A control is added to the results once the whole of its
+            // subtree has been visited, so that children are offered input before their parent.
+            _stack.clear();
+            uint32_t index = 0;
+            while (index < _entries.size())
+            {
+                while (!_stack.empty() && _entries[_stack.back()].end <= index)
+                {
+                    const auto& entry = _entries[_stack.back()];
+                    hits.push_back({ entry.control, position - entry.position });
+                    _stack.pop_back();
+                }
+
+                const auto& entry = _entries[index];
+                if (!entry.control->visible() || !in_bounds(position - entry.position, entry.size))
+                {
+                    index = entry.end;
+                    continue;
+                }
+
+                _stack.push_back(index);
+                ++index;
+            }
+
+            while (!_stack.empty())
+            {
+                const auto& entry = _entries[_stack.back()];
+                hits.push_back({ entry.control, position - entry.position });
+                _stack.pop_back();
+            }
+        }
+
+        uint32_t HitTestIndex::builds() const
+        {
+            return _builds;
+        }
+
+        void HitTestIndex::build()
+        {
+            _entries.clear();
+            add(&_root, Point());
+            _valid = true;
+            ++_builds;
+        }
+
+        void HitTestIndex::add(Control* control, const Point& parent_position)
+        {
+            const auto position = parent_position + control->position();
+            const auto index = static_cast<uint32_t>(_entries.size());
+            _entries.push_back({ control, position, control->size(), 0 });
+
+            for (const auto& child : control->child_elements())
+            {
+                add(child, position);
+            }
+
+            _entries[index].end = static_cast<uint32_t>(_entries.size());
+        }
+    }
+}
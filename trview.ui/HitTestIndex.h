@@ -0,0 +1,71 @@
+/// @file HitTestIndex.h
+/// @brief Finds the controls under a point without walking the control tree.
+///
+/// The control tree is flattened into a list of absolute rectangles in depth first order, with
+/// each entry recording where its subtree ends so that controls outside the point can be skipped
+/// along with all of their children. The list is rebuilt the next time it is used after it has
+/// been invalidated.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <trview.common/Point.h>
+#include <trview.common/Size.h>
+
+namespace trview
+{
+    namespace ui
+    {
+        class Control;
+
+        /// Finds the controls under a point without walking the control tree.
+        class HitTestIndex final
+        {
+        public:
+            /// A control that contains the point being tested.
+            struct Hit
+            {
+                /// The control.
+                Control* control;
+                /// The point relative to the control.
+                Point    position;
+            };
+
+            /// Create a hit test index for a control tree.
+            /// @param root The root of the control tree.
+            explicit HitTestIndex(Control& root);
+
+            /// Mark the index as out of date. This should be called when the position, size, z order or
+            /// children of any control in the tree change.
+            void invalidate();
+
+            /// Find the visible controls that contain the point. Controls are returned in the order that input is
+            /// offered to them - child controls in z order come before their parent.
+            /// @param position The point relative to the parent of the root control.
+            /// @param hits The vector to fill with the results. Any existing contents are removed.
+            void query(const Point& position, std::vector<Hit>& hits);
+
+            /// Gets the number of times that the index has been built.
+            uint32_t builds() const;
+        private:
+            struct Entry
+            {
+                Control* control;
+                Point    position;
+                Size     size;
+                /// The index after the last entry in the subtree of this control.
+                uint32_t end;
+            };
+
+            void build();
+            void add(Control* control, const Point& parent_position);
+
+            Control&              _root;
+            std::vector<Entry>    _entries;
+            std::vector<uint32_t> _stack;
+            bool                  _valid{ false };
+            uint32_t              _builds{ 0u };
+        };
+    }
+}
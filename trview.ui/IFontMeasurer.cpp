@@ -7,5 +7,10 @@ namespace trview
         IFontMeasurer::~IFontMeasurer()
         {
         }
+
+        Size IFontMeasurer::measure_append(const std::wstring& text, wchar_t character) const
+        {
+            return measure(text + character);
+        }
     }
 }
@@ -19,6 +19,12 @@ namespace trview
             /// @param text The text to measure.
             virtual Size measure(const std::wstring& text) const = 0;
 
+            /// Measure the specified text with a character added to the end.
+            /// @param text The existing text.
+            /// @param character The character to add.
+            /// @returns The size of the combined text.
+            virtual Size measure_append(const std::wstring& text, wchar_t character) const;
+
             /// Determines if the character is in the image set.
             /// @param character The character to test.
             /// @returns True if the character has an image.
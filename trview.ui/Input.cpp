@@ -1,6 +1,7 @@
 #include "Input.h"
 #include "Control.h"
 #include <trview.input/WindowTester.h>
+#include <algorithm>
 
 namespace trview
 {
@@ -15,7 +16,7 @@ namespace trview
         }
 
         Input::Input(const trview::Window& window, Control& control)
-            : _mouse(window, std::make_unique<input::WindowTester>(window)), _keyboard(window), _window(window), _control(control)
+            : _mouse(window, std::make_unique<input::WindowTester>(window)), _keyboard(window), _window(window), _control(control), _hit_test(control)
         {
             register_events();
         }
@@ -28,6 +29,7 @@ namespace trview
         void Input::register_events()
         {
             _token_store = TokenStore();
+            _hit_test.invalidate();
 
             register_focus_controls(&_control);
 
@@ -49,6 +51,8 @@ namespace trview
             {
                 register_events();
             };
+            _token_store += control->on_size_changed += [this](auto) { _hit_test.invalidate(); };
+            _token_store += control->on_layout_changed += [this]() { _hit_test.invalidate(); };
             _token_store += control->on_deleting += [this, control]()
             {
                 if (_focus_control == control)
@@ -66,8 +70,9 @@ namespace trview
         void Input::process_mouse_move()
         {
             auto position = client_cursor_position(_window);
+            auto hits = query(position);
 
-            Control* control = hover_control_at_position(position);
+            Control* control = hover_control(hits);
             if (control != _hover_control)
             {
                 if (_hover_control)
@@ -87,98 +92,55 @@ namespace trview
                 auto focus = _focus_control;
                 if (focus->move(position - focus->absolute_position()))
                 {
+                    release(std::move(hits));
                     return;
                 }
             }
 
-            process_mouse_move(&_control, position - _control.position());
-        }
-
-        bool Input::process_mouse_move(Control* control, const Point& position)
-        {
-            // Bounds check - before child elements are checked.
-            if (!control->visible() || !in_bounds(position, control->size()))
-            {
-                return false;
-            }
-
-            for (auto& child : control->child_elements())
+            // Offer the move to each control under the cursor until one handles it.
+            for (const auto& hit : hits)
             {
-                // Convert the position into the coordinate space of the child element.
-                if (process_mouse_move(child, position - child->position()))
+                if (hit.control->move(hit.position))
                 {
-                    return true;
+                    break;
                 }
             }
-
-            // If none of the child elements have handled this event themselves, call the 
-            // move function of this control.
-            return control->move(position);
-        }
-
-        Control* Input::hover_control_at_position(const Point& position)
-        {
-            return hover_control_at_position(&_control, position);
+            release(std::move(hits));
         }
 
-        Control* Input::hover_control_at_position(Control* control, const Point& position)
+        Control* Input::hover_control(const std::vector<HitTestIndex::Hit>& hits) const
         {
-            if (!control->visible() || !in_bounds(position, control->size()))
-            {
-                return nullptr;
-            }
-
-            for (const auto& child : control->child_elements())
+            for (const auto& hit : hits)
             {
-                auto result = hover_control_at_position(child, position - child->position());
-                if (result && result->handles_hover())
+                if (hit.control->handles_hover())
                 {
-                    return result;
+                    return hit.control;
                 }
             }
-
-            if (control->handles_hover())
-            {
-                return control;
-            }
-
             return nullptr;
         }
 
         void Input::process_mouse_down()
         {
             auto position = client_cursor_position(_window);
-            process_mouse_down(&_control, position);
-        }
+            auto hits = query(position);
 
-        bool Input::process_mouse_down(Control* control, const Point& position)
-        {
-            if (!control->visible() || !in_bounds(position, control->size()))
+            for (const auto& hit : hits)
             {
-                return false;
-            }
-
-            for (auto& child : control->child_elements())
-            {
-                // Convert the position into the coordinate space of the child element.
-                if (process_mouse_down(child, position - child->position()))
+                // Promote controls to focus control, or clear if there are no controls that 
+                // accepted the event.
+                const auto control = hit.control;
+                if (control->handles_input() && control->mouse_down(hit.position))
                 {
-                    return true;
+                    set_focus_control(control);
+                    break;
+                }
+                else if (!control->parent())
+                {
+                    set_focus_control(nullptr);
                 }
             }
-
-            // Promote controls to focus control, or clear if there are no controls that 
-            // accepted the event.
-            bool handled_by_self = control->handles_input() && control->mouse_down(position);
-            if (handled_by_self)
-            {
-                set_focus_control(control);
-            }
-            else if (!control->parent())
-            {
-                set_focus_control(nullptr);
-            }
-            return handled_by_self;
+            release(std::move(hits));
         }
 
         void Input::process_mouse_up()
@@ -201,28 +163,15 @@ namespace trview
                 }
             }
 
-            process_mouse_up(&_control, position);
-        }
-
-        bool Input::process_mouse_up(Control* control, const Point& position)
-        {
-            // Bounds check - before child elements are checked.
-            if (!control->visible() || !in_bounds(position, control->size()))
+            auto hits = query(position);
+            for (const auto& hit : hits)
             {
-                return false;
-            }
-
-            for (auto& child : control->child_elements())
-            {
-                // Convert the position into the coordinate space of the child element.
-                if (process_mouse_up(child, position - child->position()))
+                if (hit.control->mouse_up(hit.position))
                 {
-                    return true;
+                    break;
                 }
             }
-
-            // If none of the child elements have handled this event themselves, call the up of the control.
-            return control->mouse_up(position);
+            release(std::move(hits));
         }
 
         void Input::process_mouse_scroll(int16_t delta)
@@ -235,29 +184,39 @@ namespace trview
                 _focus_control->scroll(delta);
                 return;
             }
-            process_mouse_scroll(&_control, position, delta);
-        }
-
-        bool Input::process_mouse_scroll(Control* control, const Point& position, int16_t delta)
-        {
-            // Bounds check - before child elements are checked.
-            if (!control->visible() || !in_bounds(position, control->size()))
-            {
-                return false;
-            }
 
-            for (auto& child : control->child_elements())
+            auto hits = query(position);
+            for (const auto& hit : hits)
             {
-                // Convert the position into the coordinate space of the child element.
-                if (process_mouse_scroll(child, position - child->position(), delta))
+                if (hit.control->scroll(delta))
                 {
-                    return true;
+                    break;
                 }
             }
+            release(std::move(hits));
+        }
 
-            // If none of the child elements have handled this event themselves, call the 
-            // scroll function of this control.
-            return control->scroll(delta);
+        bool Input::is_mouse_over(const Point& position)
+        {
+            auto hits = query(position);
+            const bool over = std::any_of(hits.begin(), hits.end(), [](const auto& hit) { return hit.control->handles_input(); });
+            release(std::move(hits));
+            return over;
+        }
+
+        std::vector<HitTestIndex::Hit> Input::query(const Point& position)
+        {
+            // Take the buffer so that an event handler that causes another query doesn't change the results
+            // that are being iterated over.
+            std::vector<HitTestIndex::Hit> hits;
+            hits.swap(_hits);
+            _hit_test.query(position, hits);
+            return hits;
+        }
+
+        void Input::release(std::vector<HitTestIndex::Hit>&& hits)
+        {
+            _hits = std::move(hits);
         }
 
         void Input::process_key_down(uint16_t key, bool)
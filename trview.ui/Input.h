@@ -5,6 +5,7 @@
 #include <trview.input/Mouse.h>
 #include <trview.input/Keyboard.h>
 #include "IInputQuery.h"
+#include "HitTestIndex.h"
 
 namespace trview
 {
@@ -19,19 +20,21 @@ namespace trview
             explicit Input(const trview::Window& window, Control& control);
             virtual ~Input() = default;
             virtual Control* focus_control() const;
+
+            /// Determines whether the position is over a visible control in the tree that handles input.
+            /// @param position The position in client coordinates.
+            /// @returns True if the position is over a control that handles input.
+            bool is_mouse_over(const Point& position);
         private:
             void     register_events();
             void     register_focus_controls(Control* control);
             void     process_mouse_move();
-            bool     process_mouse_move(Control* control, const Point& position);
-            Control* hover_control_at_position(const Point& position);
-            Control* hover_control_at_position(Control* control, const Point& position);
+            Control* hover_control(const std::vector<HitTestIndex::Hit>& hits) const;
             void     process_mouse_down();
-            bool     process_mouse_down(Control* control, const Point& position);
             void     process_mouse_up();
-            bool     process_mouse_up(Control* control, const Point& position);
             void     process_mouse_scroll(int16_t delta);
-            bool     process_mouse_scroll(Control* control, const Point& position, int16_t delta);
+            std::vector<HitTestIndex::Hit> query(const Point& position);
+            void     release(std::vector<HitTestIndex::Hit>&& hits);
             void     process_key_down(uint16_t key, bool control);
             bool     process_key_down(Control* control, uint16_t key);
             void     process_char(uint16_t key);
@@ -47,6 +50,8 @@ namespace trview
             Control&       _control;
             Control*       _hover_control{ nullptr };
             Control*       _focus_control{ nullptr };
+            HitTestIndex   _hit_test;
+            std::vector<HitTestIndex::Hit> _hits;
         };
     }
 }
\ No newline at end of file
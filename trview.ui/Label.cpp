@@ -72,9 +72,19 @@ namespace trview
             return _measurer->measure(text);
         }
 
+        Size Label::measure_text_append(const std::wstring& text, wchar_t character) const
+        {
+            if (!_measurer)
+            {
+                return Size();
+            }
+            return _measurer->measure_append(text, character);
+        }
+
         void Label::set_measurer(IFontMeasurer* measurer)
         {
             _measurer = measurer;
+            on_measurer_changed();
         }
 
         bool Label::is_valid_character(wchar_t character) const
@@ -58,10 +58,19 @@ namespace trview
             /// @returns The size of the rendered text.
             Size measure_text(const std::wstring& text) const;
 
+            /// Measure the specified text with a character added to the end.
+            /// @param text The existing text.
+            /// @param character The character to add.
+            /// @returns The size of the rendered text.
+            Size measure_text_append(const std::wstring& text, wchar_t character) const;
+
             /// Set the measurer used to measure how big text will be.
             /// @param measurer The measurer instance.
             void set_measurer(IFontMeasurer* measurer);
 
+            /// Event raised when the measurer has changed, so measurements made before may be different.
+            Event<> on_measurer_changed;
+
             /// Determine whether the character specified is in the character set.
             bool is_valid_character(wchar_t character) const;
         private:
@@ -1,22 +1,37 @@
 #include "TextArea.h"
 #include "Label.h"
-#include <sstream>
 
 namespace trview
 {
     namespace ui
     {
+        namespace
+        {
+            /// The height of a line when there is no font to measure with.
+            const float Default_Line_Height = 14.0f;
+        }
+
         TextArea::TextArea(const Size& size, const Colour& background_colour, const Colour& text_colour, graphics::TextAlignment text_alignment)
             : TextArea(Point(), size, background_colour, text_colour, text_alignment)
         {
         }
 
         TextArea::TextArea(const Point& position, const Size& size, const Colour& background_colour, const Colour& text_colour, graphics::TextAlignment text_alignment)
-            : Window(position, size, background_colour), _text_colour(text_colour), _alignment(text_alignment)
+            : Window(position, size, background_colour),
+            _layout([this](const std::wstring& text) { return _text->measure_text(text).width; }, size.width - 2),
+            _text_colour(text_colour), _alignment(text_alignment)
         {
-            _area = add_child(std::make_unique<StackPanel>(size, background_colour, Size(), StackPanel::Direction::Vertical, SizeMode::Manual));
-            _area->set_margin(Size(1, 1));
-            _cursor = add_child(std::make_unique<Window>(Size(1, 14), text_colour));
+            // All of the lines are drawn by one label so that they are drawn as a single run of glyphs.
+            _text = add_child(std::make_unique<Label>(Point(1, 1), Size(size.width - 2, size.height - 2), background_colour, L"", 8, _alignment, graphics::ParagraphAlignment::Near, SizeMode::Manual));
+            _text->set_text_colour(text_colour);
+            _token_store += _text->on_measurer_changed += [&]()
+            {
+                _layout.reset_advances();
+                update_text();
+                update_cursor();
+            };
+
+            _cursor = add_child(std::make_unique<Window>(Size(1, Default_Line_Height), text_colour));
             _cursor->set_visible(focused());
             set_handles_input(true);
         }
@@ -40,144 +55,100 @@ namespace trview
                 return false;
             }
 
-            auto process_char = [&]()
+            switch (character)
             {
-                auto line = current_line();
-                auto text = line->text();
-
-                switch (character)
+                // Reserved
+                case 0x7:
+                {
+                    break;
+                }
+                // VK_BACK
+                case 0x8:
                 {
-                    // Reserved
-                    case 0x7:
+                    if (_cursor_position > 0)
                     {
-                        return;
+                        erase(_cursor_position - 1, 1);
                     }
-                    // VK_BACK
-                    case 0x8:
+                    break;
+                }
+                // VK_TAB
+                case 0x9:
+                {
+                    if (_mode == Mode::SingleLine)
                     {
-                        if (!text.empty())
-                        {
-                            if (_cursor_position > 0)
-                            {
-                                text.erase(--_cursor_position, 1);
-                                notify_text_updated();
-                            }
-                        }
-                        else
-                        {
-                            remove_line();
-                            // Move the cursor to the end of the line that we just moved up to,
-                            // as we did just do a backspace.
-                            _cursor_position = current_line()->text().size();
-                            return;
-                        }
-                        break;
+                        on_tab(text());
                     }
-                    // VK_TAB
-                    case 0x9:
+                    break;
+                }
+                // VK_RETURN
+                case 0xD:
+                {
+                    if (_mode == Mode::SingleLine)
                     {
-                        if (_mode == Mode::SingleLine)
-                        {
-                            on_tab(text);
-                        }
-                        break;
+                        on_enter(text());
                     }
-                    // VK_RETURN
-                    case 0xD:
+                    else
                     {
-                        if (_mode == Mode::SingleLine)
-                        {
-                            on_enter(text);
-                        }
-                        else
-                        {
-                            add_line();
-                            ++_cursor_line;
-                        }
-                        return;
+                        insert(L"\n");
                     }
-                    // VK_ESCAPE
-                    case 0x1B:
+                    break;
+                }
+                // VK_ESCAPE
+                case 0x1B:
+                {
+                    on_escape();
+                    break;
+                }
+                default:
+                {
+                    // Check if this is character we don't support.
+                    if (!_text->is_valid_character(character))
                     {
-                        on_escape();
-                        return;
+                        break;
                     }
-                    default:
+
+                    // In single line mode the text can't be wider than the text area. Multiple lines are wrapped instead.
+                    if (_mode == Mode::SingleLine)
                     {
-                        // Check if this is character we don't support.
-                        if (!line->is_valid_character(character))
+                        if (_layout.width_with(_cursor_position, character) > _text->size().width)
                         {
                             break;
                         }
-
-                        // Check if adding the character is going to make the text wider than the text area. If so,
-                        // then create a new line and put the character on that line instead.
-                        if (line->measure_text(text + character).width > _area->size().width)
-                        {
-                            if (_mode == Mode::SingleLine)
-                            {
-                                return;
-                            }
-
-                            add_line({ character });
-                            ++_cursor_line;
-                            return;
-                        }
-
-                        // Add the character to the current line.
-                        text.insert(text.begin() + _cursor_position, character);
-                        ++_cursor_position;
-                        break;
                     }
-                }
 
-                line->set_text(text);
-                notify_text_updated();
-            };
+                    insert(std::wstring(1, character));
+                    break;
+                }
+            }
 
-            process_char();
             update_cursor();
             return true;
         }
 
         void TextArea::set_text(const std::wstring& text)
         {
-            while (!_lines.empty())
-            {
-                remove_line(false);
-            }
-
-            std::wstringstream stream(text);
-            std::wstring line;
-            while (std::getline(stream, line, L'\n'))
-            {
-                add_line(line, false);
-            }
-
-            _cursor_line = _lines.empty() ? 0 : _lines.size() - 1;
-            _cursor_position = _lines.empty() ? 0 : _lines.back()->text().size();
-            update_cursor(false);
+            _layout.set_text(text);
+            _cursor_position = _layout.size();
+            update_text();
+            update_cursor();
         }
 
         void TextArea::set_mode(Mode mode)
         {
             _mode = mode;
+            _layout.set_wrap(mode == Mode::MultiLine);
+            update_text();
+            update_cursor();
         }
 
         std::wstring TextArea::text() const
         {
-            bool first = true;
-            std::wstring full_string;
-            for (const auto& line : _lines)
-            {
-                if (!first)
-                {
-                    full_string += L'\n';
-                }
-                first = false;
-                full_string += line->text();
-            }
-            return full_string;
+            return _layout.text();
+        }
+
+        const TextLayoutEngine& TextArea::layout() const
+        {
+            return _layout;
         }
 
         bool TextArea::mouse_down(const Point&)
@@ -192,21 +163,22 @@ namespace trview
                 return false;
             }
 
-            auto line = current_line();
-            auto text = line->text();
+            const auto line = _layout.line_of(_cursor_position);
+            const auto& current = _layout.lines()[line];
 
             switch (key) 
             {
                 // VK_END
                 case 0x23:
                 {
-                    _cursor_position = text.size();
+                    // The end of a wrapped line is the start of the next line, so stop before the last character.
+                    _cursor_position = _layout.is_wrapped(line) ? current.start + current.length - 1 : current.start + current.length;
                     break;
                 }
                 // VK_HOME
                 case 0x24:
                 {
-                    _cursor_position = 0;
+                    _cursor_position = current.start;
                     break;
                 }
                 // VK_LEFT
@@ -216,53 +188,42 @@ namespace trview
                     {
                         --_cursor_position;
                     }
-                    else if (_cursor_line > 0)
-                    {
-                        --_cursor_line;
-                        _cursor_position = _lines[_cursor_line]->text().size();
-                    }
                     break;
                 }
                 // VK_UP
                 case 0x26:
                 {
-                    if (_cursor_line > 0)
+                    if (line > 0)
                     {
-                        --_cursor_line;
-                        _cursor_position = std::min(static_cast<uint32_t>(_lines[_cursor_line]->text().size()), _cursor_position);
+                        _cursor_position = _layout.position_at(line - 1, _layout.x_of(_cursor_position));
                     }
                     break;
                 }
                 // VK_RIGHT
                 case 0x27:
                 {
-                    if (_cursor_position < text.size())
+                    if (_cursor_position < _layout.size())
                     {
                         ++_cursor_position;
                     }
-                    else if (_cursor_line + 1 < _lines.size())
-                    {
-                        ++_cursor_line;
-                        _cursor_position = 0;
-                    }
                     break;
                 }
                 // VK_DOWN
                 case 0x28:
                 {
-                    if (!_lines.empty())
+                    if (line + 1 < _layout.lines().size())
                     {
-                        _cursor_line = std::min(_cursor_line + 1, static_cast<uint32_t>(_lines.size()) - 1u);
-                        _cursor_position = std::min(static_cast<uint32_t>(_lines[_cursor_line]->text().size()), _cursor_position);
+                        _cursor_position = _layout.position_at(line + 1, _layout.x_of(_cursor_position));
                     }
                     break;
                 }
                 // VK_DELETE
                 case 0x2E:
                 {
-                    text.erase(_cursor_position, 1);
-                    line->set_text(text);
-                    notify_text_updated();
+                    if (_cursor_position < _layout.size())
+                    {
+                        erase(_cursor_position, 1);
+                    }
                     break;
                 }
             }
@@ -270,76 +231,44 @@ namespace trview
             return true;
         }
 
-        Label* TextArea::current_line(bool raise_event)
+        void TextArea::insert(const std::wstring& text)
         {
-            if (_lines.empty())
-            {
-                add_line(std::wstring(), raise_event);
-            }
-            return _lines[_cursor_line];
+            _layout.insert(_cursor_position, text);
+            _cursor_position += text.size();
+            update_text();
+            notify_text_updated();
         }
 
-        void TextArea::add_line(std::wstring text, bool raise_event)
+        void TextArea::erase(std::size_t position, std::size_t count)
         {
-            _lines.push_back(_area->add_child(std::make_unique<Label>(Size(size().width, 14), background_colour(), text, 8, _alignment, graphics::ParagraphAlignment::Near, SizeMode::Manual)));
-            if (raise_event)
-            {
-                notify_text_updated();
-            }
-            _cursor_position = text.size();
-            update_cursor(raise_event);
+            _layout.erase(position, count);
+            _cursor_position = position;
+            update_text();
+            notify_text_updated();
         }
 
-        void TextArea::remove_line(bool raise_event)
+        void TextArea::update_text()
         {
-            if (_lines.empty())
-            {
-                return;
-            }
-
-            _area->remove_child(_lines.back());
-            _lines.pop_back();
-            if (_cursor_line >= _lines.size() && _cursor_line > 0)
-            {
-                --_cursor_line;
-            }
-
-            if (raise_event)
-            {
-                notify_text_updated();
-            }
+            _text->set_text(_layout.display_text());
         }
 
-        void TextArea::remove_line(uint32_t line)
+        void TextArea::update_cursor()
         {
-            if (line >= _lines.size())
-            {
-                return;
-            }
-
-            _area->remove_child(_lines[line]);
-            _lines.erase(_lines.begin() + line);
-            if (_cursor_line >= _lines.size() && _cursor_line > 0)
-            {
-                --_cursor_line;
-            }
-            notify_text_updated();
+            // Place the cursor based on the current cursor position and the size of the text as it would be renderered.
+            const auto line = _layout.line_of(_cursor_position);
+            const float height = line_height();
+            const float start = _alignment == graphics::TextAlignment::Left ? 0 :
+                _text->position().x + _text->size().width * 0.5f - _layout.lines()[line].width * 0.5f - 1;
+            _cursor->set_position(Point(start + _layout.x_of(_cursor_position) + 2, _text->position().y + line * height));
+            _cursor->set_size(Size(1, height));
+            _cursor->set_visible(focused());
         }
 
-        void TextArea::update_cursor(bool raise_event)
+        float TextArea::line_height() const
         {
-            // Get the current line and the text it is rendering.
-            auto line = current_line(raise_event);
-            auto text = line->text();
-
-            // Place the cursor based on the current cursor position and the size of the text as it would be renderered.
-            const auto size = line->measure_text(text.substr(0, _cursor_position));
-            const auto start = _alignment == graphics::TextAlignment::Left ?
-                Point(0, line->position().y) :
-                Point(line->size().width * 0.5f - size.width * 0.5f - 1, line->position().y);
-            _cursor->set_position(start + Point(size.width + 2, 0));
-            _cursor->set_size(Size(1, line->size().height == 0 ? _cursor->size().height : line->size().height));
-            _cursor->set_visible(focused());
+            // Lines are drawn using the line spacing of the font, which is how much taller a line break makes the text.
+            const float spacing = _text->measure_text(L"A\nA").height - _text->measure_text(L"A").height;
+            return spacing > 0 ? spacing : Default_Line_Height;
         }
 
         void TextArea::notify_text_updated()
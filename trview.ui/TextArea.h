@@ -1,6 +1,7 @@
 #pragma once
 
 #include "StackPanel.h"
+#include "TextLayoutEngine.h"
 #include <trview.graphics/TextAlignment.h>
 
 namespace trview
@@ -9,7 +10,7 @@ namespace trview
     {
         class Label;
 
-        /// A text area is a number of lines of text.
+        /// A text area is a number of lines of text. Lines that are too wide are wrapped at the last space.
         class TextArea final : public Window
         {
         public:
@@ -45,6 +46,9 @@ namespace trview
             /// Get the text content of the text area.
             std::wstring text() const;
 
+            /// Get the layout of the text as it is shown.
+            const TextLayoutEngine& layout() const;
+
             /// Event raised when the text in the text area has changed.
             Event<std::wstring> on_text_changed;
 
@@ -63,29 +67,32 @@ namespace trview
             virtual void gained_focus() override;
             virtual void lost_focus(Control*) override;
         private:
-            Label* current_line(bool raise_event = true);
-
-            /// Add a new line to the text area with the specified content.
-            /// @param text The optional content to use.
-            void add_line(std::wstring text = std::wstring(), bool raise_event = true);
+            /// Insert text at the cursor and move the cursor to the end of it.
+            /// @param text The text to insert.
+            void insert(const std::wstring& text);
 
-            void remove_line(bool raise_event = true);
+            /// Remove text and move the cursor to where it was removed.
+            /// @param position The index of the first character to remove.
+            /// @param count The number of characters to remove.
+            void erase(std::size_t position, std::size_t count);
 
-            void remove_line(uint32_t line);
+            /// Update the label to show the lines.
+            void update_text();
 
             /// Move the cursor element to be in the correct place.
-            void update_cursor(bool raise_event = true);
+            void update_cursor();
+
+            /// Get the height of a line of text.
+            float line_height() const;
 
             void notify_text_updated();
 
-            StackPanel*         _area;
-            std::vector<Label*> _lines;
+            Label*              _text;
+            TextLayoutEngine    _layout;
             Colour              _text_colour;
             Window*             _cursor;
-            uint32_t            _cursor_position{ 0u };
-            uint32_t            _cursor_line{ 0u };
+            std::size_t         _cursor_position{ 0u };
             Mode                _mode{ Mode::MultiLine };
-            bool                _focused{ false };
             graphics::TextAlignment _alignment{ graphics::TextAlignment::Left };
         };
     }
@@ -0,0 +1,122 @@
+#define NOMINMAX
+#include "TextBuffer.h"
+#include <algorithm>
+
+namespace trview
+{
+    namespace ui
+    {
+        namespace
+        {
+            const std::size_t Min_Gap = 64;
+        }
+
+        TextBuffer::TextBuffer(const std::wstring& text)
+        {
+            assign(text);
+        }
+
+        void TextBuffer::assign(const std::wstring& text)
+        {
+            _data.assign(text.begin(), text.end());
+            _data.resize(text.size() + Min_Gap);
+            _gap_start = text.size();
+            _gap_end = _data.size();
+        }
+
+        void TextBuffer::insert(std::size_t position, const std::wstring& text)
+        {
+            position = std::min(position, size());
+            move_gap(position);
+            reserve_gap(text.size());
+            std::copy(text.begin(), text.end(), _data.begin() + _gap_start);
+            _gap_start += text.size();
+        }
+
+        std::size_t TextBuffer::erase(std::size_t position, std::size_t count)
+        {
+            if (position >= size())
+            {
+                return 0;
+            }
+
+            count = std::min(count, size() - position);
+            move_gap(position);
+            _gap_end += count;
+            return count;
+        }
+
+        wchar_t TextBuffer::at(std::size_t position) const
+        {
+            return position < _gap_start ? _data[position] : _data[position + (_gap_end - _gap_start)];
+        }
+
+        std::size_t TextBuffer::size() const
+        {
+            return _data.size() - (_gap_end - _gap_start);
+        }
+
+        std::wstring TextBuffer::substr(std::size_t position, std::size_t count) const
+        {
+            std::wstring result;
+            const std::size_t end = std::min(size(), position + count);
+            if (position >= end)
+            {
+                return result;
+            }
+
+            result.reserve(end - position);
+            for (std::size_t i = position; i < std::min(end, _gap_start); ++i)
+            {
+                result += _data[i];
+            }
+            for (std::size_t i = std::max(position, _gap_start); i < end; ++i)
+            {
+                result += _data[i + (_gap_end - _gap_start)];
+            }
+            return result;
+        }
+
+        std::wstring TextBuffer::text() const
+        {
+            return substr(0, size());
+        }
+
+        void TextBuffer::move_gap(std::size_t position)
+        {
+            if (position < _gap_start)
+            {
+                // Move the characters between the position and the gap to after the gap.
+                const std::size_t count = _gap_start - position;
+                std::copy_backward(_data.begin() + position, _data.begin() + _gap_start, _data.begin() + _gap_end);
+                _gap_start -= count;
+                _gap_end -= count;
+            }
+            else if (position > _gap_start)
+            {
+                // Move the characters between the gap and the position to before the gap.
+                const std::size_t count = position - _gap_start;
+                std::copy(_data.begin() + _gap_end, _data.begin() + _gap_end + count, _data.begin() + _gap_start);
+                _gap_start += count;
+                _gap_end += count;
+            }
+        }
+
+        void TextBuffer::reserve_gap(std::size_t count)
+        {
+            if (_gap_end - _gap_start >= count)
+            {
+                return;
+            }
+
+            // Grow geometrically so that typing doesn't reallocate for every character.
+            const std::size_t gap = std::max({ count, Min_Gap, size() / 2 });
+            const std::size_t after = _data.size() - _gap_end;
+            std::vector<wchar_t> data(size() + gap);
+            std::copy(_data.begin(), _data.begin() + _gap_start, data.begin());
+            std::copy(_data.begin() + _gap_end, _data.end(), data.end() - after);
+            _data.swap(data);
+            _gap_end = _data.size() - after;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/// @file TextBuffer.h
+/// @brief Stores text that is edited at a cursor.
+///
+/// The text is kept in a gap buffer: a single array with an unused gap at the place where the
+/// text was last edited. Typing or deleting at the same place only moves the ends of the gap, so
+/// editing a long piece of text doesn't copy the whole text for every character.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace trview
+{
+    namespace ui
+    {
+        /// Stores text that is edited at a cursor.
+        class TextBuffer final
+        {
+        public:
+            /// Create a new text buffer.
+            /// @param text The initial text.
+            explicit TextBuffer(const std::wstring& text = std::wstring());
+
+            /// Replace all of the text.
+            /// @param text The new text.
+            void assign(const std::wstring& text);
+
+            /// Insert text.
+            /// @param position The index to insert the text at.
+            /// @param text The text to insert.
+            void insert(std::size_t position, const std::wstring& text);
+
+            /// Remove text.
+            /// @param position The index of the first character to remove.
+            /// @param count The number of characters to remove. This is limited to the end of the text.
+            /// @returns The number of characters that were removed.
+            std::size_t erase(std::size_t position, std::size_t count);
+
+            /// Get the character at an index.
+            /// @param position The index of the character.
+            wchar_t at(std::size_t position) const;
+
+            /// Get the number of characters.
+            std::size_t size() const;
+
+            /// Get part of the text.
+            /// @param position The index of the first character.
+            /// @param count The maximum number of characters.
+            std::wstring substr(std::size_t position, std::size_t count) const;
+
+            /// Get all of the text.
+            std::wstring text() const;
+        private:
+            void move_gap(std::size_t position);
+            void reserve_gap(std::size_t count);
+
+            std::vector<wchar_t> _data;
+            std::size_t          _gap_start{ 0u };
+            std::size_t          _gap_end{ 0u };
+        };
+    }
+}
@@ -0,0 +1,304 @@
+#define NOMINMAX
+#include "TextLayoutEngine.h"
+#include <algorithm>
+
+namespace trview
+{
+    namespace ui
+    {
+        TextLayoutEngine::TextLayoutEngine(const std::function<float (const std::wstring&)>& measure, float width, bool wrap)
+            : _measure(measure), _width(width), _wrap(wrap)
+        {
+            layout_all();
+        }
+
+        void TextLayoutEngine::set_text(const std::wstring& text)
+        {
+            _buffer.assign(text);
+            layout_all();
+        }
+
+        std::wstring TextLayoutEngine::text() const
+        {
+            return _buffer.text();
+        }
+
+        std::size_t TextLayoutEngine::size() const
+        {
+            return _buffer.size();
+        }
+
+        void TextLayoutEngine::insert(std::size_t position, const std::wstring& text)
+        {
+            position = std::min(position, _buffer.size());
+            _buffer.insert(position, text);
+            reflow(position, 0, text.size());
+        }
+
+        void TextLayoutEngine::erase(std::size_t position, std::size_t count)
+        {
+            const std::size_t removed = _buffer.erase(position, count);
+            if (removed)
+            {
+                reflow(position, removed, 0);
+            }
+        }
+
+        void TextLayoutEngine::set_width(float width)
+        {
+            if (_width != width)
+            {
+                _width = width;
+                layout_all();
+            }
+        }
+
+        void TextLayoutEngine::set_wrap(bool wrap)
+        {
+            if (_wrap != wrap)
+            {
+                _wrap = wrap;
+                layout_all();
+            }
+        }
+
+        void TextLayoutEngine::reset_advances()
+        {
+            _advances.clear();
+            layout_all();
+        }
+
+        float TextLayoutEngine::advance(wchar_t previous, wchar_t character) const
+        {
+            const uint32_t key = (static_cast<uint32_t>(static_cast<uint16_t>(previous)) << 16) | static_cast<uint16_t>(character);
+            auto found = _advances.find(key);
+            if (found == _advances.end())
+            {
+                // Measuring the pair includes the space that the font leaves after the previous character and any
+                // kerning between them, which measuring the character on its own would leave out.
+                float width = 0.0f;
+                if (_measure)
+                {
+                    width = previous ? _measure({ previous, character }) - _measure(std::wstring(1, previous)) : _measure(std::wstring(1, character));
+                }
+                found = _advances.insert({ key, width }).first;
+            }
+            return found->second;
+        }
+
+        float TextLayoutEngine::width_with(std::size_t position, wchar_t character) const
+        {
+            const auto& line = _lines[line_of(position)];
+            position = std::min(position, line.start + line.length);
+            const wchar_t previous = position > line.start ? _buffer.at(position - 1) : 0;
+            float width = line.width + advance(previous, character);
+            if (position < line.start + line.length)
+            {
+                const wchar_t next = _buffer.at(position);
+                width += advance(character, next) - advance(previous, next);
+            }
+            return width;
+        }
+
+        const std::vector<TextLayoutEngine::Line>& TextLayoutEngine::lines() const
+        {
+            return _lines;
+        }
+
+        std::wstring TextLayoutEngine::line_text(std::size_t line) const
+        {
+            if (line >= _lines.size())
+            {
+                return std::wstring();
+            }
+            return _buffer.substr(_lines[line].start, _lines[line].length);
+        }
+
+        std::wstring TextLayoutEngine::display_text() const
+        {
+            std::wstring result;
+            result.reserve(_buffer.size() + _lines.size());
+            for (std::size_t i = 0; i < _lines.size(); ++i)
+            {
+                if (i)
+                {
+                    result += L'\n';
+                }
+                result += line_text(i);
+            }
+            return result;
+        }
+
+        std::size_t TextLayoutEngine::line_of(std::size_t position) const
+        {
+            auto line = std::upper_bound(_lines.begin(), _lines.end(), position, [](std::size_t value, const Line& l) { return value < l.start; });
+            return line == _lines.begin() ? 0 : static_cast<std::size_t>(line - _lines.begin()) - 1;
+        }
+
+        float TextLayoutEngine::x_of(std::size_t position) const
+        {
+            const auto& line = _lines[line_of(position)];
+            const std::size_t end = std::min(position, line.start + line.length);
+            float x = 0;
+            wchar_t previous = 0;
+            for (std::size_t i = line.start; i < end; ++i)
+            {
+                const wchar_t character = _buffer.at(i);
+                x += advance(previous, character);
+                previous = character;
+            }
+            return x;
+        }
+
+        std::size_t TextLayoutEngine::position_at(std::size_t line, float x) const
+        {
+            line = std::min(line, _lines.size() - 1);
+            const auto& l = _lines[line];
+            float left = 0;
+            wchar_t previous = 0;
+            for (std::size_t i = 0; i < l.length; ++i)
+            {
+                const wchar_t character = _buffer.at(l.start + i);
+                const float width = advance(previous, character);
+                previous = character;
+                if (x < left + width * 0.5f)
+                {
+                    return l.start + i;
+                }
+                left += width;
+            }
+
+            // The end of a wrapped line is the start of the next line, so stop before the last character.
+            return is_wrapped(line) ? l.start + l.length - 1 : l.start + l.length;
+        }
+
+        bool TextLayoutEngine::is_wrapped(std::size_t line) const
+        {
+            return line + 1 < _lines.size() && _lines[line + 1].start == _lines[line].start + _lines[line].length;
+        }
+
+        uint32_t TextLayoutEngine::lines_laid_out() const
+        {
+            return _lines_laid_out;
+        }
+
+        TextLayoutEngine::Line TextLayoutEngine::layout_line(std::size_t start, std::size_t& next) const
+        {
+            const std::size_t size = _buffer.size();
+            float width = 0;
+            std::size_t break_at = 0;
+            float break_width = 0;
+            wchar_t previous = 0;
+
+            for (std::size_t i = start; i < size; ++i)
+            {
+                const wchar_t character = _buffer.at(i);
+                if (character == L'\n')
+                {
+                    next = i + 1;
+                    return { start, i - start, width };
+                }
+
+                // Spaces are allowed to go past the edge so that the next line starts with a word.
+                const float character_width = advance(previous, character);
+                if (_wrap && i > start && character != L' ' && width + character_width > _width)
+                {
+                    if (break_at)
+                    {
+                        next = break_at;
+                        return { start, break_at - start, break_width };
+                    }
+                    next = i;
+                    return { start, i - start, width };
+                }
+
+                width += character_width;
+                previous = character;
+                if (character == L' ')
+                {
+                    break_at = i + 1;
+                    break_width = width;
+                }
+            }
+
+            next = size;
+            return { start, size - start, width };
+        }
+
+        void TextLayoutEngine::reflow(std::size_t position, std::size_t removed, std::size_t inserted)
+        {
+            // Start from the line before the edit if it was wrapped, as removing characters may let the
+            // first word of the edited line fit on the end of it.
+            std::size_t first = line_of(position);
+            if (first > 0 && is_wrapped(first - 1))
+            {
+                --first;
+            }
+
+            const std::vector<Line> old_lines(_lines.begin() + first, _lines.end());
+            _lines.erase(_lines.begin() + first, _lines.end());
+            _lines_laid_out = 0;
+
+            const std::size_t old_edit_end = position + removed;
+            const std::size_t new_edit_end = position + inserted;
+            auto old = old_lines.begin();
+            std::size_t start = old_lines.front().start;
+            while (true)
+            {
+                std::size_t next = 0;
+                _lines.push_back(layout_line(start, next));
+                ++_lines_laid_out;
+
+                // A line that ends without a line break is the last line.
+                const bool line_break = next > _lines.back().start + _lines.back().length;
+                if (!line_break && next >= _buffer.size())
+                {
+                    return;
+                }
+                start = next;
+
+                if (start < new_edit_end)
+                {
+                    continue;
+                }
+
+                // Once a line starts at the same text as an old line after the edit, the rest of the lines
+                // are the same as before and only need to be moved.
+                while (old != old_lines.end() && (old->start < old_edit_end || old->start - removed + inserted < start))
+                {
+                    ++old;
+                }
+
+                if (old != old_lines.end() && old->start - removed + inserted == start)
+                {
+                    for (; old != old_lines.end(); ++old)
+                    {
+                        _lines.push_back({ old->start - removed + inserted, old->length, old->width });
+                    }
+                    return;
+                }
+            }
+        }
+
+        void TextLayoutEngine::layout_all()
+        {
+            _lines.clear();
+            _lines_laid_out = 0;
+
+            std::size_t start = 0;
+            while (true)
+            {
+                std::size_t next = 0;
+                _lines.push_back(layout_line(start, next));
+                ++_lines_laid_out;
+
+                const bool line_break = next > _lines.back().start + _lines.back().length;
+                if (!line_break && next >= _buffer.size())
+                {
+                    return;
+                }
+                start = next;
+            }
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/// @file TextLayoutEngine.h
+/// @brief Wraps editable text into lines that fit in a width.
+///
+/// The text is kept in a gap buffer. How far each character moves the end of a line is measured
+/// from the width of the character with the one before it, so the spacing and kerning that the font
+/// puts between glyphs is included, and this is measured once for each pair of characters and then
+/// cached. When the text is edited, lines are laid out again from the line before the edit until
+/// a new line starts at the same place in the text as one of the old lines, after which the rest
+/// of the old lines are moved along instead of being laid out again.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "TextBuffer.h"
+
+namespace trview
+{
+    namespace ui
+    {
+        /// Wraps editable text into lines that fit in a width.
+        class TextLayoutEngine final
+        {
+        public:
+            /// A line of text as it is shown.
+            struct Line
+            {
+                /// The index of the first character of the line.
+                std::size_t start;
+                /// The number of characters in the line, not including a line break.
+                std::size_t length;
+                /// The width of the line.
+                float       width;
+            };
+
+            /// Create a new layout engine.
+            /// @param measure Function that measures the width of some text as the font would draw it.
+            /// @param width The width that lines have to fit in.
+            /// @param wrap Whether lines that are too wide are wrapped. If this is false only line breaks start new lines.
+            TextLayoutEngine(const std::function<float (const std::wstring&)>& measure, float width, bool wrap = true);
+
+            /// Replace all of the text and lay it out.
+            /// @param text The new text.
+            void set_text(const std::wstring& text);
+
+            /// Get all of the text.
+            std::wstring text() const;
+
+            /// Get the number of characters in the text.
+            std::size_t size() const;
+
+            /// Insert text and lay out the lines that it affects.
+            /// @param position The index to insert the text at.
+            /// @param text The text to insert.
+            void insert(std::size_t position, const std::wstring& text);
+
+            /// Remove text and lay out the lines that it affects.
+            /// @param position The index of the first character to remove.
+            /// @param count The number of characters to remove.
+            void erase(std::size_t position, std::size_t count);
+
+            /// Set the width that lines have to fit in. All of the text is laid out again.
+            /// @param width The new width.
+            void set_width(float width);
+
+            /// Set whether lines that are too wide are wrapped. All of the text is laid out again.
+            /// @param wrap Whether to wrap lines.
+            void set_wrap(bool wrap);
+
+            /// Forget the cached character widths and lay out all of the text again, for when the font has changed.
+            void reset_advances();
+
+            /// Get how much wider a line gets when a character is added to the end of it.
+            /// @param previous The last character of the line, or 0 if the line is empty.
+            /// @param character The character to add.
+            float advance(wchar_t previous, wchar_t character) const;
+
+            /// Get the width that the line containing a position would have if a character was inserted at the position.
+            /// @param position The index in the text.
+            /// @param character The character to insert.
+            float width_with(std::size_t position, wchar_t character) const;
+
+            /// Get the lines. There is always at least one line.
+            const std::vector<Line>& lines() const;
+
+            /// Get the text of a line, without the line break.
+            /// @param line The line index.
+            std::wstring line_text(std::size_t line) const;
+
+            /// Get all of the lines joined with line breaks, as they should be drawn.
+            std::wstring display_text() const;
+
+            /// Get the line that a position is on. A position at the place where a line was wrapped is on the later line.
+            /// @param position The index in the text.
+            std::size_t line_of(std::size_t position) const;
+
+            /// Get the distance from the start of its line to a position.
+            /// @param position The index in the text.
+            float x_of(std::size_t position) const;
+
+            /// Get the position on a line that is closest to a distance from the start of the line.
+            /// @param line The line index.
+            /// @param x The distance from the start of the line.
+            std::size_t position_at(std::size_t line, float x) const;
+
+            /// Get whether a line ends because it was wrapped rather than at a line break or the end of the text.
+            /// @param line The line index.
+            bool is_wrapped(std::size_t line) const;
+
+            /// Get the number of lines that were laid out by the last change.
+            uint32_t lines_laid_out() const;
+        private:
+            /// Lay out the line that starts at a position.
+            /// @param start The index of the first character.
+            /// @param next Set to the index of the first character of the next line.
+            /// @returns The line.
+            Line layout_line(std::size_t start, std::size_t& next) const;
+
+            /// Lay out the lines after an edit.
+            /// @param position The index where the edit was made.
+            /// @param removed The number of characters that were removed.
+            /// @param inserted The number of characters that were inserted.
+            void reflow(std::size_t position, std::size_t removed, std::size_t inserted);
+
+            void layout_all();
+
+            std::function<float (const std::wstring&)> _measure;
+            /// Advances for each pair of characters, with the previous character in the high bits.
+            mutable std::unordered_map<uint32_t, float> _advances;
+            TextBuffer        _buffer;
+            std::vector<Line> _lines;
+            float             _width;
+            bool              _wrap;
+            uint32_t          _lines_laid_out{ 0u };
+        };
+    }
+}
@@ -48,6 +48,25 @@ namespace trview
             storage.add("level_vertex_shader", std::make_unique<graphics::VertexShader>(device, get_shader_resource(IDR_LEVEL_VERTEX_SHADER), input_desc));
             storage.add("level_pixel_shader", std::make_unique<graphics::PixelShader>(device, get_shader_resource(IDR_LEVEL_PIXEL_SHADER)));
             storage.add("selection_pixel_shader", std::make_unique<graphics::PixelShader>(device, get_shader_resource(IDR_SELECTION_SHADER)));
+
+            // The overlay shader takes the same vertices as the level shader in the first slot and the world
+            // transform, colour and light direction of each instance in the second slot.
+            std::vector<D3D11_INPUT_ELEMENT_DESC> overlay_input_desc(input_desc);
+            overlay_input_desc.resize(input_desc.size() + 6);
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                auto& element = overlay_input_desc[input_desc.size() + i];
+                memset(&element, 0, sizeof(element));
+                element.SemanticName = "Texcoord";
+                element.SemanticIndex = 2 + i;
+                element.InputSlot = 1;
+                element.InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+                element.InstanceDataStepRate = 1;
+                element.AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT;
+                element.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+            }
+
+            storage.add("overlay_vertex_shader", std::make_unique<graphics::VertexShader>(device, get_shader_resource(IDR_OVERLAY_VERTEX_SHADER), overlay_input_desc));
         }
 
         void load_ui_shaders(const graphics::Device& device, graphics::IShaderStorage& storage)
@@ -65,6 +84,25 @@ namespace trview
 
             storage.add("ui_vertex_shader", std::make_unique<graphics::VertexShader>(device, get_shader_resource(IDR_UI_VERTEX_SHADER), input_desc));
             storage.add("ui_pixel_shader", std::make_unique<graphics::PixelShader>(device, get_shader_resource(IDR_UI_PIXEL_SHADER)));
+
+            std::vector<D3D11_INPUT_ELEMENT_DESC> batch_input_desc(3);
+            memset(&batch_input_desc[0], 0, sizeof(D3D11_INPUT_ELEMENT_DESC) * batch_input_desc.size());
+            batch_input_desc[0].SemanticName = "Position";
+            batch_input_desc[0].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+            batch_input_desc[0].Format = DXGI_FORMAT_R32G32B32_FLOAT;
+
+            batch_input_desc[1].SemanticName = "Texcoord";
+            batch_input_desc[1].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+            batch_input_desc[1].AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT;
+            batch_input_desc[1].Format = DXGI_FORMAT_R32G32_FLOAT;
+
+            batch_input_desc[2].SemanticName = "Texcoord";
+            batch_input_desc[2].SemanticIndex = 1;
+            batch_input_desc[2].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+            batch_input_desc[2].AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT;
+            batch_input_desc[2].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+
+            storage.add("ui_batch_vertex_shader", std::make_unique<graphics::VertexShader>(device, get_shader_resource(IDR_UI_BATCH_VERTEX_SHADER), batch_input_desc));
         }
     }
 
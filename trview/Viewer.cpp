@@ -6,16 +6,20 @@
 #include <sstream>
 #include <iomanip>
 #include <directxmath.h>
+#include <commdlg.h>
 
 #include <trlevel/trlevel.h>
+#include <trlevel/FloorData.h>
 #include <trview.graphics/ShaderStorage.h>
 #include <trview.graphics/FontFactory.h>
 #include <trview.graphics/DeviceWindow.h>
 
 #include <trview.graphics/RenderTargetStore.h>
+#include <trview.graphics/RenderTargetPool.h>
 #include <trview.graphics/Sprite.h>
 #include <trview.graphics/ViewportStore.h>
 #include <trview.input/WindowTester.h>
+#include <trview.common/Strings.h>
 
 #include "DefaultTextures.h"
 #include "DefaultShaders.h"
@@ -35,13 +39,14 @@ namespace trview
 
     Viewer::Viewer(const Window& window)
         : _window(window), _camera(window.size()), _free_camera(window.size()),
-        _timer(default_time_source()), _keyboard(window), _mouse(window, std::make_unique<input::WindowTester>(window)), _level_switcher(window),
+        _timer(default_time_source()), _profiler(precise_time_source()), _frame_scheduler(precise_time_source()), _keyboard(window), _mouse(window, std::make_unique<input::WindowTester>(window)), _level_switcher(window),
         _window_resizer(window), _recent_files(window), _file_dropper(window), _alternate_group_toggler(window),
         _view_menu(window), _update_checker(window), _menu_detector(window)
     {
         _update_checker.check_for_updates();
 
         _settings = load_user_settings();
+        _frame_scheduler.set_frame_cap(_settings.max_frame_rate);
 
         Resource type_list = get_resource_memory(IDR_TYPE_NAMES, L"TEXT");
         _type_name_lookup = std::make_unique<TypeNameLookup>(std::string(type_list.data, type_list.data + type_list.size));
@@ -57,6 +62,7 @@ namespace trview
         load_default_fonts(_device, _font_factory);
 
         _main_window = _device.create_for_window(window);
+        _gpu_timer = std::make_unique<graphics::GpuTimer>(_device);
         _items_windows = std::make_unique<ItemsWindowManager>(_device, *_shader_storage.get(), _font_factory, window);
         if (_settings.items_startup)
         {
@@ -92,6 +98,8 @@ namespace trview
         {
             _main_window->resize();
             resize_elements();
+            // Free render targets were sized for the old window and are unlikely to be used again.
+            _device.render_target_pool().clear();
         };
 
         _token_store += _recent_files.on_file_open += [=](const auto& file) { open(file); };
@@ -126,6 +134,7 @@ namespace trview
         _token_store += _ui->on_highlight += [&](bool) { toggle_highlight(); };
         _token_store += _ui->on_show_hidden_geometry += [&](bool value) { set_show_hidden_geometry(value); };
         _token_store += _ui->on_show_water += [&](bool value) { set_show_water(value); };
+        _token_store += _ui->on_animate += [&](bool value) { if (_level) { _level->set_animate(value); } };
         _token_store += _ui->on_show_triggers += [&](bool value) { set_show_triggers(value); };
         _token_store += _ui->on_flip += [&](bool value) { set_alternate_mode(value); };
         _token_store += _ui->on_alternate_group += [&](uint32_t group, bool value) { set_alternate_group(group, value); };
@@ -176,7 +185,8 @@ namespace trview
         _ui->set_camera_sensitivity(_settings.camera_sensitivity);
         _ui->set_camera_movement_speed(_settings.camera_movement_speed == 0 ? _CAMERA_MOVEMENT_SPEED_DEFAULT : _settings.camera_movement_speed);
 
-        _measure = std::make_unique<Measure>(_device);
+        _overlay_renderer = std::make_unique<OverlayRenderer>(_device, *_shader_storage);
+        _measure = std::make_unique<Measure>();
         _compass = std::make_unique<Compass>(_device, *_shader_storage);
         _route = std::make_unique<Route>(_device, *_shader_storage);
 
@@ -223,7 +233,8 @@ namespace trview
         _token_store += _view_menu.on_show_route += [&](bool show) { _show_route = show; _scene_changed = true; };
         _token_store += _view_menu.on_show_tools += [&](bool show) { _measure->set_visible(show); _scene_changed = true; };
 
-        _picking = std::make_unique<Picking>();
+        // The background pick posts a message when it has finished, so that the message loop wakes up to raise it.
+        _picking = std::make_unique<Picking>([window = _window.window()]() { PostMessage(window, WM_NULL, 0, 0); });
         _token_store += _picking->pick_sources += [&](PickInfo, PickResult& result) { result.stop = !should_pick(); };
         _token_store += _picking->pick_sources += [&](PickInfo info, PickResult& result)
         {
@@ -251,21 +262,24 @@ namespace trview
         };
         _token_store += _picking->pick_sources += [&](PickInfo info, PickResult& result)
         {
-            if (result.stop || !_level)
+            if (result.stop)
             {
                 return;
             }
-            result = nearest_result(result, _level->pick(current_camera(), info.position, info.direction));
+            result = nearest_result(result, _route->pick(info.position, info.direction));
         };
-        _token_store += _picking->pick_sources += [&](PickInfo info, PickResult& result)
+        // Picking against the level is the expensive part so it happens on the picking thread. The level
+        // is only replaced after cancelling any pick in progress.
+        _token_store += _picking->background_pick_sources += [&](PickInfo info, PickResult& result)
         {
-            if (result.stop)
+            if (!_level)
             {
                 return;
             }
-            result = nearest_result(result, _route->pick(info.position, info.direction));
+            result = nearest_result(_level->pick(info.frustum, info.projection_mode, info.position, info.direction), result);
         };
-        _token_store += _picking->pick_sources += [&](PickInfo, PickResult& result)
+
+        _token_store += _picking->on_pick += [&](const PickInfo& pickInfo, PickResult result)
         {
             if (_active_tool == Tool::Measure && result.hit && !result.stop)
             {
@@ -280,10 +294,7 @@ namespace trview
                     result.text = L"|....|";
                 }
             }
-        };
 
-        _token_store += _picking->on_pick += [&](const PickInfo& pickInfo, const PickResult& result)
-        {
             _current_pick = result;
 
             _ui->set_pick(pickInfo, result);
@@ -383,6 +394,12 @@ namespace trview
                     }
                     break;
                 }
+                case 'L':
+                {
+                    _ui->toggle_level_map();
+                    _ui_changed = true;
+                    break;
+                }
                 case VK_LEFT:
                 {
                     if (_route->selected_waypoint() > 0)
@@ -458,6 +475,13 @@ namespace trview
                         }
                     }
                 }
+                else if (_ui->is_cursor_over_level_map())
+                {
+                    if (auto room = _ui->current_level_map_room())
+                    {
+                        select_room(room.value());
+                    }
+                }
                 else if (std::shared_ptr<Sector> sector = _ui->current_minimap_sector())
                 {
                     // Select the trigger (if it is a trigger).
@@ -533,6 +557,19 @@ namespace trview
             case VK_F1:
                 _ui->toggle_settings_visibility();
                 break;
+            case VK_F2:
+            {
+                if (control)
+                {
+                    export_profile();
+                }
+                else
+                {
+                    _ui->toggle_profiler_visibility();
+                    _ui_changed = true;
+                }
+                break;
+            }
             case 'H':
                 toggle_highlight();
                 break;
@@ -588,12 +625,25 @@ namespace trview
             return;
         }
 
+        std::unique_ptr<Level> level;
+        try
+        {
+            level = std::make_unique<Level>(_device, *_shader_storage.get(), std::move(new_level), *_type_name_lookup, _tile_cache);
+        }
+        catch (const trlevel::FloorDataException&)
+        {
+            MessageBox(_window.window(), L"Error parsing floor data", L"Error", MB_OK);
+            return;
+        }
+
         on_file_loaded(filename);
         _settings.add_recent_file(filename);
         on_recent_files_changed(_settings.recent_files);
         save_user_settings(_settings);
 
-        _level = std::make_unique<Level>(_device, *_shader_storage.get(), std::move(new_level), *_type_name_lookup);
+        // The background picking thread uses the level, so make sure it has finished with the old one.
+        _picking->cancel();
+        _level = std::move(level);
         _token_store += _level->on_room_selected += [&](uint16_t room) { select_room(room); };
         _token_store += _level->on_alternate_mode_selected += [&](bool enabled) { set_alternate_mode(enabled); };
         _token_store += _level->on_alternate_group_selected += [&](uint16_t group, bool enabled) { set_alternate_group(group, enabled); };
@@ -605,10 +655,12 @@ namespace trview
         _triggers_windows->set_triggers(_level->triggers());
         _route_window_manager->set_items(_level->items());
         _route_window_manager->set_triggers(_level->triggers());
+        _route_window_manager->set_pathfinder(&_level->pathfinder());
 
         _level->set_show_triggers(_ui->show_triggers());
         _level->set_show_hidden_geometry(_ui->show_hidden_geometry());
         _level->set_show_water(_ui->show_water());
+        _level->set_animate(_ui->animate());
 
         // Set up the views.
         auto rooms = _level->room_info();
@@ -622,6 +674,14 @@ namespace trview
         _ui->set_flip(false);
         _ui->set_flip_enabled(_level->any_alternates());
 
+        std::vector<Room*> level_rooms;
+        for (uint32_t i = 0; i < _level->number_of_rooms(); ++i)
+        {
+            level_rooms.push_back(_level->room(i));
+        }
+        _ui->set_level_rooms(level_rooms);
+        update_level_map();
+
         Item lara;
         if (_settings.go_to_lara && find_item_by_type_id(*_level, 0u, lara))
         {
@@ -649,30 +709,59 @@ namespace trview
 
     void Viewer::render()
     {
-        // If minimised, don't render like crazy. Sleep so we don't hammer the CPU either.
+        // If minimised, there is nothing to render until the window is restored.
         if (window_is_minimised(_window))
         {
-            Sleep(1);
+            _frame_scheduler.begin_frame(false);
             return;
         }
 
-        _timer.update();
+        // The time spent waiting for input isn't time that the camera should have been moving for.
+        if (_frame_scheduler.idle())
+        {
+            _timer.reset();
+        }
+        else
+        {
+            _timer.update();
+        }
+
+        // Moving the camera and animating invalidate the scene, so these have to happen before checking whether anything has changed.
         update_camera();
+        if (_level)
+        {
+            _level->update(_timer.elapsed());
+        }
+        _level_switcher.update();
+        if (!_frame_scheduler.begin_frame(needs_render()))
+        {
+            return;
+        }
+
+        _profiler.begin_frame();
 
-        if (_mouse_changed || _scene_changed)
         {
-            _picking->pick(_window, current_camera());
-            _mouse_changed = false;
+            ProfileScope scope(_profiler, "pick");
+            if (_mouse_changed || _scene_changed)
+            {
+                _picking->pick(_window, current_camera());
+                _mouse_changed = false;
+            }
+
+            // Raise the result of the latest background pick, if it has finished.
+            _picking->update();
         }
 
         if (_scene_changed || _ui_changed)
         {
             _device.begin();
+            _gpu_timer->begin(_device.context(), _profiler.frame_number());
             _main_window->begin();
             _main_window->clear(DirectX::SimpleMath::Color(0.0f, 0.2f, 0.4f, 1.0f));
 
             if (_scene_changed)
             {
+                ProfileScope scope(_profiler, "scene");
                 _scene_target->clear(_device.context(), Colour::Transparent);
 
                 graphics::RenderTargetStore rs_store(_device.context());
@@ -683,18 +772,85 @@ namespace trview
                 _scene_changed = false;
             }
 
-            _scene_sprite->render(_device.context(), _scene_target->texture(), 0, 0, _window.size().width, _window.size().height);
-            _ui->set_camera_position(current_camera().position());
+            {
+                ProfileScope scope(_profiler, "ui");
+                _scene_sprite->render(_device.context(), _scene_target->texture(), 0, 0, _window.size().width, _window.size().height);
+                _ui->set_camera_position(current_camera().position());
 
-            _ui->render(_device);
-            _ui_changed = false;
+                _ui->render(_device);
+                _ui_changed = false;
+            }
 
+            ProfileScope scope(_profiler, "present");
             _main_window->present(_settings.vsync);
         }
 
-        _items_windows->render(_device, _settings.vsync);
-        _triggers_windows->render(_device, _settings.vsync);
-        _route_window_manager->render(_device, _settings.vsync);
+        {
+            ProfileScope scope(_profiler, "windows");
+            _items_windows->render(_device, _settings.vsync);
+            _triggers_windows->render(_device, _settings.vsync);
+            _route_window_manager->render(_device, _settings.vsync);
+        }
+
+        _profiler.end_frame();
+        _gpu_timer->end(_device.context(), [&](uint64_t frame, float duration)
+        {
+            _profiler.set_gpu_duration(frame, duration);
+        });
+
+        // Keep rendering while the overlay is open so that the timings stay current.
+        if (_ui->profiler_visible())
+        {
+            _ui->set_profile(_profiler, _frame_scheduler.statistics());
+            _ui_changed = true;
+        }
+
+        // Keep rendering until the level map has drawn all of the tiles that are in view.
+        if (_ui->level_map_needs_update())
+        {
+            _ui_changed = true;
+        }
+    }
+
+    uint32_t Viewer::wait_time() const
+    {
+        return _frame_scheduler.wait_time();
+    }
+
+    bool Viewer::needs_render() const
+    {
+        // Held movement keys don't send any more messages, so keep rendering while the free camera is moving.
+        const bool camera_moving = (_camera_mode == CameraMode::Free || _camera_mode == CameraMode::Axis) && _camera_input.movement().LengthSquared() > 0;
+        return _scene_changed || _ui_changed || _mouse_changed || camera_moving || _picking->ready() ||
+            _items_windows->needs_render() || _triggers_windows->needs_render() || _route_window_manager->needs_render();
+    }
+
+    void Viewer::export_profile()
+    {
+        OPENFILENAME ofn;
+        memset(&ofn, 0, sizeof(ofn));
+
+        wchar_t path[MAX_PATH];
+        memset(&path, 0, sizeof(path));
+
+        ofn.lStructSize = sizeof(ofn);
+        ofn.hwndOwner = _window.window();
+        ofn.lpstrFilter = L"CSV file\0*.csv\0Chrome trace\0*.json\0";
+        ofn.nMaxFile = MAX_PATH;
+        ofn.lpstrTitle = L"Export frame timings";
+        ofn.lpstrFile = path;
+        ofn.lpstrDefExt = L"csv";
+        if (!GetSaveFileName(&ofn))
+        {
+            return;
+        }
+
+        const std::string filename = trview::to_utf8(ofn.lpstrFile);
+        const bool is_trace = ofn.nFilterIndex == 2 || (filename.size() >= 5 && filename.substr(filename.size() - 5) == ".json");
+        if (!(is_trace ? _profiler.write_trace(filename) : _profiler.write_csv(filename)))
+        {
+            MessageBox(_window.window(), L"Failed to export frame timings", L"Error", MB_OK);
+        }
     }
 
     bool Viewer::should_pick() const
@@ -712,16 +868,28 @@ namespace trview
                 _camera.set_target(_target);
             }
             _level->render(_device, current_camera(), _show_selection);
-            _sector_highlight.render(_device, current_camera(), _level->texture_storage());
 
-            _measure->render(_device.context(), current_camera(), _level->texture_storage());
+            // The sector highlight, measure and route are collected and drawn together.
+            _overlays.clear();
+            _sector_highlight.render(_overlays);
+            _measure->render(current_camera(), _overlays);
+
+            if (_show_route)
+            {
+                _route->render(current_camera(), _overlays);
+            }
+
+            _overlay_renderer->render(_device, current_camera(), _level->texture_storage(), _overlays);
 
             if (_show_route)
             {
-                _route->render(_device, current_camera(), _level->texture_storage());
+                _route->render_selection(_device, current_camera(), _level->texture_storage());
             }
 
-            _level->render_transparency(_device, current_camera());
+            {
+                ProfileScope scope(_profiler, "transparency");
+                _level->render_transparency(_device, current_camera());
+            }
             _compass->render(_device, current_camera(), _level->texture_storage());
         }
     }
@@ -862,6 +1030,7 @@ namespace trview
             _was_alternate_select = true;
             _level->set_alternate_mode(enabled);
             _ui->set_flip(enabled);
+            update_level_map();
         }
     }
 
@@ -872,6 +1041,16 @@ namespace trview
             _was_alternate_select = true;
             _level->set_alternate_group(group, enabled);
             _ui->set_alternate_group(group, enabled);
+            update_level_map();
+        }
+    }
+
+    void Viewer::update_level_map()
+    {
+        // Only the rooms that belong to the current flip state are shown on the level map.
+        for (uint32_t i = 0; i < _level->number_of_rooms(); ++i)
+        {
+            _ui->set_level_room_visible(i, !_level->is_alternate_mismatch(*_level->room(i)));
         }
     }
 
@@ -906,7 +1085,7 @@ namespace trview
         _token_store += _mouse.mouse_move += [&](long x, long y) { _mouse_changed = true; _camera_input.mouse_move(x, y); };
         _token_store += _mouse.mouse_wheel += [&](int16_t scroll) 
         {
-            if (window_under_cursor() == _window)
+            if (window_under_cursor() == _window && !_ui->is_cursor_over_level_map())
             {
                 _ui->set_show_context_menu(false);
                 _camera_input.mouse_scroll(scroll);
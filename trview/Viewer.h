@@ -10,9 +10,12 @@
 #include <memory>
 #include <string>
 
+#include <trview.common/FrameScheduler.h>
+#include <trview.common/Profiler.h>
 #include <trview.common/Timer.h>
 #include <trview.common/Window.h>
 #include <trview.graphics/Device.h>
+#include <trview.graphics/GpuTimer.h>
 #include <trview.input/Keyboard.h>
 #include <trview.input/Mouse.h>
 #include <trview.common/TokenStore.h>
@@ -36,7 +39,10 @@
 #include <trview.app/Windows/RouteWindowManager.h>
 #include <trview.app/Menus/ViewMenu.h>
 #include <trview.app/Geometry/Picking.h>
+#include <trview.app/Graphics/OverlayInstanceList.h>
+#include <trview.app/Graphics/OverlayRenderer.h>
 #include <trview.app/Graphics/SectorHighlight.h>
+#include <trview.app/Graphics/CompressedTileCache.h>
 #include <trview.app/UI/ViewerUI.h>
 #include <trview.app/Menus/UpdateChecker.h>
 #include <trview.app/Elements/ITypeNameLookup.h>
@@ -64,9 +70,13 @@ namespace trview
         /// Destructor for the viewer.
         ~Viewer();
 
-        /// Render the viewer.
+        /// Render the viewer. Nothing is rendered if nothing has changed or if the frame cap has been reached.
         void render();
 
+        /// Get how long the message loop can wait for input before render should be called again.
+        /// @returns The time in milliseconds, or INFINITE if nothing will change until there is input.
+        uint32_t wait_time() const;
+
         /// Attempt to open the specified level file.
         /// @param filename The level file to open.
         void open(const std::string& filename);
@@ -88,6 +98,7 @@ namespace trview
         void toggle_highlight();
         void update_camera();
         void render_scene();
+        bool needs_render() const;
         void select_room(uint32_t room, bool force_orbit = false);
         void select_item(const Item& item);
         void select_trigger(const Trigger* const trigger);
@@ -101,6 +112,8 @@ namespace trview
         void set_alternate_mode(bool enabled);
         void set_alternate_group(uint32_t group, bool enabled);
         bool alternate_group(uint32_t group) const;
+        // Show only the rooms that match the current flip state on the level map.
+        void update_level_map();
         // Tell things that need to be resized that they should resize.
         void resize_elements();
         // Set up keyboard and mouse input for the camera.
@@ -109,6 +122,8 @@ namespace trview
         void set_show_hidden_geometry(bool show);
         void set_show_water(bool show);
         uint32_t room_from_pick(const PickResult& pick) const;
+        /// Prompt the user for a filename and export the recorded frame timings to it.
+        void export_profile();
 
         graphics::Device _device;
         std::unique_ptr<graphics::DeviceWindow> _main_window;
@@ -117,6 +132,9 @@ namespace trview
         std::unique_ptr<Level> _level;
         Window _window;
         Timer _timer;
+        Profiler _profiler;
+        FrameScheduler _frame_scheduler;
+        std::unique_ptr<graphics::GpuTimer> _gpu_timer;
         OrbitCamera _camera;
         FreeCamera _free_camera;
         input::Keyboard _keyboard;
@@ -140,6 +158,8 @@ namespace trview
         ViewMenu _view_menu;
         bool _show_selection{ true };
         SectorHighlight _sector_highlight;
+        std::unique_ptr<OverlayRenderer> _overlay_renderer;
+        OverlayInstanceList _overlays;
         MenuDetector _menu_detector;
 
         // Tools:
@@ -166,6 +186,7 @@ namespace trview
 
         UpdateChecker _update_checker;
         std::unique_ptr<ITypeNameLookup> _type_name_lookup;
+        CompressedTileCache _tile_cache{ CompressedTileCache::default_folder() };
     };
 }
 
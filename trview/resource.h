@@ -32,6 +32,8 @@
 #define IDR_FONT_LIST                   147
 #define IDF_ARIAL8                      148
 #define IDR_TYPE_NAMES                  149
+#define IDR_UI_BATCH_VERTEX_SHADER      150
+#define IDR_OVERLAY_VERTEX_SHADER       151
 #define ID_FILE_OPEN                    32771
 #define ID_FILE_OPENRECENT              ID_APP_FILE_OPENRECENT
 #define ID_EXIT                         32773
@@ -61,7 +63,7 @@
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NO_MFC                     1
-#define _APS_NEXT_RESOURCE_VALUE        150
+#define _APS_NEXT_RESOURCE_VALUE        152
 #define _APS_NEXT_COMMAND_VALUE         32784
 #define _APS_NEXT_CONTROL_VALUE         1000
 #define _APS_NEXT_SYMED_VALUE           110
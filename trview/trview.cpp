@@ -94,7 +94,10 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
         }
 
         viewer->render();
-        Sleep(1);
+
+        // Wait until there is input or until the next frame is due. If nothing needs to be rendered this
+        // waits for input, so nothing runs while the viewer is idle.
+        MsgWaitForMultipleObjectsEx(0, nullptr, viewer->wait_time(), QS_ALLINPUT, MWMO_INPUTAVAILABLE);
     }
 
     return (int) msg.wParam;